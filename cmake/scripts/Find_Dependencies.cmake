@@ -39,6 +39,11 @@ find_package( Boost REQUIRED )
 #include_directories( ${Boost_INCLUDE_DIRS} )
 
 
+#--------------------#
+#-     Threads      -#
+#--------------------#
+find_package( Threads REQUIRED )
+
 #------------------------------------#
 #-      Terminus Dependencies       -#
 #------------------------------------#
@@ -7,9 +7,11 @@
 
 // C++ Libraries
 #include <memory>
+#include <span>
 #include <string_view>
 
 // Terminus Libraries
+#include <terminus/coordinate/conversions/Geodetic_Conversions.hpp>
 #include <terminus/core/error/ErrorCategory.hpp>
 #include <terminus/math/matrix/Matrix.hpp>
 #include <terminus/math/vector/Vector.hpp>
@@ -63,6 +65,22 @@ class Datum
                double           semi_major_axis,
                double           semi_minor_axis,
                double           meridian_offset );
+
+        /**
+         * Move Constructor
+         */
+        Datum( Datum&& rhs ) noexcept;
+
+        /**
+         * Move Assignment
+         */
+        Datum& operator = ( Datum&& rhs ) noexcept;
+
+        /**
+         * Destructor.  Defined with Datum_Impl, so a Datum can be destroyed where
+         * the impl is incomplete.
+         */
+        ~Datum();
         
         /**
          * Get the name of the datum.
@@ -128,11 +146,38 @@ class Datum
          */
         //double inverse_flattening() const;
 
+        /**
+         * Get the ellipsoid and prime meridian used by the coordinate conversions
+         */
+        Ellipsoid ellipsoid() const;
+
         /**
          * Return cartesian (ECEF) coordinates of geodetic coordinates p [Lon, Lat, Height]
          */
         math::Vector3d geodetic_to_cartesian( const math::Vector3d& llh ) const;
 
+        /**
+         * Convert a buffer of [Lon, Lat, Height] points to cartesian (ECEF), splitting
+         * large buffers over the pool.  xyz may be the same buffer as llh.  Throws
+         * std::runtime_error if the spans differ in length.
+         */
+        void geodetic_to_cartesian( std::span<const math::Vector3d> llh,
+                                    std::span<math::Vector3d>       xyz,
+                                    math::parallel::Thread_Pool&    pool = math::parallel::Thread_Pool::global() ) const;
+
+        /**
+         * Convert separate longitude, latitude and height arrays to separate x, y and z
+         * arrays.  Outputs may be the same buffers as inputs.  Throws std::runtime_error
+         * if the spans differ in length.
+         */
+        void geodetic_to_cartesian( std::span<const double>      lon,
+                                    std::span<const double>      lat,
+                                    std::span<const double>      height,
+                                    std::span<double>            x,
+                                    std::span<double>            y,
+                                    std::span<double>            z,
+                                    math::parallel::Thread_Pool& pool = math::parallel::Thread_Pool::global() ) const;
+
         /**
          * Return the rotation matrix for converting between ECEF and NED vectors. If v 
          * is a Cartesian (ECEF) vector, the inverse of this matrix times v will find 
@@ -148,6 +193,28 @@ class Datum
          * Convert cartesian XYZ coordinates into latitude/longitude/altitude
          */
         math::Vector3d cartesian_to_geodetic( const math::Vector3d& xyz ) const;
+
+        /**
+         * Convert a buffer of cartesian (ECEF) points to [Lon, Lat, Height], splitting
+         * large buffers over the pool.  llh may be the same buffer as xyz.  Throws
+         * std::runtime_error if the spans differ in length.
+         */
+        void cartesian_to_geodetic( std::span<const math::Vector3d> xyz,
+                                    std::span<math::Vector3d>       llh,
+                                    math::parallel::Thread_Pool&    pool = math::parallel::Thread_Pool::global() ) const;
+
+        /**
+         * Convert separate x, y and z arrays to separate longitude, latitude and height
+         * arrays.  Outputs may be the same buffers as inputs.  Throws std::runtime_error
+         * if the spans differ in length.
+         */
+        void cartesian_to_geodetic( std::span<const double>      x,
+                                    std::span<const double>      y,
+                                    std::span<const double>      z,
+                                    std::span<double>            lon,
+                                    std::span<double>            lat,
+                                    std::span<double>            height,
+                                    math::parallel::Thread_Pool& pool = math::parallel::Thread_Pool::global() ) const;
          
         /**
          * Create a Datum using a well-known name
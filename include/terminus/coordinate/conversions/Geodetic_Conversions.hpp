@@ -0,0 +1,322 @@
+/**
+ * @file    Geodetic_Conversions.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/parallel/Parallel_For.hpp>
+#include <terminus/math/vector/Vector.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <numbers>
+#include <span>
+
+/**
+ * Conversions between geodetic [Lon, Lat, Height] coordinates, in degrees and meters
+ * above a bi-axial ellipsoid, and cartesian (ECEF) coordinates in meters.
+ *
+ * The forward conversion is the closed form and is exact to roundoff.  The inverse
+ * uses Bowring's method, iterating the parametric latitude GEODETIC_ITERATIONS times
+ * from his initial estimate, with the height from the combined formula
+ *
+ *     h = p cos(lat) + z sin(lat) - a sqrt( 1 - e^2 sin^2(lat) )
+ *
+ * which is well conditioned at the poles and the equator alike.  For Earth ellipsoids
+ * and heights from -10 km to 10,000 km, round trips agree to 1e-13 degrees and 1e-8 m.
+ * Spherical datums are converted exactly.
+ *
+ * Longitudes are relative to the prime meridian, ie. the meridian offset is added
+ * going to cartesian and removed coming back, and are returned in [-180, 180].
+ *
+ * The span overloads convert points one at a time, splitting large inputs over the
+ * pool GEODETIC_GRAIN points per task.
+ */
+namespace tmns::coordinate {
+
+/**
+ * Constants of a bi-axial ellipsoid needed by the conversions
+ */
+struct Ellipsoid
+{
+    /**
+     * Constructor
+     *
+     * @param semi_major_axis  Equatorial radius, meters
+     * @param semi_minor_axis  Polar radius, meters
+     * @param meridian_offset  Longitude of the prime meridian east of Greenwich, degrees
+     */
+    Ellipsoid( double semi_major_axis,
+               double semi_minor_axis,
+               double meridian_offset = 0 )
+      : a( semi_major_axis ),
+        b( semi_minor_axis ),
+        e2( 1 - ( semi_minor_axis * semi_minor_axis ) / ( semi_major_axis * semi_major_axis ) ),
+        ep2( ( semi_major_axis * semi_major_axis ) / ( semi_minor_axis * semi_minor_axis ) - 1 ),
+        meridian_offset( meridian_offset )
+    {}
+
+    /// @brief Semi-major axis
+    double a;
+
+    /// @brief Semi-minor axis
+    double b;
+
+    /// @brief First eccentricity squared, 1 - b^2 / a^2
+    double e2;
+
+    /// @brief Second eccentricity squared, a^2 / b^2 - 1
+    double ep2;
+
+    /// @brief Prime meridian offset, degrees
+    double meridian_offset;
+};
+
+namespace detail {
+
+/// @brief Points claimed by a thread at a time
+static constexpr size_t GEODETIC_GRAIN { 4096 };
+
+/// @brief Bowring iterations of the inverse
+static constexpr size_t GEODETIC_ITERATIONS { 2 };
+
+static constexpr double DEG_TO_RAD { std::numbers::pi / 180.0 };
+static constexpr double RAD_TO_DEG { 180.0 / std::numbers::pi };
+
+/**
+ * Geodetic to cartesian for one point
+ */
+inline void geodetic_to_cartesian_point( const Ellipsoid& ellipsoid,
+                                         double           lon,
+                                         double           lat,
+                                         double           height,
+                                         double&          x,
+                                         double&          y,
+                                         double&          z )
+{
+    const double lon_rad = ( lon + ellipsoid.meridian_offset ) * DEG_TO_RAD;
+    const double lat_rad = lat * DEG_TO_RAD;
+    const double sin_lat = std::sin( lat_rad );
+    const double cos_lat = std::cos( lat_rad );
+
+    // Radius of curvature in the prime vertical
+    const double N = ellipsoid.a / std::sqrt( 1 - ellipsoid.e2 * sin_lat * sin_lat );
+
+    const double r = ( N + height ) * cos_lat;
+    x = r * std::cos( lon_rad );
+    y = r * std::sin( lon_rad );
+    z = ( N * ( 1 - ellipsoid.e2 ) + height ) * sin_lat;
+}
+
+/**
+ * Cartesian to geodetic for one point
+ */
+inline void cartesian_to_geodetic_point( const Ellipsoid& ellipsoid,
+                                         double           x,
+                                         double           y,
+                                         double           z,
+                                         double&          lon,
+                                         double&          lat,
+                                         double&          height )
+{
+    const double a = ellipsoid.a;
+    const double b = ellipsoid.b;
+    const double p = std::sqrt( x * x + y * y );
+
+    // Parametric latitude as a unit ( cos, sin ) pair.  Zero at the center of the body.
+    auto normalize = []( double& c, double& s )
+    {
+        const double norm_sq = c * c + s * s;
+        const double scale   = norm_sq > 0 ? 1.0 / std::sqrt( norm_sq ) : 0.0;
+        c *= scale;
+        s *= scale;
+    };
+    double cos_beta = b * p;
+    double sin_beta = a * z;
+    normalize( cos_beta, sin_beta );
+
+    double num = z;
+    double den = p;
+    for( size_t iteration = 0; iteration < GEODETIC_ITERATIONS; iteration++ )
+    {
+        num = z + ellipsoid.ep2 * b * sin_beta * sin_beta * sin_beta;
+        den = p - ellipsoid.e2  * a * cos_beta * cos_beta * cos_beta;
+
+        // tan( beta ) = ( b / a ) tan( lat )
+        cos_beta = a * den;
+        sin_beta = b * num;
+        normalize( cos_beta, sin_beta );
+    }
+
+    double cos_lat = den;
+    double sin_lat = num;
+    normalize( cos_lat, sin_lat );
+
+    double lon_deg = std::atan2( y, x ) * RAD_TO_DEG - ellipsoid.meridian_offset;
+    lon_deg = lon_deg >  180 ? lon_deg - 360 : lon_deg;
+    lon_deg = lon_deg < -180 ? lon_deg + 360 : lon_deg;
+
+    lon    = lon_deg;
+    lat    = std::atan2( num, den ) * RAD_TO_DEG;
+    height = p * cos_lat + z * sin_lat - a * std::sqrt( 1 - ellipsoid.e2 * sin_lat * sin_lat );
+}
+
+/**
+ * Convert array-of-structures points, calling convert( in0, in1, in2, out0, out1, out2 )
+ * on each
+ */
+template <typename ConvertT>
+void convert_aos( const char*                     name,
+                  std::span<const math::Vector3d> input,
+                  std::span<math::Vector3d>       output,
+                  ConvertT                        convert,
+                  math::parallel::Thread_Pool&    pool )
+{
+    math::parallel::check_batch_sizes( name, input.size(), { output.size() } );
+    math::parallel::parallel_for( 0, input.size(), GEODETIC_GRAIN,
+                                  [&]( size_t begin,
+                                       size_t end )
+                                  {
+                                      for( size_t i = begin; i < end; i++ )
+                                      {
+                                          // Inputs are copied before any output is written
+                                          convert( input[i][0], input[i][1], input[i][2],
+                                                   output[i][0], output[i][1], output[i][2] );
+                                      }
+                                  },
+                                  pool );
+}
+
+/**
+ * Convert structure-of-arrays points, calling convert( in0, in1, in2, out0, out1, out2 )
+ * on each
+ */
+template <typename ConvertT>
+void convert_soa( const char*                  name,
+                  std::span<const double>      in0,
+                  std::span<const double>      in1,
+                  std::span<const double>      in2,
+                  std::span<double>            out0,
+                  std::span<double>            out1,
+                  std::span<double>            out2,
+                  ConvertT                     convert,
+                  math::parallel::Thread_Pool& pool )
+{
+    math::parallel::check_batch_sizes( name, in0.size(), { in1.size(), in2.size(), out0.size(), out1.size(), out2.size() } );
+    math::parallel::parallel_for( 0, in0.size(), GEODETIC_GRAIN,
+                                  [&]( size_t begin,
+                                       size_t end )
+                                  {
+                                      for( size_t i = begin; i < end; i++ )
+                                      {
+                                          convert( in0[i], in1[i], in2[i], out0[i], out1[i], out2[i] );
+                                      }
+                                  },
+                                  pool );
+}
+
+} // End of detail namespace
+
+/**
+ * Cartesian (ECEF) coordinates of geodetic coordinates [Lon, Lat, Height]
+ */
+inline math::Vector3d geodetic_to_cartesian( const Ellipsoid&      ellipsoid,
+                                             const math::Vector3d& llh )
+{
+    math::Vector3d xyz;
+    detail::geodetic_to_cartesian_point( ellipsoid, llh[0], llh[1], llh[2], xyz[0], xyz[1], xyz[2] );
+    return xyz;
+}
+
+/**
+ * Geodetic coordinates [Lon, Lat, Height] of cartesian (ECEF) coordinates
+ */
+inline math::Vector3d cartesian_to_geodetic( const Ellipsoid&      ellipsoid,
+                                             const math::Vector3d& xyz )
+{
+    math::Vector3d llh;
+    detail::cartesian_to_geodetic_point( ellipsoid, xyz[0], xyz[1], xyz[2], llh[0], llh[1], llh[2] );
+    return llh;
+}
+
+/**
+ * Convert [Lon, Lat, Height] points to cartesian.  xyz may be the same buffer as llh.
+ * Throws std::runtime_error if the spans differ in length.
+ */
+inline void geodetic_to_cartesian( const Ellipsoid&                 ellipsoid,
+                                   std::span<const math::Vector3d>  llh,
+                                   std::span<math::Vector3d>        xyz,
+                                   math::parallel::Thread_Pool&     pool = math::parallel::Thread_Pool::global() )
+{
+    detail::convert_aos( "geodetic_to_cartesian", llh, xyz,
+                         [&]( double lon, double lat, double height, double& x, double& y, double& z )
+                         {
+                             detail::geodetic_to_cartesian_point( ellipsoid, lon, lat, height, x, y, z );
+                         },
+                         pool );
+}
+
+/**
+ * Convert cartesian points to [Lon, Lat, Height].  llh may be the same buffer as xyz.
+ * Throws std::runtime_error if the spans differ in length.
+ */
+inline void cartesian_to_geodetic( const Ellipsoid&                 ellipsoid,
+                                   std::span<const math::Vector3d>  xyz,
+                                   std::span<math::Vector3d>        llh,
+                                   math::parallel::Thread_Pool&     pool = math::parallel::Thread_Pool::global() )
+{
+    detail::convert_aos( "cartesian_to_geodetic", xyz, llh,
+                         [&]( double x, double y, double z, double& lon, double& lat, double& height )
+                         {
+                             detail::cartesian_to_geodetic_point( ellipsoid, x, y, z, lon, lat, height );
+                         },
+                         pool );
+}
+
+/**
+ * Convert points held as separate longitude, latitude and height arrays to separate
+ * x, y and z arrays.  Outputs may be the same buffers as inputs.  Throws
+ * std::runtime_error if the spans differ in length.
+ */
+inline void geodetic_to_cartesian( const Ellipsoid&             ellipsoid,
+                                   std::span<const double>      lon,
+                                   std::span<const double>      lat,
+                                   std::span<const double>      height,
+                                   std::span<double>            x,
+                                   std::span<double>            y,
+                                   std::span<double>            z,
+                                   math::parallel::Thread_Pool& pool = math::parallel::Thread_Pool::global() )
+{
+    detail::convert_soa( "geodetic_to_cartesian", lon, lat, height, x, y, z,
+                         [&]( double lon, double lat, double height, double& x, double& y, double& z )
+                         {
+                             detail::geodetic_to_cartesian_point( ellipsoid, lon, lat, height, x, y, z );
+                         },
+                         pool );
+}
+
+/**
+ * Convert points held as separate x, y and z arrays to separate longitude, latitude
+ * and height arrays.  Outputs may be the same buffers as inputs.  Throws
+ * std::runtime_error if the spans differ in length.
+ */
+inline void cartesian_to_geodetic( const Ellipsoid&             ellipsoid,
+                                   std::span<const double>      x,
+                                   std::span<const double>      y,
+                                   std::span<const double>      z,
+                                   std::span<double>            lon,
+                                   std::span<double>            lat,
+                                   std::span<double>            height,
+                                   math::parallel::Thread_Pool& pool = math::parallel::Thread_Pool::global() )
+{
+    detail::convert_soa( "cartesian_to_geodetic", x, y, z, lon, lat, height,
+                         [&]( double x, double y, double z, double& lon, double& lat, double& height )
+                         {
+                             detail::cartesian_to_geodetic_point( ellipsoid, x, y, z, lon, lat, height );
+                         },
+                         pool );
+}
+
+} // End of tmns::coordinate namespace
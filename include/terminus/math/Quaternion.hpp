@@ -11,6 +11,7 @@
 
 // C++ Libraries
 #include <cmath>
+#include <type_traits>
 
 namespace tmns::math {
 
@@ -167,6 +168,12 @@ class Quaternion
                                components[3] );
         }
 
+        /**
+         * Build the 3x3 rotation matrix equivalent to this quaternion.
+         * The quaternion is normalized first.
+         */
+        Matrix<ElementT,3,3> to_matrix() const;
+
         /**
          * Rotate a Vector by the quaternion. 
          * 
@@ -174,13 +181,32 @@ class Quaternion
          *                         (v)   Q1, [0, v1, v2, v3]
          * 
          * Perform (Q1 x Q2)/Q1, return imaginary component.
+         *
+         * Vectors of other scalar types, such as Jet, are rotated through the
+         * equivalent rotation matrix and keep their scalar type.
          */
         template<typename InVectorT>
-        Vector_<ElementT,3> rotate_vector( const Vector_Base<InVectorT>& in_vec ) const
+        Vector_<typename Promote_Type<ElementT,typename InVectorT::value_type>::type,3>
+            rotate_vector( const Vector_Base<InVectorT>& in_vec ) const
         {
+            using value_type = typename Promote_Type<ElementT,typename InVectorT::value_type>::type;
+
             // Get underlying vector type
             const InVectorT& v = in_vec.impl();
-            return ( *this * Quaternion( 0, v[0], v[1], v[2] ) / *this ).imag();
+            if constexpr ( std::is_same_v<value_type,ElementT> )
+            {
+                return ( *this * Quaternion( 0, v[0], v[1], v[2] ) / *this ).imag();
+            }
+            else
+            {
+                const auto R = to_matrix();
+                Vector_<value_type,3> result;
+                for( size_t r = 0; r < 3; r++ )
+                {
+                    result[r] = R( r, 0 ) * v[0] + R( r, 1 ) * v[1] + R( r, 2 ) * v[2];
+                }
+                return result;
+            }
         }
 
     private:
@@ -35,4 +35,50 @@ Quaternion slerp_n( std::vector<double>     w,
                     std::vector<Quaternion> Q,
                     int                     spin );
 
+/**
+ * SO(3) exponential map.  Build the unit quaternion rotating by |omega| radians about
+ * the axis omega.  Accurate as |omega| approaches zero.
+ */
+Quaternion quaternion_exp( const Vector3d& omega );
+
+/**
+ * SO(3) logarithm map, the inverse of quaternion_exp().  Returns the rotation vector
+ * of q, normalized first, with angle in [0, pi].
+ */
+Vector3d quaternion_log( const Quaternion& q );
+
+/**
+ * Rotate a vector by the quaternion q = [w, x, y, z], which need not be unit length.
+ *
+ * Unlike Quaternion::rotate_vector, the quaternion components may be any scalar
+ * type, so this can be used inside auto-differentiated models which estimate the
+ * rotation itself (e.g. Jet parameters).
+ */
+template <typename QuaternionT,
+          typename VectorT>
+Vector_<typename Promote_Type<typename QuaternionT::value_type,
+                              typename VectorT::value_type>::type,3>
+    quaternion_rotate( const Vector_Base<QuaternionT>& quat,
+                       const Vector_Base<VectorT>&     vec )
+{
+    using value_type = typename Promote_Type<typename QuaternionT::value_type,
+                                             typename VectorT::value_type>::type;
+    const QuaternionT& q = quat.impl();
+    const VectorT&     v = vec.impl();
+
+    // t = u x v, where u is the imaginary part
+    value_type t0 = q[2] * v[2] - q[3] * v[1];
+    value_type t1 = q[3] * v[0] - q[1] * v[2];
+    value_type t2 = q[1] * v[1] - q[2] * v[0];
+
+    // v' = v + 2 / |q|^2 * ( w t + u x t )
+    value_type scale = 2.0 / ( q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3] );
+
+    Vector_<value_type,3> result;
+    result[0] = v[0] + scale * ( q[0] * t0 + q[2] * t2 - q[3] * t1 );
+    result[1] = v[1] + scale * ( q[0] * t1 + q[3] * t0 - q[1] * t2 );
+    result[2] = v[2] + scale * ( q[0] * t2 + q[1] * t1 - q[2] * t0 );
+    return result;
+}
+
 } // End of tmns::math namespace
\ No newline at end of file
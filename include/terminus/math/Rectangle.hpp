@@ -200,7 +200,7 @@ class Rectangle
         /**
          * Return point of the minimum range
         */
-        Point2_<ValueT> min() const
+        Point_<ValueT,Dims> min() const
         {
             return bl();
         }
@@ -208,7 +208,7 @@ class Rectangle
         /**
          * Return point of the minimum range
         */
-        Point2_<ValueT>& min()
+        Point_<ValueT,Dims>& min()
         {
             return bl();
         }
@@ -216,9 +216,10 @@ class Rectangle
         /**
          * Return point of the maximum range
         */
-        Point2_<ValueT> max() const
+        Point_<ValueT,Dims> max() const
         {
-            return tr();
+            Point_<ValueT,Dims> offset( m_lengths );
+            return m_bl + offset;
         }
 
         /**
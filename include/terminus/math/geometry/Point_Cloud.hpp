@@ -0,0 +1,644 @@
+/**
+ * @file    Point_Cloud.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include "../Point.hpp"
+#include "../Quaternion.hpp"
+#include "../Rectangle.hpp"
+#include "../matrix/Matrix.hpp"
+#include "../parallel/Parallel_For.hpp"
+#include "../vector/Vector.hpp"
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace tmns::math::geom {
+
+/**
+ * @class Point_Cloud
+ *
+ * Structure-of-arrays container for large point sets.  Each coordinate axis is
+ * stored in its own contiguous array, along with any number of named, per-point
+ * attribute channels (intensity, classification, etc).
+ *
+ * Bulk operations are split across the global thread pool in fixed-size chunks
+ * and written as straight loops over the coordinate arrays so the compiler can
+ * vectorize them.  Reductions (bounding box, centroid, covariance) merge the
+ * per-chunk partials in chunk order, so results do not depend on thread count.
+ */
+template <typename ValueT,
+          int      Dims>
+class Point_Cloud
+{
+    public:
+
+        /// @brief Value Type
+        using value_type = ValueT;
+
+        /// @brief Point Type
+        using point_type = Point_<ValueT,Dims>;
+
+        /// @brief Per-axis storage
+        using array_type = std::vector<ValueT>;
+
+        /// @brief Per-point attribute storage
+        using attribute_type = std::vector<double>;
+
+        /// @brief Number of points processed per parallel task
+        static constexpr size_t DEFAULT_GRAIN { 1 << 16 };
+
+        /**
+         * Default Constructor
+         */
+        Point_Cloud() = default;
+
+        /**
+         * Create a cloud of num_points points at the origin
+         */
+        explicit Point_Cloud( size_t num_points )
+        {
+            resize( num_points );
+        }
+
+        /**
+         * Create a cloud from an array of points
+         */
+        explicit Point_Cloud( const std::vector<point_type>& points )
+        {
+            resize( points.size() );
+            parallel::parallel_for( 0, size(), DEFAULT_GRAIN, [&]( size_t begin, size_t end )
+            {
+                for( size_t d = 0; d < Dims; d++ )
+                {
+                    ValueT* dst = m_coords[d].data();
+                    for( size_t i = begin; i < end; i++ )
+                    {
+                        dst[i] = points[i][d];
+                    }
+                }
+            });
+        }
+
+        /**
+         * Get the number of points
+         */
+        size_t size() const
+        {
+            return m_coords[0].size();
+        }
+
+        /**
+         * Check if the cloud is empty
+         */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /**
+         * Get the number of dimensions
+         */
+        static constexpr size_t dimensions()
+        {
+            return Dims;
+        }
+
+        /**
+         * Resize the cloud.  New points and attribute values are zero.
+         */
+        void resize( size_t num_points )
+        {
+            for( auto& axis : m_coords )
+            {
+                axis.resize( num_points, 0 );
+            }
+            for( auto& [name, values] : m_attributes )
+            {
+                values.resize( num_points, 0 );
+            }
+        }
+
+        /**
+         * Reserve space for num_points points
+         */
+        void reserve( size_t num_points )
+        {
+            for( auto& axis : m_coords )
+            {
+                axis.reserve( num_points );
+            }
+            for( auto& [name, values] : m_attributes )
+            {
+                values.reserve( num_points );
+            }
+        }
+
+        /**
+         * Append a point.  Attribute values for the new point are zero.
+         */
+        void push_back( const point_type& point )
+        {
+            for( size_t d = 0; d < Dims; d++ )
+            {
+                m_coords[d].push_back( point[d] );
+            }
+            for( auto& [name, values] : m_attributes )
+            {
+                values.push_back( 0 );
+            }
+        }
+
+        /**
+         * Get a single point
+         */
+        point_type point( size_t idx ) const
+        {
+            point_type output;
+            for( size_t d = 0; d < Dims; d++ )
+            {
+                output[d] = m_coords[d][idx];
+            }
+            return output;
+        }
+
+        /**
+         * Set a single point
+         */
+        void set_point( size_t            idx,
+                        const point_type& point )
+        {
+            for( size_t d = 0; d < Dims; d++ )
+            {
+                m_coords[d][idx] = point[d];
+            }
+        }
+
+        /**
+         * Get the array for a single axis
+         */
+        array_type& coords( size_t axis )
+        {
+            return m_coords.at( axis );
+        }
+
+        /**
+         * Get the array for a single axis
+         */
+        const array_type& coords( size_t axis ) const
+        {
+            return m_coords.at( axis );
+        }
+
+        /**
+         * Convert back to an array of points
+         */
+        std::vector<point_type> to_points() const
+        {
+            std::vector<point_type> output( size() );
+            parallel::parallel_for( 0, size(), DEFAULT_GRAIN, [&]( size_t begin, size_t end )
+            {
+                for( size_t i = begin; i < end; i++ )
+                {
+                    output[i] = point( i );
+                }
+            });
+            return output;
+        }
+
+        /**
+         * Add a per-point attribute channel, filled with default_value.
+         * @return False if an attribute with that name already exists.
+         */
+        bool add_attribute( const std::string& name,
+                            double             default_value = 0 )
+        {
+            if( has_attribute( name ) )
+            {
+                return false;
+            }
+            m_attributes.emplace( name, attribute_type( size(), default_value ) );
+            return true;
+        }
+
+        /**
+         * Check if an attribute channel exists
+         */
+        bool has_attribute( const std::string& name ) const
+        {
+            return m_attributes.find( name ) != m_attributes.end();
+        }
+
+        /**
+         * Get an attribute channel.  Throws if it does not exist.
+         */
+        attribute_type& attribute( const std::string& name )
+        {
+            return m_attributes.at( check_attribute( name ) );
+        }
+
+        /**
+         * Get an attribute channel.  Throws if it does not exist.
+         */
+        const attribute_type& attribute( const std::string& name ) const
+        {
+            return m_attributes.at( check_attribute( name ) );
+        }
+
+        /**
+         * Get the attribute names, in sorted order
+         */
+        std::vector<std::string> attribute_names() const
+        {
+            std::vector<std::string> output;
+            for( const auto& [name, values] : m_attributes )
+            {
+                output.push_back( name );
+            }
+            return output;
+        }
+
+        /**
+         * Apply an affine transform in place:  p' = A * p + t
+         */
+        template <typename MatrixValueT,
+                  typename VectorValueT>
+        void transform( const Matrix<MatrixValueT,Dims,Dims>& A,
+                        const Vector_<VectorValueT,Dims>&     t )
+        {
+            // Copy out of the matrix so the inner loop has no bounds checks
+            std::array<double,Dims*Dims> a;
+            std::array<double,Dims>      b;
+            for( size_t r = 0; r < Dims; r++ )
+            {
+                b[r] = t[r];
+                for( size_t c = 0; c < Dims; c++ )
+                {
+                    a[r * Dims + c] = A( r, c );
+                }
+            }
+            apply_affine( a, b );
+        }
+
+        /**
+         * Apply a linear transform in place:  p' = A * p
+         */
+        template <typename MatrixValueT>
+        void transform( const Matrix<MatrixValueT,Dims,Dims>& A )
+        {
+            transform( A, Vector_<double,Dims>() );
+        }
+
+        /**
+         * Apply a homogeneous transform in place.  The last row is ignored, so
+         * this handles rigid and affine transforms but not projective ones.
+         */
+        template <typename MatrixValueT>
+        void transform( const Matrix<MatrixValueT,Dims+1,Dims+1>& H )
+        {
+            std::array<double,Dims*Dims> a;
+            std::array<double,Dims>      b;
+            for( size_t r = 0; r < Dims; r++ )
+            {
+                b[r] = H( r, Dims );
+                for( size_t c = 0; c < Dims; c++ )
+                {
+                    a[r * Dims + c] = H( r, c );
+                }
+            }
+            apply_affine( a, b );
+        }
+
+        /**
+         * Apply a rigid transform in place:  p' = R(q) * p + t
+         */
+        template <typename VectorValueT>
+        void transform( const Quaternion&                 rotation,
+                        const Vector_<VectorValueT,Dims>& translation ) requires ( Dims == 3 )
+        {
+            transform( rotation.to_matrix(), translation );
+        }
+
+        /**
+         * Apply a rotation in place:  p' = R(q) * p
+         */
+        void transform( const Quaternion& rotation ) requires ( Dims == 3 )
+        {
+            transform( rotation.to_matrix() );
+        }
+
+        /**
+         * Compute the axis-aligned bounding box.  Empty clouds return an
+         * empty Rectangle.
+         */
+        Rectangle<ValueT,Dims> bounding_box() const
+        {
+            if( empty() )
+            {
+                return Rectangle<ValueT,Dims>();
+            }
+
+            using bounds_t = std::array<ValueT,2*Dims>;
+            std::vector<bounds_t> partials( parallel::chunk_count( 0, size(), DEFAULT_GRAIN ) );
+            parallel::parallel_for_chunks( 0, size(), DEFAULT_GRAIN, [&]( size_t chunk, size_t begin, size_t end )
+            {
+                auto& bounds = partials[chunk];
+                for( size_t d = 0; d < Dims; d++ )
+                {
+                    const ValueT* src = m_coords[d].data();
+                    ValueT min_val = src[begin];
+                    ValueT max_val = src[begin];
+                    for( size_t i = begin + 1; i < end; i++ )
+                    {
+                        min_val = std::min( min_val, src[i] );
+                        max_val = std::max( max_val, src[i] );
+                    }
+                    bounds[d]        = min_val;
+                    bounds[Dims + d] = max_val;
+                }
+            });
+
+            point_type min_point, max_point;
+            for( size_t d = 0; d < Dims; d++ )
+            {
+                min_point[d] = partials[0][d];
+                max_point[d] = partials[0][Dims + d];
+                for( const auto& bounds : partials )
+                {
+                    min_point[d] = std::min( min_point[d], bounds[d] );
+                    max_point[d] = std::max( max_point[d], bounds[Dims + d] );
+                }
+            }
+            return Rectangle<ValueT,Dims>( min_point, max_point );
+        }
+
+        /**
+         * Compute the centroid.  Accumulates in double precision.
+         */
+        Vector_<double,Dims> centroid() const
+        {
+            Vector_<double,Dims> output;
+            if( empty() )
+            {
+                return output;
+            }
+
+            using sums_t = std::array<double,Dims>;
+            std::vector<sums_t> partials( parallel::chunk_count( 0, size(), DEFAULT_GRAIN ) );
+            parallel::parallel_for_chunks( 0, size(), DEFAULT_GRAIN, [&]( size_t chunk, size_t begin, size_t end )
+            {
+                for( size_t d = 0; d < Dims; d++ )
+                {
+                    const ValueT* src = m_coords[d].data();
+                    double sum = 0;
+                    for( size_t i = begin; i < end; i++ )
+                    {
+                        sum += src[i];
+                    }
+                    partials[chunk][d] = sum;
+                }
+            });
+
+            for( const auto& sums : partials )
+            {
+                for( size_t d = 0; d < Dims; d++ )
+                {
+                    output[d] += sums[d];
+                }
+            }
+            return output / static_cast<double>( size() );
+        }
+
+        /**
+         * Compute the covariance of the points about their centroid,
+         * normalized by the number of points.
+         */
+        Matrix<double,Dims,Dims> covariance() const
+        {
+            Matrix<double,Dims,Dims> output;
+            if( empty() )
+            {
+                return output;
+            }
+            auto center = centroid();
+
+            using sums_t = std::array<double,Dims*Dims>;
+            std::vector<sums_t> partials( parallel::chunk_count( 0, size(), DEFAULT_GRAIN ) );
+            parallel::parallel_for_chunks( 0, size(), DEFAULT_GRAIN, [&]( size_t chunk, size_t begin, size_t end )
+            {
+                auto& sums = partials[chunk];
+                sums.fill( 0 );
+                for( size_t r = 0; r < Dims; r++ )
+                {
+                    const ValueT* src_r = m_coords[r].data();
+                    for( size_t c = r; c < Dims; c++ )
+                    {
+                        const ValueT* src_c = m_coords[c].data();
+                        double sum = 0;
+                        for( size_t i = begin; i < end; i++ )
+                        {
+                            sum += ( src_r[i] - center[r] ) * ( src_c[i] - center[c] );
+                        }
+                        sums[r * Dims + c] = sum;
+                    }
+                }
+            });
+
+            for( const auto& sums : partials )
+            {
+                for( size_t r = 0; r < Dims; r++ )
+                {
+                    for( size_t c = r; c < Dims; c++ )
+                    {
+                        output( r, c ) += sums[r * Dims + c];
+                    }
+                }
+            }
+            for( size_t r = 0; r < Dims; r++ )
+            {
+                for( size_t c = r; c < Dims; c++ )
+                {
+                    output( r, c ) /= static_cast<double>( size() );
+                    output( c, r )  = output( r, c );
+                }
+            }
+            return output;
+        }
+
+        /**
+         * Compute the Euclidean distance from every point to a reference point
+         */
+        template <typename OtherValueT>
+        std::vector<double> distances_to( const Point_<OtherValueT,Dims>& reference ) const
+        {
+            std::vector<double> output( size() );
+            parallel::parallel_for( 0, size(), DEFAULT_GRAIN, [&]( size_t begin, size_t end )
+            {
+                double* dst = output.data();
+                for( size_t i = begin; i < end; i++ )
+                {
+                    dst[i] = 0;
+                }
+                for( size_t d = 0; d < Dims; d++ )
+                {
+                    const ValueT* src = m_coords[d].data();
+                    const double  ref = reference[d];
+                    for( size_t i = begin; i < end; i++ )
+                    {
+                        double delta = src[i] - ref;
+                        dst[i] += delta * delta;
+                    }
+                }
+                for( size_t i = begin; i < end; i++ )
+                {
+                    dst[i] = std::sqrt( dst[i] );
+                }
+            });
+            return output;
+        }
+
+        /**
+         * Compute the magnitude of every point (distance to the origin)
+         */
+        std::vector<double> magnitudes() const
+        {
+            return distances_to( Point_<double,Dims>() );
+        }
+
+        /**
+         * Build a compacted cloud holding the points for which predicate( point )
+         * is true, in their original order, along with their attributes.
+         */
+        template <typename PredicateT>
+        Point_Cloud filter( PredicateT&& predicate ) const
+        {
+            // Evaluate the predicate and count survivors per chunk
+            const size_t num_chunks = parallel::chunk_count( 0, size(), DEFAULT_GRAIN );
+            std::vector<uint8_t> mask( size() );
+            std::vector<size_t>  offsets( num_chunks + 1, 0 );
+            parallel::parallel_for_chunks( 0, size(), DEFAULT_GRAIN, [&]( size_t chunk, size_t begin, size_t end )
+            {
+                size_t count = 0;
+                for( size_t i = begin; i < end; i++ )
+                {
+                    mask[i] = predicate( point( i ) ) ? 1 : 0;
+                    count  += mask[i];
+                }
+                offsets[chunk + 1] = count;
+            });
+            for( size_t chunk = 0; chunk < num_chunks; chunk++ )
+            {
+                offsets[chunk + 1] += offsets[chunk];
+            }
+
+            // Scatter each chunk into its slot of the output
+            Point_Cloud output( offsets.back() );
+            for( const auto& [name, values] : m_attributes )
+            {
+                output.add_attribute( name );
+            }
+            parallel::parallel_for_chunks( 0, size(), DEFAULT_GRAIN, [&]( size_t chunk, size_t begin, size_t end )
+            {
+                for( size_t d = 0; d < Dims; d++ )
+                {
+                    compact( m_coords[d], output.m_coords[d], mask, begin, end, offsets[chunk] );
+                }
+                for( const auto& [name, values] : m_attributes )
+                {
+                    compact( values, output.m_attributes.at( name ), mask, begin, end, offsets[chunk] );
+                }
+            });
+            return output;
+        }
+
+    private:
+
+        /**
+         * Apply p' = a * p + b, with a stored row-major
+         */
+        void apply_affine( const std::array<double,Dims*Dims>& a,
+                           const std::array<double,Dims>&      b )
+        {
+            std::array<ValueT*,Dims> axes;
+            for( size_t d = 0; d < Dims; d++ )
+            {
+                axes[d] = m_coords[d].data();
+            }
+
+            parallel::parallel_for( 0, size(), DEFAULT_GRAIN, [&]( size_t begin, size_t end )
+            {
+                for( size_t i = begin; i < end; i++ )
+                {
+                    std::array<double,Dims> in;
+                    for( size_t d = 0; d < Dims; d++ )
+                    {
+                        in[d] = axes[d][i];
+                    }
+                    for( size_t r = 0; r < Dims; r++ )
+                    {
+                        double sum = b[r];
+                        for( size_t c = 0; c < Dims; c++ )
+                        {
+                            sum += a[r * Dims + c] * in[c];
+                        }
+                        axes[r][i] = static_cast<ValueT>( sum );
+                    }
+                }
+            });
+        }
+
+        /**
+         * Copy the masked elements of src[begin,end) to dst starting at offset
+         */
+        template <typename ArrayT>
+        static void compact( const ArrayT&               src,
+                             ArrayT&                     dst,
+                             const std::vector<uint8_t>& mask,
+                             size_t                      begin,
+                             size_t                      end,
+                             size_t                      offset )
+        {
+            for( size_t i = begin; i < end; i++ )
+            {
+                if( mask[i] )
+                {
+                    dst[offset++] = src[i];
+                }
+            }
+        }
+
+        /**
+         * Throw if the attribute does not exist
+         */
+        const std::string& check_attribute( const std::string& name ) const
+        {
+            if( !has_attribute( name ) )
+            {
+                std::stringstream sout;
+                sout << "Point_Cloud: No attribute named \"" << name << "\"";
+                throw std::runtime_error( sout.str() );
+            }
+            return name;
+        }
+
+        /// @brief Coordinate arrays, one per axis
+        std::array<array_type,Dims> m_coords;
+
+        /// @brief Per-point attribute channels
+        std::map<std::string,attribute_type> m_attributes;
+
+}; // End of Point_Cloud class
+
+} // End of tmns::math::geom namespace
@@ -0,0 +1,341 @@
+/**
+ * @file    Cholesky.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/Matrix_Base.hpp>
+#include <terminus/math/vector/Vector_Base.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace tmns::math::linalg {
+
+/**
+ * In-place Cholesky factorization A = L * L^T of a symmetric positive-definite matrix.
+ *
+ * Only the lower triangle (including the diagonal) of A is read, and it is
+ * overwritten with L.  The strict upper triangle is left untouched.  No memory
+ * is allocated, so this is safe to call from inner solver loops.
+ *
+ * @return False if A is not numerically positive-definite.  A is then partially
+ *         overwritten and must be rebuilt before retrying.
+ */
+template <typename MatrixT>
+bool cholesky_decompose( Matrix_Base<MatrixT>& matrix )
+{
+    MatrixT& A = matrix.impl();
+    const size_t n = A.rows();
+    if( A.cols() != n )
+    {
+        return false;
+    }
+
+    for( size_t j = 0; j < n; j++ )
+    {
+        double diag = A( j, j );
+        for( size_t k = 0; k < j; k++ )
+        {
+            diag -= A( j, k ) * A( j, k );
+        }
+        if( !( diag > 0 ) || !std::isfinite( diag ) )
+        {
+            return false;
+        }
+        diag = std::sqrt( diag );
+        A( j, j ) = diag;
+
+        for( size_t i = j + 1; i < n; i++ )
+        {
+            double value = A( i, j );
+            for( size_t k = 0; k < j; k++ )
+            {
+                value -= A( i, k ) * A( j, k );
+            }
+            A( i, j ) = value / diag;
+        }
+    }
+    return true;
+}
+
+/**
+ * Solve A * x = b in place, given the factor L from cholesky_decompose().
+ * On return, b holds x.
+ */
+template <typename MatrixT,
+          typename VectorT>
+void cholesky_solve( const Matrix_Base<MatrixT>& factor,
+                     Vector_Base<VectorT>&       rhs )
+{
+    const MatrixT& L = factor.impl();
+    VectorT& b = rhs.impl();
+    const size_t n = L.rows();
+
+    // Forward substitution:  L * y = b
+    for( size_t i = 0; i < n; i++ )
+    {
+        double value = b[i];
+        for( size_t k = 0; k < i; k++ )
+        {
+            value -= L( i, k ) * b[k];
+        }
+        b[i] = value / L( i, i );
+    }
+
+    // Back substitution:  L^T * x = y
+    for( size_t ii = n; ii > 0; ii-- )
+    {
+        size_t i = ii - 1;
+        double value = b[i];
+        for( size_t k = i + 1; k < n; k++ )
+        {
+            value -= L( k, i ) * b[k];
+        }
+        b[i] = value / L( i, i );
+    }
+}
+
+/**
+ * In-place factorization P A P^T = L * D * L^T of a symmetric matrix, with L unit
+ * lower triangular and D block diagonal with 1x1 and 2x2 blocks.  Unlike
+ * cholesky_decompose() this accepts indefinite matrices, so it serves as the fallback
+ * when A is not positive-definite.
+ *
+ * Uses Bunch-Kaufman partial pivoting, so zero or tiny diagonal entries are pivoted
+ * around rather than divided by.  Only the lower triangle of A is read.  D is written
+ * to the diagonal (and first subdiagonal for 2x2 blocks) and the rest of the lower
+ * triangle is overwritten with L.  The interchanges go in pivots, which must hold
+ * n entries:  pivots[k] = p >= 0 if row k was swapped with row p for a 1x1 block,
+ * and pivots[k] = pivots[k+1] = -( p + 1 ) if row k + 1 was swapped with row p for a
+ * 2x2 block.  No memory is allocated.
+ *
+ * @return False if A is singular to working precision, relative to its largest entry.
+ */
+template <typename MatrixT,
+          typename PivotsT>
+bool ldlt_decompose( Matrix_Base<MatrixT>& matrix,
+                     PivotsT&              pivots )
+{
+    MatrixT& A = matrix.impl();
+    const size_t n = A.rows();
+    if( A.cols() != n )
+    {
+        return false;
+    }
+
+    double scale = 0;
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c <= r; c++ )
+        {
+            scale = std::max( scale, std::fabs( A( r, c ) ) );
+        }
+    }
+    const double tolerance = std::numeric_limits<double>::epsilon() * n * scale;
+
+    // Bunch-Kaufman growth bound, ( 1 + sqrt( 17 ) ) / 8
+    const double alpha = ( 1 + std::sqrt( 17.0 ) ) / 8;
+
+    // Swap rows and columns a and b > a of the trailing matrix from k, lower triangle only
+    auto interchange = [&]( size_t k, size_t a, size_t b )
+    {
+        for( size_t i = b + 1; i < n; i++ )
+        {
+            std::swap( A( i, a ), A( i, b ) );
+        }
+        for( size_t j = a + 1; j < b; j++ )
+        {
+            std::swap( A( j, a ), A( b, j ) );
+        }
+        std::swap( A( a, a ), A( b, b ) );
+        for( size_t j = k; j < a; j++ )
+        {
+            std::swap( A( a, j ), A( b, j ) );
+        }
+    };
+
+    size_t k = 0;
+    while( k < n )
+    {
+        // Largest entry below the diagonal in column k
+        const double abs_kk = std::fabs( A( k, k ) );
+        size_t imax = k;
+        double colmax = 0;
+        for( size_t i = k + 1; i < n; i++ )
+        {
+            if( std::fabs( A( i, k ) ) > colmax )
+            {
+                colmax = std::fabs( A( i, k ) );
+                imax   = i;
+            }
+        }
+        if( !( std::max( abs_kk, colmax ) > tolerance ) || !std::isfinite( abs_kk ) || !std::isfinite( colmax ) )
+        {
+            return false;
+        }
+
+        size_t step  = 1;
+        size_t pivot = k;
+        if( abs_kk < alpha * colmax )
+        {
+            // Largest off-diagonal entry in row imax
+            double rowmax = 0;
+            for( size_t j = k; j < imax; j++ )
+            {
+                rowmax = std::max( rowmax, std::fabs( A( imax, j ) ) );
+            }
+            for( size_t i = imax + 1; i < n; i++ )
+            {
+                rowmax = std::max( rowmax, std::fabs( A( i, imax ) ) );
+            }
+
+            if( abs_kk * rowmax >= alpha * colmax * colmax )
+            {
+                pivot = k;
+            }
+            else if( std::fabs( A( imax, imax ) ) >= alpha * rowmax )
+            {
+                pivot = imax;
+            }
+            else
+            {
+                pivot = imax;
+                step  = 2;
+            }
+        }
+
+        const size_t kk = k + step - 1;
+        if( pivot != kk )
+        {
+            interchange( k, kk, pivot );
+        }
+
+        if( step == 1 )
+        {
+            // L column k = A( k+1:n, k ) / d, and A22 -= d l l^T
+            const double d = A( k, k );
+            for( size_t j = k + 1; j < n; j++ )
+            {
+                const double l_j = A( j, k ) / d;
+                for( size_t i = j; i < n; i++ )
+                {
+                    A( i, j ) -= A( i, k ) * l_j;
+                }
+            }
+            for( size_t i = k + 1; i < n; i++ )
+            {
+                A( i, k ) /= d;
+            }
+            pivots[k] = static_cast<std::ptrdiff_t>( pivot );
+        }
+        else
+        {
+            // 2x2 block D = [ a b ; b c ], scaled by b to keep the inverse well formed
+            const double d21 = A( k + 1, k );
+            const double d11 = A( k + 1, k + 1 ) / d21;
+            const double d22 = A( k, k ) / d21;
+            const double t   = 1 / ( d11 * d22 - 1 );
+            for( size_t j = k + 2; j < n; j++ )
+            {
+                const double w0 = t * ( d11 * A( j, k ) - A( j, k + 1 ) ) / d21;
+                const double w1 = t * ( d22 * A( j, k + 1 ) - A( j, k ) ) / d21;
+                for( size_t i = j; i < n; i++ )
+                {
+                    A( i, j ) -= A( i, k ) * w0 + A( i, k + 1 ) * w1;
+                }
+                A( j, k )     = w0;
+                A( j, k + 1 ) = w1;
+            }
+            pivots[k]     = -static_cast<std::ptrdiff_t>( pivot + 1 );
+            pivots[k + 1] = pivots[k];
+        }
+        k += step;
+    }
+    return true;
+}
+
+/**
+ * Solve A * x = b in place, given the factors and pivots from ldlt_decompose().
+ * On return, b holds x.
+ */
+template <typename MatrixT,
+          typename PivotsT,
+          typename VectorT>
+void ldlt_solve( const Matrix_Base<MatrixT>& factor,
+                 const PivotsT&              pivots,
+                 Vector_Base<VectorT>&       rhs )
+{
+    const MatrixT& L = factor.impl();
+    VectorT& b = rhs.impl();
+    const size_t n = L.rows();
+
+    // Forward:  D L^T P x = L^-1 P b, one block at a time
+    size_t k = 0;
+    while( k < n )
+    {
+        if( pivots[k] >= 0 )
+        {
+            std::swap( b[k], b[static_cast<size_t>( pivots[k] )] );
+            for( size_t i = k + 1; i < n; i++ )
+            {
+                b[i] -= L( i, k ) * b[k];
+            }
+            b[k] /= L( k, k );
+            k += 1;
+        }
+        else
+        {
+            std::swap( b[k + 1], b[static_cast<size_t>( -pivots[k] - 1 )] );
+            for( size_t i = k + 2; i < n; i++ )
+            {
+                b[i] -= L( i, k ) * b[k] + L( i, k + 1 ) * b[k + 1];
+            }
+
+            // Solve the 2x2 block of D
+            const double d21   = L( k + 1, k );
+            const double d11   = L( k, k ) / d21;
+            const double d22   = L( k + 1, k + 1 ) / d21;
+            const double denom = d11 * d22 - 1;
+            const double b0    = b[k] / d21;
+            const double b1    = b[k + 1] / d21;
+            b[k]     = ( d22 * b0 - b1 ) / denom;
+            b[k + 1] = ( d11 * b1 - b0 ) / denom;
+            k += 2;
+        }
+    }
+
+    // Backward:  x = P^T L^-T y
+    k = n;
+    while( k > 0 )
+    {
+        const size_t i = k - 1;
+        if( pivots[i] >= 0 )
+        {
+            for( size_t r = i + 1; r < n; r++ )
+            {
+                b[i] -= L( r, i ) * b[r];
+            }
+            std::swap( b[i], b[static_cast<size_t>( pivots[i] )] );
+            k -= 1;
+        }
+        else
+        {
+            for( size_t r = i + 1; r < n; r++ )
+            {
+                b[i]     -= L( r, i ) * b[r];
+                b[i - 1] -= L( r, i - 1 ) * b[r];
+            }
+            std::swap( b[i], b[static_cast<size_t>( -pivots[i] - 1 )] );
+            k -= 2;
+        }
+    }
+}
+
+} // End of tmns::math::linalg namespace
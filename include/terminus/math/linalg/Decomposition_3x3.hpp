@@ -0,0 +1,608 @@
+/**
+ * @file    Decomposition_3x3.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/linalg/Solve_Batch.hpp>
+#include <terminus/math/matrix/Matrix.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
+#include <terminus/math/vector/Vector.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <limits>
+#include <span>
+
+/**
+ * Eigen-decomposition of symmetric 3x3 matrices and SVD of general 3x3 matrices, for
+ * point normals, Kabsch alignment and the like, without going through Eigen.
+ *
+ * The eigen-decomposition is cyclic Jacobi: rotations zero each off-diagonal entry in
+ * turn, converging quadratically, with sweeps repeated until the off-diagonal mass
+ * falls below machine precision.  For a symmetric A with unit roundoff u (2^-53 for
+ * double, 2^-24 for float), the results satisfy, up to a small constant,
+ *
+ *     | lambda_i - exact_i |  <=  u * |A|_F
+ *     | A V - V diag(lambda) |_F  <=  u * |A|_F
+ *     | V^T V - I |_F  <=  u
+ *
+ * Eigenvector accuracy is u * |A|_F over the gap to the nearest other eigenvalue, so
+ * vectors of repeated eigenvalues are any orthonormal basis of their space.
+ *
+ * The SVD is one-sided (Hestenes) Jacobi on A itself: rotations of column pairs,
+ * accumulated into V, until every pair of columns of A V is orthogonal to working
+ * precision.  Those columns are U diag(S), and U is taken from them by Gram-Schmidt
+ * and a cross product so it stays orthonormal when A is rank-deficient.  Never
+ * forming A^T A avoids squaring the condition number, so however close A is to
+ * singular (a near-planar Kabsch cross-covariance, say),
+ *
+ *     | A - U diag(S) V^T |_F  <=  u * |A|_F
+ *     | U^T U - I |_F, | V^T V - I |_F  <=  u
+ *     | sigma_i - exact_i |  <=  u * |A|_F
+ *
+ * again up to a small constant.  Singular vector accuracy is u * |A|_F over the gap
+ * to the nearest other singular value.
+ *
+ * The batched versions hold BATCH_LANES matrices side by side in structure-of-arrays
+ * form and run the same steps on every lane, so the loops vectorize across matrices.
+ */
+namespace tmns::math::linalg {
+
+/**
+ * Eigen-decomposition of a symmetric 3x3 matrix, A = V diag(values) V^T
+ */
+template <typename ValueT>
+struct Symmetric_Eigen_3x3
+{
+    /// @brief Eigenvalues, ascending
+    Vector_<ValueT,3> values;
+
+    /// @brief Orthonormal eigenvectors, as columns ordered like values
+    Matrix<ValueT,3,3> vectors;
+};
+
+/**
+ * Singular value decomposition of a 3x3 matrix, A = U diag(S) V^T
+ */
+template <typename ValueT>
+struct SVD_3x3
+{
+    /// @brief Left singular vectors, as columns
+    Matrix<ValueT,3,3> U;
+
+    /// @brief Singular values, non-negative and descending
+    Vector_<ValueT,3> S;
+
+    /// @brief Right singular vectors, as columns
+    Matrix<ValueT,3,3> V;
+};
+
+namespace detail {
+
+/// @brief Upper limit on Jacobi sweeps.  Quadratic convergence needs 4 or 5 in practice.
+static constexpr int JACOBI_MAX_SWEEPS { 10 };
+
+/**
+ * W symmetric 3x3 matrices in structure-of-arrays form, with their eigenvectors
+ */
+template <typename ValueT,
+          size_t   W>
+struct Eigen_3x3_Lanes
+{
+    /// @brief Symmetric matrix entries, a[r][c][lane] for r <= c
+    ValueT a[3][3][W];
+
+    /// @brief Eigenvectors, v[r][c][lane]
+    ValueT v[3][3][W];
+
+    /**
+     * Apply the Jacobi rotation which zeros a( p, q ) in every lane.  r is the third index.
+     */
+    void rotate( size_t p,
+                 size_t q,
+                 size_t r )
+    {
+        // Entries of the upper triangle, whichever way round the indices fall
+        auto upper = [&]( size_t i, size_t j, size_t lane ) -> ValueT&
+        {
+            return i < j ? a[i][j][lane] : a[j][i][lane];
+        };
+
+        for( size_t lane = 0; lane < W; lane++ )
+        {
+            const ValueT a_pq = a[p][q][lane];
+            const ValueT a_pp = a[p][p][lane];
+            const ValueT a_qq = a[q][q][lane];
+
+            // t = tan of the rotation angle, the smaller root of t^2 + 2 theta t - 1 = 0
+            const ValueT theta = ( a_qq - a_pp ) / ( 2 * a_pq );
+            const ValueT root  = std::sqrt( theta * theta + 1 );
+            ValueT t = ( theta >= 0 ? 1 : -1 ) / ( std::fabs( theta ) + root );
+            t = ( a_pq == 0 || !std::isfinite( t ) ) ? 0 : t;
+            const ValueT c = 1 / std::sqrt( t * t + 1 );
+            const ValueT s = t * c;
+
+            a[p][p][lane] = a_pp - t * a_pq;
+            a[q][q][lane] = a_qq + t * a_pq;
+            a[p][q][lane] = 0;
+
+            ValueT& a_rp = upper( r, p, lane );
+            ValueT& a_rq = upper( r, q, lane );
+            const ValueT rp = a_rp;
+            const ValueT rq = a_rq;
+            a_rp = c * rp - s * rq;
+            a_rq = s * rp + c * rq;
+
+            for( size_t k = 0; k < 3; k++ )
+            {
+                const ValueT v_kp = v[k][p][lane];
+                const ValueT v_kq = v[k][q][lane];
+                v[k][p][lane] = c * v_kp - s * v_kq;
+                v[k][q][lane] = s * v_kp + c * v_kq;
+            }
+        }
+    }
+
+    /**
+     * Diagonalize every lane, leaving eigenvalues on the diagonal of a and
+     * eigenvectors in v, sorted ascending
+     */
+    void solve()
+    {
+        for( size_t lane = 0; lane < W; lane++ )
+        {
+            for( size_t r = 0; r < 3; r++ )
+            {
+                for( size_t c = 0; c < 3; c++ )
+                {
+                    v[r][c][lane] = r == c ? 1 : 0;
+                }
+            }
+        }
+
+        const ValueT tolerance = std::numeric_limits<ValueT>::epsilon() * std::numeric_limits<ValueT>::epsilon();
+        for( int sweep = 0; sweep < JACOBI_MAX_SWEEPS; sweep++ )
+        {
+            // Stop once every lane's off-diagonal is negligible against its diagonal
+            bool converged = true;
+            for( size_t lane = 0; lane < W; lane++ )
+            {
+                const ValueT off  = a[0][1][lane] * a[0][1][lane] +
+                                    a[0][2][lane] * a[0][2][lane] +
+                                    a[1][2][lane] * a[1][2][lane];
+                const ValueT diag = a[0][0][lane] * a[0][0][lane] +
+                                    a[1][1][lane] * a[1][1][lane] +
+                                    a[2][2][lane] * a[2][2][lane];
+                converged = converged && !( off > tolerance * diag );
+            }
+            if( converged )
+            {
+                break;
+            }
+
+            rotate( 0, 1, 2 );
+            rotate( 0, 2, 1 );
+            rotate( 1, 2, 0 );
+        }
+
+        // Sorting network on the eigenvalues, carrying the vectors along
+        const size_t pairs[3][2] = { { 0, 1 }, { 1, 2 }, { 0, 1 } };
+        for( const auto& pair : pairs )
+        {
+            const size_t i = pair[0];
+            const size_t j = pair[1];
+            for( size_t lane = 0; lane < W; lane++ )
+            {
+                const bool swap = a[j][j][lane] < a[i][i][lane];
+                const ValueT lo = swap ? a[j][j][lane] : a[i][i][lane];
+                const ValueT hi = swap ? a[i][i][lane] : a[j][j][lane];
+                a[i][i][lane] = lo;
+                a[j][j][lane] = hi;
+                for( size_t k = 0; k < 3; k++ )
+                {
+                    const ValueT v_i = v[k][i][lane];
+                    const ValueT v_j = v[k][j][lane];
+                    v[k][i][lane] = swap ? v_j : v_i;
+                    v[k][j][lane] = swap ? v_i : v_j;
+                }
+            }
+        }
+    }
+
+    /**
+     * Load lane from a matrix, reading its upper triangle
+     */
+    void load( size_t                    lane,
+               const Matrix<ValueT,3,3>& A )
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = r; c < 3; c++ )
+            {
+                a[r][c][lane] = A( r, c );
+            }
+        }
+    }
+
+    /**
+     * Fill unused lanes with the identity
+     */
+    void load_identity( size_t lane )
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = r; c < 3; c++ )
+            {
+                a[r][c][lane] = r == c ? 1 : 0;
+            }
+        }
+    }
+
+    /**
+     * Store a lane's eigenvalues and eigenvectors
+     */
+    void store( size_t              lane,
+                Vector_<ValueT,3>&  values,
+                Matrix<ValueT,3,3>& vectors ) const
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            values[r] = a[r][r][lane];
+            for( size_t c = 0; c < 3; c++ )
+            {
+                vectors( r, c ) = v[r][c][lane];
+            }
+        }
+    }
+}; // End of Eigen_3x3_Lanes struct
+
+/**
+ * W 3x3 SVDs in structure-of-arrays form, by one-sided Jacobi on A
+ */
+template <typename ValueT,
+          size_t   W>
+struct SVD_3x3_Lanes
+{
+    /// @brief Input matrices, rotated into A V, then U, m[r][c][lane]
+    ValueT m[3][3][W];
+
+    /// @brief Right singular vectors, v[r][c][lane]
+    ValueT v[3][3][W];
+
+    /// @brief Singular values
+    ValueT s[3][W];
+
+    /**
+     * Load a lane
+     */
+    void load( size_t                    lane,
+               const Matrix<ValueT,3,3>& A )
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = 0; c < 3; c++ )
+            {
+                m[r][c][lane] = A( r, c );
+            }
+        }
+    }
+
+    /**
+     * Fill unused lanes with the identity
+     */
+    void load_identity( size_t lane )
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = 0; c < 3; c++ )
+            {
+                m[r][c][lane] = r == c ? 1 : 0;
+            }
+        }
+    }
+
+    /**
+     * Rotate columns p and q of m, and of v, to make them orthogonal in every lane.
+     * Returns false if they already were to working precision in every lane.
+     */
+    bool rotate( size_t p,
+                 size_t q )
+    {
+        bool rotated = false;
+        for( size_t lane = 0; lane < W; lane++ )
+        {
+            ValueT alpha = 0;
+            ValueT beta  = 0;
+            ValueT gamma = 0;
+            for( size_t k = 0; k < 3; k++ )
+            {
+                alpha += m[k][p][lane] * m[k][p][lane];
+                beta  += m[k][q][lane] * m[k][q][lane];
+                gamma += m[k][p][lane] * m[k][q][lane];
+            }
+            const bool orthogonal = !( std::fabs( gamma ) > std::numeric_limits<ValueT>::epsilon() *
+                                                            std::sqrt( alpha ) * std::sqrt( beta ) );
+            rotated = rotated || !orthogonal;
+
+            // t = tan of the rotation angle, the smaller root of t^2 + 2 zeta t - 1 = 0
+            const ValueT zeta = ( beta - alpha ) / ( 2 * gamma );
+            const ValueT root = std::sqrt( zeta * zeta + 1 );
+            ValueT t = ( zeta >= 0 ? 1 : -1 ) / ( std::fabs( zeta ) + root );
+            t = ( orthogonal || !std::isfinite( t ) ) ? 0 : t;
+            const ValueT c = 1 / std::sqrt( t * t + 1 );
+            const ValueT s = t * c;
+
+            for( size_t k = 0; k < 3; k++ )
+            {
+                const ValueT m_kp = m[k][p][lane];
+                const ValueT m_kq = m[k][q][lane];
+                m[k][p][lane] = c * m_kp - s * m_kq;
+                m[k][q][lane] = s * m_kp + c * m_kq;
+
+                const ValueT v_kp = v[k][p][lane];
+                const ValueT v_kq = v[k][q][lane];
+                v[k][p][lane] = c * v_kp - s * v_kq;
+                v[k][q][lane] = s * v_kp + c * v_kq;
+            }
+        }
+        return rotated;
+    }
+
+    /**
+     * Decompose every lane
+     */
+    void solve()
+    {
+        for( size_t lane = 0; lane < W; lane++ )
+        {
+            for( size_t r = 0; r < 3; r++ )
+            {
+                for( size_t c = 0; c < 3; c++ )
+                {
+                    v[r][c][lane] = r == c ? 1 : 0;
+                }
+            }
+        }
+
+        // Orthogonalize the columns of A V, so they are U diag(S)
+        for( int sweep = 0; sweep < JACOBI_MAX_SWEEPS; sweep++ )
+        {
+            const bool rotated_01 = rotate( 0, 1 );
+            const bool rotated_02 = rotate( 0, 2 );
+            const bool rotated_12 = rotate( 1, 2 );
+            if( !rotated_01 && !rotated_02 && !rotated_12 )
+            {
+                break;
+            }
+        }
+
+        // Sorting network on the column norms, descending, carrying V along
+        ValueT norm2[3][W];
+        for( size_t c = 0; c < 3; c++ )
+        {
+            for( size_t lane = 0; lane < W; lane++ )
+            {
+                norm2[c][lane] = m[0][c][lane] * m[0][c][lane] +
+                                 m[1][c][lane] * m[1][c][lane] +
+                                 m[2][c][lane] * m[2][c][lane];
+            }
+        }
+        const size_t pairs[3][2] = { { 0, 1 }, { 1, 2 }, { 0, 1 } };
+        for( const auto& pair : pairs )
+        {
+            const size_t i = pair[0];
+            const size_t j = pair[1];
+            for( size_t lane = 0; lane < W; lane++ )
+            {
+                const bool swap = norm2[i][lane] < norm2[j][lane];
+                const ValueT n_i = norm2[i][lane];
+                const ValueT n_j = norm2[j][lane];
+                norm2[i][lane] = swap ? n_j : n_i;
+                norm2[j][lane] = swap ? n_i : n_j;
+                for( size_t k = 0; k < 3; k++ )
+                {
+                    const ValueT m_i = m[k][i][lane];
+                    const ValueT m_j = m[k][j][lane];
+                    m[k][i][lane] = swap ? m_j : m_i;
+                    m[k][j][lane] = swap ? m_i : m_j;
+
+                    const ValueT v_i = v[k][i][lane];
+                    const ValueT v_j = v[k][j][lane];
+                    v[k][i][lane] = swap ? v_j : v_i;
+                    v[k][j][lane] = swap ? v_i : v_j;
+                }
+            }
+        }
+
+        // Normalize the columns into U.  They are orthogonal already, but Gram-Schmidt
+        // and a cross product keep U orthonormal when A is rank-deficient.
+        const ValueT tiny = std::numeric_limits<ValueT>::min() / std::numeric_limits<ValueT>::epsilon();
+        for( size_t lane = 0; lane < W; lane++ )
+        {
+            ValueT B[3][3];
+            for( size_t r = 0; r < 3; r++ )
+            {
+                for( size_t c = 0; c < 3; c++ )
+                {
+                    B[r][c] = m[r][c][lane];
+                }
+            }
+
+            // u1 = b1 / |b1|, or e_x if A is zero
+            const ValueT n1 = std::sqrt( B[0][0] * B[0][0] + B[1][0] * B[1][0] + B[2][0] * B[2][0] );
+            const bool   ok1 = n1 > tiny;
+            ValueT u1[3] = { ok1 ? B[0][0] / n1 : 1,
+                             ok1 ? B[1][0] / n1 : 0,
+                             ok1 ? B[2][0] / n1 : 0 };
+
+            // u2 = b2 without its u1 part, or any unit vector orthogonal to u1
+            const ValueT d12 = u1[0] * B[0][1] + u1[1] * B[1][1] + u1[2] * B[2][1];
+            ValueT w2[3] = { B[0][1] - d12 * u1[0],
+                             B[1][1] - d12 * u1[1],
+                             B[2][1] - d12 * u1[2] };
+            ValueT n2 = std::sqrt( w2[0] * w2[0] + w2[1] * w2[1] + w2[2] * w2[2] );
+            const bool ok2 = n2 > tiny;
+            const bool use_x = std::fabs( u1[0] ) < ValueT( 0.5 );
+            const ValueT f2[3] = { use_x ? 0 : -u1[2],
+                                   use_x ? u1[2] : 0,
+                                   use_x ? -u1[1] : u1[0] };
+            const ValueT nf = std::sqrt( f2[0] * f2[0] + f2[1] * f2[1] + f2[2] * f2[2] );
+            ValueT u2[3];
+            for( size_t k = 0; k < 3; k++ )
+            {
+                u2[k] = ok2 ? w2[k] / n2 : f2[k] / nf;
+            }
+            n2 = ok2 ? n2 : 0;
+
+            // u3 = u1 x u2, with the sign of the last singular value moved into it
+            ValueT u3[3] = { u1[1] * u2[2] - u1[2] * u2[1],
+                             u1[2] * u2[0] - u1[0] * u2[2],
+                             u1[0] * u2[1] - u1[1] * u2[0] };
+            const ValueT d3 = u3[0] * B[0][2] + u3[1] * B[1][2] + u3[2] * B[2][2];
+            const ValueT sign3 = d3 < 0 ? -1 : 1;
+
+            s[0][lane] = n1;
+            s[1][lane] = n2;
+            s[2][lane] = d3 * sign3;
+            for( size_t k = 0; k < 3; k++ )
+            {
+                m[k][0][lane] = u1[k];
+                m[k][1][lane] = u2[k];
+                m[k][2][lane] = u3[k] * sign3;
+            }
+        }
+    }
+
+    /**
+     * Store a lane's decomposition
+     */
+    void store( size_t              lane,
+                Matrix<ValueT,3,3>& U,
+                Vector_<ValueT,3>&  S,
+                Matrix<ValueT,3,3>& V ) const
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            S[r] = s[r][lane];
+            for( size_t c = 0; c < 3; c++ )
+            {
+                U( r, c ) = m[r][c][lane];
+                V( r, c ) = v[r][c][lane];
+            }
+        }
+    }
+}; // End of SVD_3x3_Lanes struct
+
+} // End of detail namespace
+
+/**
+ * Eigen-decomposition of a symmetric 3x3 matrix.  Only the upper triangle of A is read.
+ */
+template <typename ValueT>
+Symmetric_Eigen_3x3<ValueT> symmetric_eigen_3x3( const Matrix<ValueT,3,3>& A )
+{
+    detail::Eigen_3x3_Lanes<ValueT,1> lanes;
+    lanes.load( 0, A );
+    lanes.solve();
+
+    Symmetric_Eigen_3x3<ValueT> output;
+    lanes.store( 0, output.values, output.vectors );
+    return output;
+}
+
+/**
+ * Singular value decomposition of a 3x3 matrix
+ */
+template <typename ValueT>
+SVD_3x3<ValueT> svd_3x3( const Matrix<ValueT,3,3>& A )
+{
+    detail::SVD_3x3_Lanes<ValueT,1> lanes;
+    lanes.load( 0, A );
+    lanes.solve();
+
+    SVD_3x3<ValueT> output;
+    lanes.store( 0, output.U, output.S, output.V );
+    return output;
+}
+
+/**
+ * Eigen-decompose many symmetric 3x3 matrices, e.g. the covariances of point
+ * neighborhoods.  Matrix i gives values[i] and vectors[i], as symmetric_eigen_3x3().
+ * Throws std::runtime_error if the spans differ in length.
+ */
+template <typename ValueT>
+void symmetric_eigen_3x3_batch( std::span<const Matrix<ValueT,3,3>> A,
+                                std::span<Vector_<ValueT,3>>        values,
+                                std::span<Matrix<ValueT,3,3>>       vectors,
+                                parallel::Thread_Pool&              pool = parallel::Thread_Pool::global() )
+{
+    parallel::check_batch_sizes( "symmetric_eigen_3x3_batch", A.size(), { values.size(), vectors.size() } );
+    parallel::parallel_for_groups<detail::BATCH_LANES>( A.size(), detail::BATCH_GRAIN,
+                                                        [](){ return detail::Eigen_3x3_Lanes<ValueT,detail::BATCH_LANES>(); },
+                                                        [&]( detail::Eigen_3x3_Lanes<ValueT,detail::BATCH_LANES>& lanes,
+                                                             size_t                                                first,
+                                                             size_t                                                used )
+                                                        {
+                                                            for( size_t lane = 0; lane < detail::BATCH_LANES; lane++ )
+                                                            {
+                                                                if( lane < used )
+                                                                {
+                                                                    lanes.load( lane, A[first + lane] );
+                                                                }
+                                                                else
+                                                                {
+                                                                    lanes.load_identity( lane );
+                                                                }
+                                                            }
+                                                            lanes.solve();
+                                                            for( size_t lane = 0; lane < used; lane++ )
+                                                            {
+                                                                lanes.store( lane, values[first + lane], vectors[first + lane] );
+                                                            }
+                                                        },
+                                                        pool );
+}
+
+/**
+ * SVD of many 3x3 matrices, e.g. the cross-covariances of Kabsch alignments.  Matrix i
+ * gives U[i], S[i] and V[i], as svd_3x3().  Throws std::runtime_error if the spans
+ * differ in length.
+ */
+template <typename ValueT>
+void svd_3x3_batch( std::span<const Matrix<ValueT,3,3>> A,
+                    std::span<Matrix<ValueT,3,3>>       U,
+                    std::span<Vector_<ValueT,3>>        S,
+                    std::span<Matrix<ValueT,3,3>>       V,
+                    parallel::Thread_Pool&              pool = parallel::Thread_Pool::global() )
+{
+    parallel::check_batch_sizes( "svd_3x3_batch", A.size(), { U.size(), S.size(), V.size() } );
+    parallel::parallel_for_groups<detail::BATCH_LANES>( A.size(), detail::BATCH_GRAIN,
+                                                        [](){ return detail::SVD_3x3_Lanes<ValueT,detail::BATCH_LANES>(); },
+                                                        [&]( detail::SVD_3x3_Lanes<ValueT,detail::BATCH_LANES>& lanes,
+                                                             size_t                                              first,
+                                                             size_t                                              used )
+                                                        {
+                                                            for( size_t lane = 0; lane < detail::BATCH_LANES; lane++ )
+                                                            {
+                                                                if( lane < used )
+                                                                {
+                                                                    lanes.load( lane, A[first + lane] );
+                                                                }
+                                                                else
+                                                                {
+                                                                    lanes.load_identity( lane );
+                                                                }
+                                                            }
+                                                            lanes.solve();
+                                                            for( size_t lane = 0; lane < used; lane++ )
+                                                            {
+                                                                lanes.store( lane, U[first + lane], S[first + lane], V[first + lane] );
+                                                            }
+                                                        },
+                                                        pool );
+}
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,572 @@
+/**
+ * @file    Krylov_Solvers.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/linalg/Linear_Operator.hpp>
+#include <terminus/math/linalg/Preconditioners.hpp>
+#include <terminus/math/linalg/Reductions.hpp>
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/**
+ * Iterative solvers for A x = b which only need products y = A x, so large systems
+ * are solved without forming or factoring A.
+ *
+ * - conjugate_gradient():  A symmetric positive-definite.  Least work per iteration.
+ * - minres():              A symmetric, possibly indefinite.
+ * - bicgstab():            A general.  Short recurrences, but convergence is not monotone.
+ * - gmres():               A general.  Restarted every Krylov_Options::restart iterations,
+ *                          storing that many vectors.
+ *
+ * The operator is any Linear_Operator or a matrix expression.  The preconditioner
+ * M ~ A must be symmetric positive-definite for conjugate_gradient() and minres().
+ * x holds the initial guess on entry, or is zeroed if its size does not match, and
+ * the solution on exit.  Every solver throws std::runtime_error if A is not square
+ * or does not match b.
+ */
+namespace tmns::math::linalg {
+
+/**
+ * Settings for the Krylov solvers
+ */
+struct Krylov_Options
+{
+    /// @brief Limit on iterations, counting every product with A in the recurrence
+    size_t max_iterations { 1000 };
+
+    /// @brief Stop once |b - A x| <= tolerance * |b|
+    double tolerance { 1e-10 };
+
+    /// @brief Krylov vectors kept by gmres() before it restarts
+    size_t restart { 30 };
+};
+
+/**
+ * Why a Krylov solver stopped
+ */
+enum class Krylov_Status { CONVERGED,       ///< Reached the tolerance
+                           MAX_ITERATIONS,  ///< Ran out of iterations
+                           BREAKDOWN        ///< Recurrence divided by zero, e.g. A or M not definite for CG
+                         };
+
+/**
+ * Outcome of a Krylov solve
+ */
+struct Krylov_Summary
+{
+    /// @brief Why the solver stopped
+    Krylov_Status status { Krylov_Status::MAX_ITERATIONS };
+
+    /// @brief Iterations run
+    size_t iterations { 0 };
+
+    /// @brief |b - A x| / |b|, recomputed from x on exit
+    double residual_norm { 0 };
+
+    /**
+     * Check whether the tolerance was reached
+     */
+    bool converged() const
+    {
+        return status == Krylov_Status::CONVERGED;
+    }
+};
+
+namespace detail {
+
+/**
+ * Check the operator, size the initial guess, and compute r = b - A x.  Returns |b|.
+ */
+template <typename OperatorT>
+double krylov_start( const char*            name,
+                     const OperatorT&       A,
+                     const VectorN<double>& b,
+                     VectorN<double>&       x,
+                     VectorN<double>&       r )
+{
+    check_square_operator( name, A, b );
+    const size_t n = b.size();
+    if( x.size() != n )
+    {
+        x.set_size( n );
+        x.fill( 0 );
+    }
+    r.set_size( n );
+    A.apply( x, r );
+    for( size_t i = 0; i < n; i++ )
+    {
+        r[i] = b[i] - r[i];
+    }
+    return norm_2( b );
+}
+
+/**
+ * Summarize a solve, recomputing the residual from x
+ */
+template <typename OperatorT>
+Krylov_Summary krylov_finish( Krylov_Status          status,
+                              size_t                 iterations,
+                              const OperatorT&       A,
+                              const VectorN<double>& b,
+                              const VectorN<double>& x,
+                              double                 b_norm,
+                              VectorN<double>&       scratch )
+{
+    A.apply( x, scratch );
+    for( size_t i = 0; i < b.size(); i++ )
+    {
+        scratch[i] = b[i] - scratch[i];
+    }
+    Krylov_Summary summary;
+    summary.status        = status;
+    summary.iterations    = iterations;
+    summary.residual_norm = b_norm > 0 ? norm_2( scratch ) / b_norm : 0;
+    return summary;
+}
+
+} // End of detail namespace
+
+/**
+ * Preconditioned conjugate gradients for symmetric positive-definite A.  Reports
+ * BREAKDOWN if a search direction has non-positive curvature.
+ */
+template <Linear_Operator_Source OperatorT,
+          Preconditioner         PreconditionerT = Identity_Preconditioner>
+Krylov_Summary conjugate_gradient( const OperatorT&       op,
+                                   const VectorN<double>& b,
+                                   VectorN<double>&       x,
+                                   const Krylov_Options&  options        = Krylov_Options(),
+                                   const PreconditionerT& preconditioner = PreconditionerT() )
+{
+    auto&& A = detail::as_linear_operator( op );
+    VectorN<double> r;
+    const double b_norm = detail::krylov_start( "conjugate_gradient", A, b, x, r );
+    const size_t n = b.size();
+    const double threshold = options.tolerance * b_norm;
+
+    VectorN<double> z( n ), p( n ), Ap( n );
+    if( norm_2( r ) <= threshold )
+    {
+        return detail::krylov_finish( Krylov_Status::CONVERGED, 0, A, b, x, b_norm, Ap );
+    }
+
+    preconditioner.apply( r, z );
+    p = z;
+    double rz = dot( r, z );
+
+    Krylov_Status status = Krylov_Status::MAX_ITERATIONS;
+    size_t iteration = 0;
+    while( iteration < options.max_iterations )
+    {
+        iteration++;
+        A.apply( p, Ap );
+        const double curvature = dot( p, Ap );
+        if( !( curvature > 0 ) || !( rz > 0 ) )
+        {
+            status = Krylov_Status::BREAKDOWN;
+            break;
+        }
+
+        const double alpha = rz / curvature;
+        for( size_t i = 0; i < n; i++ )
+        {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * Ap[i];
+        }
+        if( norm_2( r ) <= threshold )
+        {
+            status = Krylov_Status::CONVERGED;
+            break;
+        }
+
+        preconditioner.apply( r, z );
+        const double rz_next = dot( r, z );
+        const double beta    = rz_next / rz;
+        rz = rz_next;
+        for( size_t i = 0; i < n; i++ )
+        {
+            p[i] = z[i] + beta * p[i];
+        }
+    }
+    return detail::krylov_finish( status, iteration, A, b, x, b_norm, Ap );
+} // End conjugate_gradient
+
+/**
+ * Preconditioned MINRES (Paige and Saunders) for symmetric, possibly indefinite or
+ * singular, A.  Minimizes the residual in the M^-1 norm over the Krylov space, and
+ * stops when that falls below tolerance times |b| in the same norm, so with a
+ * preconditioner the reported 2-norm residual may differ somewhat.  Reports
+ * BREAKDOWN if M is not positive-definite.
+ */
+template <Linear_Operator_Source OperatorT,
+          Preconditioner         PreconditionerT = Identity_Preconditioner>
+Krylov_Summary minres( const OperatorT&       op,
+                       const VectorN<double>& b,
+                       VectorN<double>&       x,
+                       const Krylov_Options&  options        = Krylov_Options(),
+                       const PreconditionerT& preconditioner = PreconditionerT() )
+{
+    auto&& A = detail::as_linear_operator( op );
+    VectorN<double> r1;
+    const double b_norm = detail::krylov_start( "minres", A, b, x, r1 );
+    const size_t n = b.size();
+
+    VectorN<double> y( n ), r2( n ), v( n ), w( n ), w1( n ), w2( n );
+
+    // |b| in the M^-1 norm, to scale the tolerance
+    preconditioner.apply( b, y );
+    const double b_norm_m = std::sqrt( std::max( dot( b, y ), 0.0 ) );
+
+    preconditioner.apply( r1, y );
+    const double beta1_sq = dot( r1, y );
+    if( beta1_sq < 0 )
+    {
+        return detail::krylov_finish( Krylov_Status::BREAKDOWN, 0, A, b, x, b_norm, v );
+    }
+    const double threshold = options.tolerance * b_norm_m;
+    const double beta1     = std::sqrt( beta1_sq );
+    if( beta1 <= threshold )
+    {
+        return detail::krylov_finish( Krylov_Status::CONVERGED, 0, A, b, x, b_norm, v );
+    }
+    r2 = r1;
+
+    double beta   = beta1;
+    double old_b  = 0;
+    double dbar   = 0;
+    double epsln  = 0;
+    double phibar = beta1;
+    double cs     = -1;
+    double sn     = 0;
+
+    Krylov_Status status = Krylov_Status::MAX_ITERATIONS;
+    size_t iteration = 0;
+    while( iteration < options.max_iterations )
+    {
+        iteration++;
+
+        // Lanczos step, v = y / beta and y = A v - alpha r2 / beta - beta r1 / old_b
+        const double inv_beta = 1.0 / beta;
+        for( size_t i = 0; i < n; i++ )
+        {
+            v[i] = inv_beta * y[i];
+        }
+        A.apply( v, y );
+        if( iteration > 1 )
+        {
+            const double scale = beta / old_b;
+            for( size_t i = 0; i < n; i++ )
+            {
+                y[i] -= scale * r1[i];
+            }
+        }
+        const double alpha = dot( v, y );
+        const double scale = alpha / beta;
+        for( size_t i = 0; i < n; i++ )
+        {
+            y[i] -= scale * r2[i];
+        }
+        std::swap( r1, r2 );
+        r2 = y;
+        preconditioner.apply( r2, y );
+        old_b = beta;
+        const double beta_sq = dot( r2, y );
+        if( beta_sq < 0 )
+        {
+            status = Krylov_Status::BREAKDOWN;
+            break;
+        }
+        beta = std::sqrt( beta_sq );
+
+        // Apply the previous rotation, then build the next to eliminate beta
+        const double old_eps = epsln;
+        const double delta   = cs * dbar + sn * alpha;
+        const double gbar    = sn * dbar - cs * alpha;
+        epsln = sn * beta;
+        dbar  = -cs * beta;
+
+        const double gamma = std::max( std::hypot( gbar, beta ), std::numeric_limits<double>::min() );
+        cs = gbar / gamma;
+        sn = beta / gamma;
+        const double phi = cs * phibar;
+        phibar = sn * phibar;
+
+        // Update the search direction and the solution
+        const double inv_gamma = 1.0 / gamma;
+        std::swap( w1, w2 );
+        std::swap( w2, w );
+        for( size_t i = 0; i < n; i++ )
+        {
+            w[i] = ( v[i] - old_eps * w1[i] - delta * w2[i] ) * inv_gamma;
+            x[i] += phi * w[i];
+        }
+
+        if( phibar <= threshold )
+        {
+            status = Krylov_Status::CONVERGED;
+            break;
+        }
+        if( beta == 0 )
+        {
+            status = Krylov_Status::BREAKDOWN;
+            break;
+        }
+    }
+    return detail::krylov_finish( status, iteration, A, b, x, b_norm, v );
+} // End minres
+
+/**
+ * Preconditioned BiCGSTAB (van der Vorst) for general A.  Each iteration costs two
+ * products with A and two preconditioner applications.  Reports BREAKDOWN if the
+ * shadow residual becomes orthogonal to the residual or the stabilizing step vanishes.
+ */
+template <Linear_Operator_Source OperatorT,
+          Preconditioner         PreconditionerT = Identity_Preconditioner>
+Krylov_Summary bicgstab( const OperatorT&       op,
+                         const VectorN<double>& b,
+                         VectorN<double>&       x,
+                         const Krylov_Options&  options        = Krylov_Options(),
+                         const PreconditionerT& preconditioner = PreconditionerT() )
+{
+    auto&& A = detail::as_linear_operator( op );
+    VectorN<double> r;
+    const double b_norm = detail::krylov_start( "bicgstab", A, b, x, r );
+    const size_t n = b.size();
+    const double threshold = options.tolerance * b_norm;
+
+    VectorN<double> shadow( r ), p( n ), v( n ), p_hat( n ), s( n ), s_hat( n ), t( n );
+    if( norm_2( r ) <= threshold )
+    {
+        return detail::krylov_finish( Krylov_Status::CONVERGED, 0, A, b, x, b_norm, t );
+    }
+
+    double rho   = 1;
+    double alpha = 1;
+    double omega = 1;
+
+    Krylov_Status status = Krylov_Status::MAX_ITERATIONS;
+    size_t iteration = 0;
+    while( iteration < options.max_iterations )
+    {
+        iteration++;
+        const double rho_next = dot( shadow, r );
+        if( rho_next == 0 )
+        {
+            status = Krylov_Status::BREAKDOWN;
+            break;
+        }
+
+        const double beta = ( rho_next / rho ) * ( alpha / omega );
+        rho = rho_next;
+        for( size_t i = 0; i < n; i++ )
+        {
+            p[i] = r[i] + beta * ( p[i] - omega * v[i] );
+        }
+        preconditioner.apply( p, p_hat );
+        A.apply( p_hat, v );
+
+        const double shadow_v = dot( shadow, v );
+        if( shadow_v == 0 )
+        {
+            status = Krylov_Status::BREAKDOWN;
+            break;
+        }
+        alpha = rho / shadow_v;
+        for( size_t i = 0; i < n; i++ )
+        {
+            s[i] = r[i] - alpha * v[i];
+        }
+        if( norm_2( s ) <= threshold )
+        {
+            for( size_t i = 0; i < n; i++ )
+            {
+                x[i] += alpha * p_hat[i];
+            }
+            status = Krylov_Status::CONVERGED;
+            break;
+        }
+
+        preconditioner.apply( s, s_hat );
+        A.apply( s_hat, t );
+        const double tt = dot( t, t );
+        omega = tt > 0 ? dot( t, s ) / tt : 0;
+        for( size_t i = 0; i < n; i++ )
+        {
+            x[i] += alpha * p_hat[i] + omega * s_hat[i];
+            r[i]  = s[i] - omega * t[i];
+        }
+        if( norm_2( r ) <= threshold )
+        {
+            status = Krylov_Status::CONVERGED;
+            break;
+        }
+        if( omega == 0 )
+        {
+            status = Krylov_Status::BREAKDOWN;
+            break;
+        }
+    }
+    return detail::krylov_finish( status, iteration, A, b, x, b_norm, t );
+} // End bicgstab
+
+/**
+ * Restarted GMRES(m) for general A, right preconditioned so the residual it
+ * minimizes is the true one.  Keeps options.restart + 1 Krylov vectors, orthogonalized
+ * by modified Gram-Schmidt, with the Hessenberg least squares problem updated by
+ * Givens rotations.  Reports BREAKDOWN if the Hessenberg matrix is singular.
+ */
+template <Linear_Operator_Source OperatorT,
+          Preconditioner         PreconditionerT = Identity_Preconditioner>
+Krylov_Summary gmres( const OperatorT&       op,
+                      const VectorN<double>& b,
+                      VectorN<double>&       x,
+                      const Krylov_Options&  options        = Krylov_Options(),
+                      const PreconditionerT& preconditioner = PreconditionerT() )
+{
+    auto&& A = detail::as_linear_operator( op );
+    VectorN<double> r;
+    const double b_norm = detail::krylov_start( "gmres", A, b, x, r );
+    const size_t n = b.size();
+    const size_t m = std::max<size_t>( std::min( options.restart, n ), 1 );
+    const double threshold = options.tolerance * b_norm;
+
+    std::vector<VectorN<double>> V( m + 1, VectorN<double>( n ) );
+    MatrixN<double> H( m + 1, m );
+    VectorN<double> g( m + 1 ), cs( m ), sn( m ), y( m ), z( n ), w( n );
+
+    Krylov_Status status = Krylov_Status::MAX_ITERATIONS;
+    size_t iteration = 0;
+    bool first_cycle = true;
+    while( true )
+    {
+        // r = b - A x, except on the first cycle where krylov_start() did it
+        if( !first_cycle )
+        {
+            A.apply( x, r );
+            for( size_t i = 0; i < n; i++ )
+            {
+                r[i] = b[i] - r[i];
+            }
+        }
+        first_cycle = false;
+
+        const double r_norm = norm_2( r );
+        if( r_norm <= threshold )
+        {
+            status = Krylov_Status::CONVERGED;
+            break;
+        }
+        if( iteration >= options.max_iterations )
+        {
+            break;
+        }
+
+        for( size_t i = 0; i < n; i++ )
+        {
+            V[0][i] = r[i] / r_norm;
+        }
+        g.fill( 0 );
+        g[0] = r_norm;
+
+        size_t k = 0;
+        bool singular = false;
+        while( k < m && iteration < options.max_iterations )
+        {
+            iteration++;
+            const size_t j = k++;
+
+            // w = A M^-1 v_j, orthogonalized against the basis
+            preconditioner.apply( V[j], z );
+            A.apply( z, w );
+            for( size_t i = 0; i <= j; i++ )
+            {
+                H( i, j ) = dot( w, V[i] );
+                for( size_t l = 0; l < n; l++ )
+                {
+                    w[l] -= H( i, j ) * V[i][l];
+                }
+            }
+            H( j + 1, j ) = norm_2( w );
+            const bool exhausted = !( H( j + 1, j ) > 0 );
+            if( !exhausted )
+            {
+                const double inv_norm = 1.0 / H( j + 1, j );
+                for( size_t l = 0; l < n; l++ )
+                {
+                    V[j + 1][l] = w[l] * inv_norm;
+                }
+            }
+
+            // Rotate the new column into upper triangular form
+            for( size_t i = 0; i < j; i++ )
+            {
+                const double upper = cs[i] * H( i, j ) + sn[i] * H( i + 1, j );
+                H( i + 1, j ) = -sn[i] * H( i, j ) + cs[i] * H( i + 1, j );
+                H( i, j )     = upper;
+            }
+            const double denom = std::hypot( H( j, j ), H( j + 1, j ) );
+            if( denom == 0 )
+            {
+                singular = true;
+                k = j;
+                break;
+            }
+            cs[j] = H( j, j ) / denom;
+            sn[j] = H( j + 1, j ) / denom;
+            H( j, j )     = denom;
+            H( j + 1, j ) = 0;
+            g[j + 1] = -sn[j] * g[j];
+            g[j]     =  cs[j] * g[j];
+
+            // |g[j+1]| is the residual norm, and is zero once the space is exhausted
+            if( std::fabs( g[j + 1] ) <= threshold || exhausted )
+            {
+                break;
+            }
+        }
+
+        // x += M^-1 V y, with H y = g
+        for( size_t ii = k; ii > 0; ii-- )
+        {
+            const size_t i = ii - 1;
+            double value = g[i];
+            for( size_t l = i + 1; l < k; l++ )
+            {
+                value -= H( i, l ) * y[l];
+            }
+            y[i] = value / H( i, i );
+        }
+        w.fill( 0 );
+        for( size_t i = 0; i < k; i++ )
+        {
+            for( size_t l = 0; l < n; l++ )
+            {
+                w[l] += y[i] * V[i][l];
+            }
+        }
+        preconditioner.apply( w, z );
+        for( size_t l = 0; l < n; l++ )
+        {
+            x[l] += z[l];
+        }
+
+        if( singular )
+        {
+            status = Krylov_Status::BREAKDOWN;
+            break;
+        }
+    }
+    return detail::krylov_finish( status, iteration, A, b, x, b_norm, w );
+} // End gmres
+
+} // End of tmns::math::linalg namespace
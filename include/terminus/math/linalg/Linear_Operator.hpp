@@ -0,0 +1,211 @@
+/**
+ * @file    Linear_Operator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/Matrix_Base.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <concepts>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace tmns::math::linalg {
+
+/**
+ * Anything that can compute y = A x without exposing A.  apply() writes every
+ * element of y, which the caller has already sized to rows().
+ *
+ * optimize::Sparse_Jacobian models this directly, a dense matrix expression is
+ * wrapped by Matrix_Operator, and a lambda by Function_Operator.
+ */
+template <typename OperatorT>
+concept Linear_Operator = requires( const OperatorT&       op,
+                                    const VectorN<double>& x,
+                                    VectorN<double>&       y )
+{
+    { op.rows() } -> std::convertible_to<size_t>;
+    { op.cols() } -> std::convertible_to<size_t>;
+    op.apply( x, y );
+};
+
+/**
+ * Linear operators, or matrix expressions which can be wrapped as one
+ */
+template <typename OperatorT>
+concept Linear_Operator_Source = Linear_Operator<OperatorT> ||
+                                 std::is_base_of_v<Matrix_Base<OperatorT>,OperatorT>;
+
+/**
+ * @class Matrix_Operator
+ *
+ * A dense matrix expression used as a linear operator.  The expression is
+ * referenced, not copied, so it must outlive the operator.
+ */
+template <typename MatrixT>
+class Matrix_Operator
+{
+    public:
+
+        /**
+         * Constructor
+         */
+        explicit Matrix_Operator( const Matrix_Base<MatrixT>& matrix )
+          : m_matrix( matrix.impl() )
+        {}
+
+        /**
+         * Get the number of rows
+         */
+        size_t rows() const
+        {
+            return m_matrix.rows();
+        }
+
+        /**
+         * Get the number of columns
+         */
+        size_t cols() const
+        {
+            return m_matrix.cols();
+        }
+
+        /**
+         * y = A x
+         */
+        void apply( const VectorN<double>& x,
+                    VectorN<double>&       y ) const
+        {
+            const size_t num_rows = rows();
+            const size_t num_cols = cols();
+            for( size_t r = 0; r < num_rows; r++ )
+            {
+                double value = 0;
+                for( size_t c = 0; c < num_cols; c++ )
+                {
+                    value += m_matrix( r, c ) * x[c];
+                }
+                y[r] = value;
+            }
+        }
+
+    private:
+
+        /// @brief Referenced matrix expression
+        const MatrixT& m_matrix;
+
+}; // End of Matrix_Operator class
+
+/**
+ * @class Function_Operator
+ *
+ * A callable func( x, y ) computing y = A x, with the operator's size
+ */
+template <typename FunctionT>
+class Function_Operator
+{
+    public:
+
+        /**
+         * Constructor
+         */
+        Function_Operator( size_t    rows,
+                           size_t    cols,
+                           FunctionT func )
+          : m_rows( rows ),
+            m_cols( cols ),
+            m_func( std::move( func ) )
+        {}
+
+        /**
+         * Get the number of rows
+         */
+        size_t rows() const
+        {
+            return m_rows;
+        }
+
+        /**
+         * Get the number of columns
+         */
+        size_t cols() const
+        {
+            return m_cols;
+        }
+
+        /**
+         * y = A x
+         */
+        void apply( const VectorN<double>& x,
+                    VectorN<double>&       y ) const
+        {
+            m_func( x, y );
+        }
+
+    private:
+
+        /// @brief Number of rows
+        size_t m_rows;
+
+        /// @brief Number of columns
+        size_t m_cols;
+
+        /// @brief Product
+        FunctionT m_func;
+
+}; // End of Function_Operator class
+
+/**
+ * Wrap a callable func( x, y ) computing y = A x as a rows by cols operator
+ */
+template <typename FunctionT>
+Function_Operator<FunctionT> make_linear_operator( size_t    rows,
+                                                   size_t    cols,
+                                                   FunctionT func )
+{
+    return Function_Operator<FunctionT>( rows, cols, std::move( func ) );
+}
+
+namespace detail {
+
+/**
+ * The operator itself, or a Matrix_Operator over a matrix expression
+ */
+template <Linear_Operator_Source OperatorT>
+decltype(auto) as_linear_operator( const OperatorT& op )
+{
+    if constexpr ( Linear_Operator<OperatorT> )
+    {
+        return ( op );
+    }
+    else
+    {
+        return Matrix_Operator<OperatorT>( op );
+    }
+}
+
+/**
+ * Throw std::runtime_error unless the operator is square and matches the right-hand side
+ */
+template <typename OperatorT>
+void check_square_operator( const char*            name,
+                            const OperatorT&       op,
+                            const VectorN<double>& b )
+{
+    if( op.rows() != op.cols() || op.rows() != b.size() )
+    {
+        std::stringstream sout;
+        sout << name << ": operator must be square and match the right-hand side.  Operator: "
+             << op.rows() << " x " << op.cols() << ", Right-hand side: " << b.size();
+        throw std::runtime_error( sout.str() );
+    }
+}
+
+} // End of detail namespace
+} // End of tmns::math::linalg namespace
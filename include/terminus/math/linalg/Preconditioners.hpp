@@ -0,0 +1,423 @@
+/**
+ * @file    Preconditioners.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/Matrix_Base.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace tmns::math::linalg {
+
+/**
+ * Approximate inverse of an operator, z = M^-1 r.  apply() writes every element
+ * of z, which the caller has already sized to match r.
+ */
+template <typename PreconditionerT>
+concept Preconditioner = requires( const PreconditionerT& M,
+                                   const VectorN<double>& r,
+                                   VectorN<double>&       z )
+{
+    M.apply( r, z );
+};
+
+/**
+ * @class Identity_Preconditioner
+ *
+ * No preconditioning, z = r
+ */
+class Identity_Preconditioner
+{
+    public:
+
+        /**
+         * z = r
+         */
+        void apply( const VectorN<double>& r,
+                    VectorN<double>&       z ) const
+        {
+            std::copy( r.begin(), r.end(), z.begin() );
+        }
+
+}; // End of Identity_Preconditioner class
+
+/**
+ * @class Jacobi_Preconditioner
+ *
+ * Diagonal scaling, z_i = r_i / A_ii.  Cheap, and effective when the rows of A
+ * differ widely in scale.  Zero diagonal entries are left unscaled.
+ */
+class Jacobi_Preconditioner
+{
+    public:
+
+        /**
+         * Constructor from the diagonal of A
+         */
+        explicit Jacobi_Preconditioner( const VectorN<double>& diagonal )
+          : m_inverse_diagonal( diagonal.size() )
+        {
+            for( size_t i = 0; i < diagonal.size(); i++ )
+            {
+                m_inverse_diagonal[i] = diagonal[i] != 0 ? 1.0 / diagonal[i] : 1.0;
+            }
+        }
+
+        /**
+         * Constructor from a square matrix expression
+         */
+        template <typename MatrixT>
+        explicit Jacobi_Preconditioner( const Matrix_Base<MatrixT>& matrix )
+          : m_inverse_diagonal( matrix.impl().rows() )
+        {
+            const MatrixT& A = matrix.impl();
+            for( size_t i = 0; i < A.rows(); i++ )
+            {
+                const double value = A( i, i );
+                m_inverse_diagonal[i] = value != 0 ? 1.0 / value : 1.0;
+            }
+        }
+
+        /**
+         * z = D^-1 r
+         */
+        void apply( const VectorN<double>& r,
+                    VectorN<double>&       z ) const
+        {
+            for( size_t i = 0; i < r.size(); i++ )
+            {
+                z[i] = m_inverse_diagonal[i] * r[i];
+            }
+        }
+
+    private:
+
+        /// @brief Reciprocal of the diagonal
+        VectorN<double> m_inverse_diagonal;
+
+}; // End of Jacobi_Preconditioner class
+
+namespace detail {
+
+/// @brief Diagonal shifts Incomplete_Cholesky_Preconditioner tries before giving up
+static constexpr int IC_MAX_SHIFTS = 64;
+
+} // End of detail namespace
+
+/**
+ * @class Incomplete_Cholesky_Preconditioner
+ *
+ * Zero fill-in incomplete Cholesky factorization, IC(0).  L L^T ~ A where L keeps
+ * only the non-zeros of the lower triangle of A, stored by row, so applying it is
+ * two triangular solves costing O(non-zeros).  For symmetric positive-definite A,
+ * given either densely or as the lower triangle in compressed sparse rows (CSR).
+ * Sparse systems should use the latter, as the dense constructor scans all n^2
+ * entries to find the pattern.
+ *
+ * IC(0) can break down on matrices which are not diagonally dominant.  If it does,
+ * it is retried on A + alpha * diag( A ), doubling alpha from 1e-3, up to
+ * detail::IC_MAX_SHIFTS times.  The shift used is reported by shift().
+ */
+class Incomplete_Cholesky_Preconditioner
+{
+    public:
+
+        /**
+         * Factor a symmetric positive-definite matrix expression.  Only the lower
+         * triangle is read, and exact zeros are outside the pattern.  Throws
+         * std::runtime_error if the matrix is not square, has a non-positive diagonal
+         * or a non-finite entry, or cannot be factored with any shift.
+         */
+        template <typename MatrixT>
+        explicit Incomplete_Cholesky_Preconditioner( const Matrix_Base<MatrixT>& matrix )
+        {
+            const MatrixT& A = matrix.impl();
+            const size_t n = A.rows();
+            if( A.cols() != n )
+            {
+                std::stringstream sout;
+                sout << "Incomplete_Cholesky_Preconditioner: matrix must be square.  Rows: "
+                     << A.rows() << ", Cols: " << A.cols();
+                throw std::runtime_error( sout.str() );
+            }
+
+            // Lower triangle pattern by row, diagonal last
+            m_row_offsets.assign( n + 1, 0 );
+            for( size_t r = 0; r < n; r++ )
+            {
+                for( size_t c = 0; c < r; c++ )
+                {
+                    if( A( r, c ) != 0 )
+                    {
+                        append( r, c, A( r, c ) );
+                    }
+                }
+                end_row( r, A( r, r ) );
+            }
+            factor_shifted();
+        }
+
+        /**
+         * Factor a symmetric positive-definite matrix in compressed sparse rows.
+         * Row r holds columns[k] and values[k] for k in [row_offsets[r], row_offsets[r+1]),
+         * with columns ascending.  Entries above the diagonal are ignored, so either
+         * the lower triangle or the full matrix may be given, but every diagonal must
+         * be present.  Throws std::runtime_error as the dense constructor does, or if
+         * the arrays are inconsistent.
+         */
+        Incomplete_Cholesky_Preconditioner( std::span<const size_t> row_offsets,
+                                            std::span<const size_t> columns,
+                                            std::span<const double> values )
+        {
+            if( row_offsets.empty() || row_offsets.front() != 0 ||
+                row_offsets.back() != columns.size() || values.size() != columns.size() )
+            {
+                std::stringstream sout;
+                sout << "Incomplete_Cholesky_Preconditioner: inconsistent CSR arrays.  Offsets: "
+                     << row_offsets.size() << ", Columns: " << columns.size() << ", Values: " << values.size();
+                throw std::runtime_error( sout.str() );
+            }
+
+            const size_t n = row_offsets.size() - 1;
+            m_row_offsets.assign( n + 1, 0 );
+            for( size_t r = 0; r < n; r++ )
+            {
+                const size_t begin = row_offsets[r];
+                const size_t end   = row_offsets[r + 1];
+                if( end < begin || end > columns.size() )
+                {
+                    std::stringstream sout;
+                    sout << "Incomplete_Cholesky_Preconditioner: row " << r << " offsets ["
+                         << begin << ", " << end << ") are out of order";
+                    throw std::runtime_error( sout.str() );
+                }
+
+                bool   has_diagonal = false;
+                double diagonal     = 0;
+                for( size_t k = begin; k < end; k++ )
+                {
+                    if( columns[k] >= n || ( k > begin && columns[k] <= columns[k - 1] ) )
+                    {
+                        std::stringstream sout;
+                        sout << "Incomplete_Cholesky_Preconditioner: row " << r
+                             << " columns must be ascending and below " << n;
+                        throw std::runtime_error( sout.str() );
+                    }
+                    if( columns[k] < r && values[k] != 0 )
+                    {
+                        append( r, columns[k], values[k] );
+                    }
+                    else if( columns[k] == r )
+                    {
+                        has_diagonal = true;
+                        diagonal     = values[k];
+                    }
+                }
+                if( !has_diagonal )
+                {
+                    std::stringstream sout;
+                    sout << "Incomplete_Cholesky_Preconditioner: row " << r << " has no diagonal";
+                    throw std::runtime_error( sout.str() );
+                }
+                end_row( r, diagonal );
+            }
+            factor_shifted();
+        }
+
+        /**
+         * Get the number of rows
+         */
+        size_t rows() const
+        {
+            return m_row_offsets.size() - 1;
+        }
+
+        /**
+         * Get the number of non-zeros in L
+         */
+        size_t non_zeros() const
+        {
+            return m_lower.size();
+        }
+
+        /**
+         * Get the relative diagonal shift needed to factor, zero if none
+         */
+        double shift() const
+        {
+            return m_shift;
+        }
+
+        /**
+         * z = ( L L^T )^-1 r
+         */
+        void apply( const VectorN<double>& r,
+                    VectorN<double>&       z ) const
+        {
+            const size_t n = rows();
+
+            // L y = r
+            for( size_t i = 0; i < n; i++ )
+            {
+                double value = r[i];
+                const size_t last = m_row_offsets[i + 1] - 1;
+                for( size_t k = m_row_offsets[i]; k < last; k++ )
+                {
+                    value -= m_lower[k] * z[m_columns[k]];
+                }
+                z[i] = value / m_lower[last];
+            }
+
+            // L^T z = y, scattering each solved row into the earlier ones
+            for( size_t ii = n; ii > 0; ii-- )
+            {
+                const size_t i    = ii - 1;
+                const size_t last = m_row_offsets[i + 1] - 1;
+                z[i] /= m_lower[last];
+                for( size_t k = m_row_offsets[i]; k < last; k++ )
+                {
+                    z[m_columns[k]] -= m_lower[k] * z[i];
+                }
+            }
+        }
+
+    private:
+
+        /**
+         * Add the entry ( r, c ) below the diagonal to the pattern
+         */
+        void append( size_t r,
+                     size_t c,
+                     double value )
+        {
+            if( !std::isfinite( value ) )
+            {
+                std::stringstream sout;
+                sout << "Incomplete_Cholesky_Preconditioner: entry (" << r << ", " << c
+                     << ") is not finite: " << value;
+                throw std::runtime_error( sout.str() );
+            }
+            m_columns.push_back( c );
+            m_lower.push_back( value );
+        }
+
+        /**
+         * Close row r of the pattern with its diagonal
+         */
+        void end_row( size_t r,
+                      double diagonal )
+        {
+            if( !( diagonal > 0 ) || !std::isfinite( diagonal ) )
+            {
+                std::stringstream sout;
+                sout << "Incomplete_Cholesky_Preconditioner: diagonal " << r
+                     << " is not positive and finite: " << diagonal;
+                throw std::runtime_error( sout.str() );
+            }
+            m_columns.push_back( r );
+            m_lower.push_back( diagonal );
+            m_row_offsets[r + 1] = m_columns.size();
+        }
+
+        /**
+         * Factor the pattern, shifting the diagonal until IC(0) succeeds
+         */
+        void factor_shifted()
+        {
+            const std::vector<double> original = m_lower;
+            double alpha = 1e-3;
+            for( int attempt = 0; !factor(); attempt++ )
+            {
+                if( attempt == detail::IC_MAX_SHIFTS )
+                {
+                    std::stringstream sout;
+                    sout << "Incomplete_Cholesky_Preconditioner: no factorization after "
+                         << detail::IC_MAX_SHIFTS << " diagonal shifts, the last " << m_shift;
+                    throw std::runtime_error( sout.str() );
+                }
+                m_lower = original;
+                for( size_t r = 0; r + 1 < m_row_offsets.size(); r++ )
+                {
+                    m_lower[m_row_offsets[r + 1] - 1] *= 1 + alpha;
+                }
+                m_shift = alpha;
+                alpha *= 2;
+            }
+        }
+
+        /**
+         * Factor m_lower in place over its pattern.  Returns false on a non-positive pivot.
+         */
+        bool factor()
+        {
+            const size_t n = rows();
+            for( size_t i = 0; i < n; i++ )
+            {
+                const size_t begin_i = m_row_offsets[i];
+                const size_t last_i  = m_row_offsets[i + 1] - 1;
+
+                // L_ik = ( A_ik - sum_j L_ij L_kj ) / L_kk over columns common to rows i and k
+                for( size_t p = begin_i; p < last_i; p++ )
+                {
+                    const size_t k      = m_columns[p];
+                    const size_t last_k = m_row_offsets[k + 1] - 1;
+                    double value = m_lower[p];
+                    size_t a = begin_i;
+                    size_t b = m_row_offsets[k];
+                    while( a < p && b < last_k )
+                    {
+                        if( m_columns[a] == m_columns[b] )
+                        {
+                            value -= m_lower[a++] * m_lower[b++];
+                        }
+                        else if( m_columns[a] < m_columns[b] )
+                        {
+                            a++;
+                        }
+                        else
+                        {
+                            b++;
+                        }
+                    }
+                    m_lower[p] = value / m_lower[last_k];
+                }
+
+                double diag = m_lower[last_i];
+                for( size_t p = begin_i; p < last_i; p++ )
+                {
+                    diag -= m_lower[p] * m_lower[p];
+                }
+                if( !( diag > 0 ) || !std::isfinite( diag ) )
+                {
+                    return false;
+                }
+                m_lower[last_i] = std::sqrt( diag );
+            }
+            return true;
+        }
+
+        /// @brief Start of each row in m_columns and m_lower, plus the end
+        std::vector<size_t> m_row_offsets;
+
+        /// @brief Column of each non-zero, ascending within a row
+        std::vector<size_t> m_columns;
+
+        /// @brief Values of L
+        std::vector<double> m_lower;
+
+        /// @brief Relative diagonal shift
+        double m_shift { 0 };
+
+}; // End of Incomplete_Cholesky_Preconditioner class
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,622 @@
+/**
+ * @file    Reductions.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/Matrix.hpp>
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
+#include <terminus/math/types/Fundamental_Types.hpp>
+#include <terminus/math/vector/Vector.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace tmns::math::linalg {
+
+/**
+ * Summation algorithm used by the reductions in this file.
+ *
+ * - FAST:      Multiple independent accumulators.  Vectorizes well, error grows like O(n).
+ * - PAIRWISE:  Recursive pairwise summation over fixed blocks.  Error grows like O(log n).
+ * - KAHAN:     Compensated (Kahan-Babuska/Neumaier) summation.  Error is O(1), but serial within a chunk.
+ *
+ * Every mode is deterministic:  inputs are split into fixed-size chunks whose
+ * boundaries depend only on the input size, and chunk results are merged in
+ * chunk order, so the answer is bit-identical for any number of threads.
+ */
+enum class Summation_Mode
+{
+    FAST     = 0,
+    PAIRWISE = 1,
+    KAHAN    = 2,
+};
+
+namespace detail {
+
+/// @brief Elements per parallel chunk
+static constexpr size_t REDUCTION_GRAIN { 1 << 14 };
+
+/// @brief Number of independent accumulators in the inner loops
+static constexpr size_t REDUCTION_LANES { 8 };
+
+/// @brief Block size at which pairwise summation stops recursing
+static constexpr size_t PAIRWISE_BLOCK { 128 };
+
+/**
+ * Types whose elements are stored contiguously in row-major order and
+ * which expose them through data().
+ */
+template <typename T>
+struct Is_Contiguous_Storage : std::false_type {};
+
+template <typename ValueT, size_t Dims>
+struct Is_Contiguous_Storage<Vector_<ValueT,Dims>> : std::true_type {};
+
+template <typename ValueT, size_t RowsN, size_t ColsN>
+struct Is_Contiguous_Storage<Matrix<ValueT,RowsN,ColsN>> : std::true_type {};
+
+/**
+ * Get a pointer to the first element of a contiguous type
+ */
+template <typename ValueT, size_t Dims>
+const ValueT* contiguous_data( const Vector_<ValueT,Dims>& v )
+{
+    return v.data().data();
+}
+
+template <typename ValueT, size_t RowsN, size_t ColsN>
+const ValueT* contiguous_data( const Matrix<ValueT,RowsN,ColsN>& m )
+{
+    return ( m.rows() * m.cols() > 0 ) ? m.data() : nullptr;
+}
+
+/**
+ * Build a function returning element i of a vector expression
+ */
+template <typename VectorT>
+auto linear_loader( const Vector_Base<VectorT>& v )
+{
+    if constexpr ( Is_Contiguous_Storage<VectorT>::value )
+    {
+        const auto* ptr = contiguous_data( v.impl() );
+        return [ptr]( size_t i ){ return ptr[i]; };
+    }
+    else
+    {
+        const VectorT* expr = &v.impl();
+        return [expr]( size_t i ){ return (*expr)( i ); };
+    }
+}
+
+/**
+ * Build a function returning element i of a matrix expression, in row-major order
+ */
+template <typename MatrixT>
+auto linear_loader( const Matrix_Base<MatrixT>& m )
+{
+    if constexpr ( Is_Contiguous_Storage<MatrixT>::value )
+    {
+        const auto* ptr = contiguous_data( m.impl() );
+        return [ptr]( size_t i ){ return ptr[i]; };
+    }
+    else
+    {
+        const MatrixT* expr = &m.impl();
+        const size_t cols = std::max<size_t>( expr->cols(), 1 );
+        return [expr, cols]( size_t i ){ return (*expr)( i / cols, i % cols ); };
+    }
+}
+
+/**
+ * Fold [begin,end) using REDUCTION_LANES independent accumulators, then
+ * combine the lanes as a balanced tree.  Requires end > begin.
+ */
+template <typename AccumT,
+          typename LoadT,
+          typename CombineT>
+AccumT fold_lanes( size_t          begin,
+                   size_t          end,
+                   const LoadT&    load,
+                   const CombineT& combine,
+                   const AccumT&   identity )
+{
+    std::array<AccumT,REDUCTION_LANES> lanes;
+    lanes.fill( identity );
+
+    size_t i = begin;
+    for( ; i + REDUCTION_LANES <= end; i += REDUCTION_LANES )
+    {
+        for( size_t lane = 0; lane < REDUCTION_LANES; lane++ )
+        {
+            lanes[lane] = combine( lanes[lane], static_cast<AccumT>( load( i + lane ) ) );
+        }
+    }
+    for( size_t lane = 0; i < end; i++, lane++ )
+    {
+        lanes[lane] = combine( lanes[lane], static_cast<AccumT>( load( i ) ) );
+    }
+
+    for( size_t width = REDUCTION_LANES / 2; width > 0; width /= 2 )
+    {
+        for( size_t lane = 0; lane < width; lane++ )
+        {
+            lanes[lane] = combine( lanes[lane], lanes[lane + width] );
+        }
+    }
+    return lanes[0];
+}
+
+/**
+ * Running sum plus the rounding error lost so far
+ */
+template <typename AccumT>
+struct Compensated_Sum
+{
+    /// @brief Running Sum
+    AccumT sum { 0 };
+
+    /// @brief Accumulated Rounding Error
+    AccumT compensation { 0 };
+
+    /**
+     * Add a value (Neumaier's variant of Kahan summation)
+     */
+    void add( AccumT value )
+    {
+        AccumT temp = sum + value;
+        if( std::fabs( sum ) >= std::fabs( value ) )
+        {
+            compensation += ( sum - temp ) + value;
+        }
+        else
+        {
+            compensation += ( value - temp ) + sum;
+        }
+        sum = temp;
+    }
+
+    /**
+     * Merge another partial sum without dropping its compensation
+     */
+    void merge( const Compensated_Sum& other )
+    {
+        add( other.sum );
+        compensation += other.compensation;
+    }
+
+    /**
+     * Get the corrected total
+     */
+    AccumT value() const
+    {
+        return sum + compensation;
+    }
+};
+
+/**
+ * Compensated sum of [begin,end)
+ */
+template <typename AccumT,
+          typename LoadT>
+Compensated_Sum<AccumT> kahan_sum( size_t       begin,
+                                   size_t       end,
+                                   const LoadT& load )
+{
+    Compensated_Sum<AccumT> result;
+    for( size_t i = begin; i < end; i++ )
+    {
+        result.add( static_cast<AccumT>( load( i ) ) );
+    }
+    return result;
+}
+
+/**
+ * Pairwise sum of [begin,end).  Split points are multiples of PAIRWISE_BLOCK
+ * relative to begin, so the tree shape depends only on the range length.
+ */
+template <typename AccumT,
+          typename LoadT>
+AccumT pairwise_sum( size_t       begin,
+                     size_t       end,
+                     const LoadT& load )
+{
+    size_t count = end - begin;
+    if( count <= PAIRWISE_BLOCK )
+    {
+        return fold_lanes<AccumT>( begin, end, load, std::plus<AccumT>(), AccumT( 0 ) );
+    }
+    size_t blocks = ( count + PAIRWISE_BLOCK - 1 ) / PAIRWISE_BLOCK;
+    size_t middle = begin + ( blocks / 2 ) * PAIRWISE_BLOCK;
+    return pairwise_sum<AccumT>( begin, middle, load ) + pairwise_sum<AccumT>( middle, end, load );
+}
+
+/**
+ * Sum of [begin,end) with the requested algorithm
+ */
+template <typename AccumT,
+          typename LoadT>
+AccumT sum_range( size_t         begin,
+                  size_t         end,
+                  const LoadT&   load,
+                  Summation_Mode mode )
+{
+    if( end <= begin )
+    {
+        return AccumT( 0 );
+    }
+    if constexpr ( std::is_floating_point_v<AccumT> )
+    {
+        if( mode == Summation_Mode::PAIRWISE )
+        {
+            return pairwise_sum<AccumT>( begin, end, load );
+        }
+        if( mode == Summation_Mode::KAHAN )
+        {
+            return kahan_sum<AccumT>( begin, end, load ).value();
+        }
+    }
+    return fold_lanes<AccumT>( begin, end, load, std::plus<AccumT>(), AccumT( 0 ) );
+}
+
+/**
+ * Sum load(i) over [0,count), splitting across the pool in REDUCTION_GRAIN
+ * chunks.  Chunk partials are merged with the same algorithm.
+ */
+template <typename AccumT,
+          typename LoadT>
+AccumT parallel_sum( size_t                 count,
+                     const LoadT&           load,
+                     Summation_Mode         mode,
+                     parallel::Thread_Pool& pool )
+{
+    if( count <= REDUCTION_GRAIN )
+    {
+        return sum_range<AccumT>( 0, count, load, mode );
+    }
+
+    // Compensated partials are merged with their error terms intact
+    if constexpr ( std::is_floating_point_v<AccumT> )
+    {
+        if( mode == Summation_Mode::KAHAN )
+        {
+            std::vector<Compensated_Sum<AccumT>> partials( parallel::chunk_count( 0, count, REDUCTION_GRAIN ) );
+            parallel::parallel_for_chunks( 0, count, REDUCTION_GRAIN, [&]( size_t chunk, size_t begin, size_t end )
+            {
+                partials[chunk] = kahan_sum<AccumT>( begin, end, load );
+            }, pool );
+
+            Compensated_Sum<AccumT> result;
+            for( const auto& partial : partials )
+            {
+                result.merge( partial );
+            }
+            return result.value();
+        }
+    }
+
+    std::vector<AccumT> partials( parallel::chunk_count( 0, count, REDUCTION_GRAIN ) );
+    parallel::parallel_for_chunks( 0, count, REDUCTION_GRAIN, [&]( size_t chunk, size_t begin, size_t end )
+    {
+        partials[chunk] = sum_range<AccumT>( begin, end, load, mode );
+    }, pool );
+
+    return sum_range<AccumT>( 0,
+                              partials.size(),
+                              [&]( size_t i ){ return partials[i]; },
+                              mode );
+}
+
+/**
+ * Fold load(i) over [0,count) with an associative, commutative, exact
+ * operation (min/max), splitting across the pool.  Requires count > 0.
+ */
+template <typename AccumT,
+          typename LoadT,
+          typename CombineT>
+AccumT parallel_fold( size_t                 count,
+                      const LoadT&           load,
+                      const CombineT&        combine,
+                      parallel::Thread_Pool& pool )
+{
+    AccumT first = static_cast<AccumT>( load( 0 ) );
+    if( count <= REDUCTION_GRAIN )
+    {
+        return fold_lanes<AccumT>( 0, count, load, combine, first );
+    }
+
+    std::vector<AccumT> partials( parallel::chunk_count( 0, count, REDUCTION_GRAIN ) );
+    parallel::parallel_for_chunks( 0, count, REDUCTION_GRAIN, [&]( size_t chunk, size_t begin, size_t end )
+    {
+        partials[chunk] = fold_lanes<AccumT>( begin, end, load, combine, first );
+    }, pool );
+
+    AccumT result = partials[0];
+    for( const auto& partial : partials )
+    {
+        result = combine( result, partial );
+    }
+    return result;
+}
+
+/**
+ * Throw if asked to take the min/max of an empty input
+ */
+inline void check_not_empty( size_t count, const char* operation )
+{
+    if( count == 0 )
+    {
+        std::stringstream sout;
+        sout << operation << ": Input is empty.";
+        throw std::runtime_error( sout.str() );
+    }
+}
+
+/**
+ * Largest absolute line sum of a matrix expression.  A line is a row
+ * (norm_inf) or a column (norm_1).
+ */
+template <typename LoadT>
+double max_line_sum( size_t                 num_lines,
+                     size_t                 line_length,
+                     const LoadT&           load,
+                     Summation_Mode         mode,
+                     parallel::Thread_Pool& pool )
+{
+    if( num_lines == 0 || line_length == 0 )
+    {
+        return 0;
+    }
+
+    std::vector<double> line_sums( num_lines );
+    size_t grain = std::max<size_t>( 1, REDUCTION_GRAIN / line_length );
+    parallel::parallel_for( 0, num_lines, grain, [&]( size_t begin, size_t end )
+    {
+        for( size_t line = begin; line < end; line++ )
+        {
+            line_sums[line] = sum_range<double>( 0,
+                                                 line_length,
+                                                 [&]( size_t k ){ return std::fabs( load( line, k ) ); },
+                                                 mode );
+        }
+    }, pool );
+    return *std::max_element( line_sums.begin(), line_sums.end() );
+}
+
+} // End of detail namespace
+
+/**
+ * Sum of the elements of a vector expression
+ */
+template <typename VectorT>
+typename Accumulator_Type<typename VectorT::value_type>::type
+    sum( const Vector_Base<VectorT>& v,
+         Summation_Mode              mode = Summation_Mode::FAST,
+         parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    using accum_t = typename Accumulator_Type<typename VectorT::value_type>::type;
+    return detail::parallel_sum<accum_t>( v.impl().size(),
+                                          detail::linear_loader( v ),
+                                          mode,
+                                          pool );
+}
+
+/**
+ * Sum of the elements of a matrix expression
+ */
+template <typename MatrixT>
+typename Accumulator_Type<typename MatrixT::value_type>::type
+    sum( const Matrix_Base<MatrixT>& m,
+         Summation_Mode              mode = Summation_Mode::FAST,
+         parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    using accum_t = typename Accumulator_Type<typename MatrixT::value_type>::type;
+    return detail::parallel_sum<accum_t>( m.impl().rows() * m.impl().cols(),
+                                          detail::linear_loader( m ),
+                                          mode,
+                                          pool );
+}
+
+/**
+ * Dot product of two vector expressions.  Throws if the sizes differ.
+ */
+template <typename Vector1T,
+          typename Vector2T>
+double dot( const Vector_Base<Vector1T>& v1,
+            const Vector_Base<Vector2T>& v2,
+            Summation_Mode               mode = Summation_Mode::FAST,
+            parallel::Thread_Pool&       pool = parallel::Thread_Pool::global() )
+{
+    if( v1.impl().size() != v2.impl().size() )
+    {
+        std::stringstream sout;
+        sout << "dot: Vector sizes must match. v1: " << v1.impl().size() << ", v2: " << v2.impl().size();
+        throw std::runtime_error( sout.str() );
+    }
+    auto load1 = detail::linear_loader( v1 );
+    auto load2 = detail::linear_loader( v2 );
+    return detail::parallel_sum<double>( v1.impl().size(),
+                                         [&]( size_t i ){ return static_cast<double>( load1( i ) ) * load2( i ); },
+                                         mode,
+                                         pool );
+}
+
+/**
+ * Sum of absolute values (L1 norm) of a vector expression
+ */
+template <typename VectorT>
+double norm_1( const Vector_Base<VectorT>& v,
+               Summation_Mode              mode = Summation_Mode::FAST,
+               parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    auto load = detail::linear_loader( v );
+    return detail::parallel_sum<double>( v.impl().size(),
+                                         [&]( size_t i ){ return std::fabs( static_cast<double>( load( i ) ) ); },
+                                         mode,
+                                         pool );
+}
+
+/**
+ * Squared Euclidean (L2) norm of a vector expression
+ */
+template <typename VectorT>
+double norm_2_sqr( const Vector_Base<VectorT>& v,
+                   Summation_Mode              mode = Summation_Mode::FAST,
+                   parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    auto load = detail::linear_loader( v );
+    return detail::parallel_sum<double>( v.impl().size(),
+                                         [&]( size_t i ){ double x = load( i ); return x * x; },
+                                         mode,
+                                         pool );
+}
+
+/**
+ * Euclidean (L2) norm of a vector expression
+ */
+template <typename VectorT>
+double norm_2( const Vector_Base<VectorT>& v,
+               Summation_Mode              mode = Summation_Mode::FAST,
+               parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    return std::sqrt( norm_2_sqr( v, mode, pool ) );
+}
+
+/**
+ * Largest absolute value (L-infinity norm) of a vector expression.  Zero if empty.
+ */
+template <typename VectorT>
+double norm_inf( const Vector_Base<VectorT>& v,
+                 parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    if( v.impl().size() == 0 )
+    {
+        return 0;
+    }
+    auto load = detail::linear_loader( v );
+    return detail::parallel_fold<double>( v.impl().size(),
+                                          [&]( size_t i ){ return std::fabs( static_cast<double>( load( i ) ) ); },
+                                          []( double a, double b ){ return std::max( a, b ); },
+                                          pool );
+}
+
+/**
+ * Smallest element of a vector expression.  Throws if empty.
+ */
+template <typename VectorT>
+typename VectorT::value_type min( const Vector_Base<VectorT>& v,
+                                  parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    using value_t = typename VectorT::value_type;
+    detail::check_not_empty( v.impl().size(), "min" );
+    return detail::parallel_fold<value_t>( v.impl().size(),
+                                           detail::linear_loader( v ),
+                                           []( const value_t& a, const value_t& b ){ return std::min( a, b ); },
+                                           pool );
+}
+
+/**
+ * Largest element of a vector expression.  Throws if empty.
+ */
+template <typename VectorT>
+typename VectorT::value_type max( const Vector_Base<VectorT>& v,
+                                  parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    using value_t = typename VectorT::value_type;
+    detail::check_not_empty( v.impl().size(), "max" );
+    return detail::parallel_fold<value_t>( v.impl().size(),
+                                           detail::linear_loader( v ),
+                                           []( const value_t& a, const value_t& b ){ return std::max( a, b ); },
+                                           pool );
+}
+
+/**
+ * Smallest element of a matrix expression.  Throws if empty.
+ */
+template <typename MatrixT>
+typename MatrixT::value_type min( const Matrix_Base<MatrixT>& m,
+                                  parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    using value_t = typename MatrixT::value_type;
+    size_t count = m.impl().rows() * m.impl().cols();
+    detail::check_not_empty( count, "min" );
+    return detail::parallel_fold<value_t>( count,
+                                           detail::linear_loader( m ),
+                                           []( const value_t& a, const value_t& b ){ return std::min( a, b ); },
+                                           pool );
+}
+
+/**
+ * Largest element of a matrix expression.  Throws if empty.
+ */
+template <typename MatrixT>
+typename MatrixT::value_type max( const Matrix_Base<MatrixT>& m,
+                                  parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    using value_t = typename MatrixT::value_type;
+    size_t count = m.impl().rows() * m.impl().cols();
+    detail::check_not_empty( count, "max" );
+    return detail::parallel_fold<value_t>( count,
+                                           detail::linear_loader( m ),
+                                           []( const value_t& a, const value_t& b ){ return std::max( a, b ); },
+                                           pool );
+}
+
+/**
+ * Frobenius norm of a matrix expression
+ */
+template <typename MatrixT>
+double norm_frobenius( const Matrix_Base<MatrixT>& m,
+                       Summation_Mode              mode = Summation_Mode::FAST,
+                       parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    auto load = detail::linear_loader( m );
+    return std::sqrt( detail::parallel_sum<double>( m.impl().rows() * m.impl().cols(),
+                                                    [&]( size_t i ){ double x = load( i ); return x * x; },
+                                                    mode,
+                                                    pool ) );
+}
+
+/**
+ * Induced 1-norm of a matrix expression (largest absolute column sum)
+ */
+template <typename MatrixT>
+double norm_1( const Matrix_Base<MatrixT>& m,
+               Summation_Mode              mode = Summation_Mode::FAST,
+               parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    const MatrixT& mat = m.impl();
+    return detail::max_line_sum( mat.cols(),
+                                 mat.rows(),
+                                 [&]( size_t col, size_t row ){ return static_cast<double>( mat( row, col ) ); },
+                                 mode,
+                                 pool );
+}
+
+/**
+ * Induced infinity-norm of a matrix expression (largest absolute row sum)
+ */
+template <typename MatrixT>
+double norm_inf( const Matrix_Base<MatrixT>& m,
+                 Summation_Mode              mode = Summation_Mode::FAST,
+                 parallel::Thread_Pool&      pool = parallel::Thread_Pool::global() )
+{
+    const MatrixT& mat = m.impl();
+    return detail::max_line_sum( mat.rows(),
+                                 mat.cols(),
+                                 [&]( size_t row, size_t col ){ return static_cast<double>( mat( row, col ) ); },
+                                 mode,
+                                 pool );
+}
+
+} // End of tmns::math::linalg namespace
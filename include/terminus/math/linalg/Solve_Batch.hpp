@@ -0,0 +1,318 @@
+/**
+ * @file    Solve_Batch.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/Matrix.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
+#include <terminus/math/vector/Vector.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace tmns::math::linalg {
+
+namespace detail {
+
+/// @brief Systems factored side by side.  Each step of the factorization runs over
+///        the lanes in an inner loop on contiguous data, which the compiler vectorizes.
+static constexpr size_t BATCH_LANES { 8 };
+
+/// @brief Lane groups claimed by a thread at a time
+static constexpr size_t BATCH_GRAIN { 64 };
+
+/**
+ * Up to BATCH_LANES systems stored structure-of-arrays, a( r, c )[lane]
+ */
+template <size_t N>
+struct Batch_Lanes
+{
+    double a[N][N][BATCH_LANES];
+    double b[N][BATCH_LANES];
+    bool   ok[BATCH_LANES];
+
+    /**
+     * Gather systems [first, first + count).  Unused lanes get the identity so
+     * they factor cleanly.
+     */
+    void load( std::span<const Matrix<double,N,N>> A,
+               std::span<const Vector_<double,N>>  rhs,
+               size_t                              first,
+               size_t                              count )
+    {
+        for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+        {
+            const bool used = lane < count;
+            for( size_t r = 0; r < N; r++ )
+            {
+                for( size_t c = 0; c < N; c++ )
+                {
+                    a[r][c][lane] = used ? A[first + lane]( r, c ) : ( r == c ? 1.0 : 0.0 );
+                }
+                b[r][lane] = used ? rhs[first + lane][r] : 0.0;
+            }
+            ok[lane] = true;
+        }
+    }
+
+    /**
+     * Scatter solutions and flags for systems [first, first + count)
+     */
+    void store( std::span<Vector_<double,N>> x,
+                std::span<uint8_t>           success,
+                size_t                       first,
+                size_t                       count ) const
+    {
+        for( size_t lane = 0; lane < count; lane++ )
+        {
+            for( size_t r = 0; r < N; r++ )
+            {
+                x[first + lane][r] = ok[lane] ? b[r][lane] : 0.0;
+            }
+            success[first + lane] = ok[lane] ? 1 : 0;
+        }
+    }
+
+    /**
+     * Per lane, the size below which a pivot counts as zero: eps * N times the
+     * largest entry of the lane's matrix
+     */
+    void pivot_tolerance( double tolerance[BATCH_LANES] ) const
+    {
+        for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+        {
+            double scale = 0;
+            for( size_t r = 0; r < N; r++ )
+            {
+                for( size_t c = 0; c < N; c++ )
+                {
+                    scale = std::max( scale, std::fabs( a[r][c][lane] ) );
+                }
+            }
+            tolerance[lane] = std::numeric_limits<double>::epsilon() * N * scale;
+        }
+    }
+
+    /**
+     * Cholesky factorization and solve in every lane.  A lane whose matrix is not
+     * numerically positive-definite, with a squared pivot at or below the tolerance
+     * lu_solve() applies, is flagged and carried on with a unit pivot, so the other
+     * lanes are unaffected.
+     */
+    void cholesky_solve()
+    {
+        double tolerance[BATCH_LANES];
+        pivot_tolerance( tolerance );
+
+        for( size_t j = 0; j < N; j++ )
+        {
+            double inv_diag[BATCH_LANES];
+            for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+            {
+                double diag = a[j][j][lane];
+                for( size_t k = 0; k < j; k++ )
+                {
+                    diag -= a[j][k][lane] * a[j][k][lane];
+                }
+                const bool good = diag > tolerance[lane] && std::isfinite( diag );
+                ok[lane] = ok[lane] && good;
+                diag = good ? std::sqrt( diag ) : 1.0;
+                a[j][j][lane]  = diag;
+                inv_diag[lane] = 1.0 / diag;
+            }
+
+            for( size_t i = j + 1; i < N; i++ )
+            {
+                for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+                {
+                    double value = a[i][j][lane];
+                    for( size_t k = 0; k < j; k++ )
+                    {
+                        value -= a[i][k][lane] * a[j][k][lane];
+                    }
+                    a[i][j][lane] = value * inv_diag[lane];
+                }
+            }
+        }
+
+        // L y = b, then L^T x = y
+        for( size_t i = 0; i < N; i++ )
+        {
+            for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+            {
+                double value = b[i][lane];
+                for( size_t k = 0; k < i; k++ )
+                {
+                    value -= a[i][k][lane] * b[k][lane];
+                }
+                b[i][lane] = value / a[i][i][lane];
+            }
+        }
+        for( size_t ii = N; ii > 0; ii-- )
+        {
+            const size_t i = ii - 1;
+            for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+            {
+                double value = b[i][lane];
+                for( size_t k = i + 1; k < N; k++ )
+                {
+                    value -= a[k][i][lane] * b[k][lane];
+                }
+                b[i][lane] = value / a[i][i][lane];
+            }
+        }
+    }
+
+    /**
+     * LU factorization with partial pivoting and solve in every lane.  Each lane
+     * pivots independently; a lane whose pivot is negligible relative to the
+     * largest entry of its matrix is flagged and carried on with a unit pivot.
+     */
+    void lu_solve()
+    {
+        double tolerance[BATCH_LANES];
+        pivot_tolerance( tolerance );
+
+        for( size_t k = 0; k < N; k++ )
+        {
+            // Pivot rows, chosen per lane, swapped in place
+            for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+            {
+                size_t pivot = k;
+                for( size_t r = k + 1; r < N; r++ )
+                {
+                    if( std::fabs( a[r][k][lane] ) > std::fabs( a[pivot][k][lane] ) )
+                    {
+                        pivot = r;
+                    }
+                }
+                if( pivot != k )
+                {
+                    for( size_t c = 0; c < N; c++ )
+                    {
+                        std::swap( a[k][c][lane], a[pivot][c][lane] );
+                    }
+                    std::swap( b[k][lane], b[pivot][lane] );
+                }
+
+                const bool good = std::fabs( a[k][k][lane] ) > tolerance[lane] &&
+                                  std::isfinite( a[k][k][lane] );
+                ok[lane] = ok[lane] && good;
+                if( !good )
+                {
+                    a[k][k][lane] = 1.0;
+                }
+            }
+
+            // Eliminate below the pivot
+            for( size_t r = k + 1; r < N; r++ )
+            {
+                for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+                {
+                    const double factor = a[r][k][lane] / a[k][k][lane];
+                    for( size_t c = k + 1; c < N; c++ )
+                    {
+                        a[r][c][lane] -= factor * a[k][c][lane];
+                    }
+                    b[r][lane] -= factor * b[k][lane];
+                }
+            }
+        }
+
+        // U x = b
+        for( size_t ii = N; ii > 0; ii-- )
+        {
+            const size_t i = ii - 1;
+            for( size_t lane = 0; lane < BATCH_LANES; lane++ )
+            {
+                double value = b[i][lane];
+                for( size_t c = i + 1; c < N; c++ )
+                {
+                    value -= a[i][c][lane] * b[c][lane];
+                }
+                b[i][lane] = value / a[i][i][lane];
+            }
+        }
+    }
+}; // End of Batch_Lanes struct
+
+/**
+ * Check the spans of a batch solve agree, then solve BATCH_LANES systems at a time
+ */
+template <size_t N,
+          typename SolveT>
+size_t solve_lanes( const char*                         name,
+                    std::span<const Matrix<double,N,N>> A,
+                    std::span<const Vector_<double,N>>  b,
+                    std::span<Vector_<double,N>>        x,
+                    std::span<uint8_t>                  success,
+                    SolveT                              solve,
+                    parallel::Thread_Pool&              pool )
+{
+    parallel::check_batch_sizes( name, A.size(), { b.size(), x.size(), success.size() } );
+    parallel::parallel_for_groups<BATCH_LANES>( A.size(), BATCH_GRAIN,
+                                                [](){ return Batch_Lanes<N>(); },
+                                                [&]( Batch_Lanes<N>& lanes,
+                                                     size_t          first,
+                                                     size_t          used )
+                                                {
+                                                    lanes.load( A, b, first, used );
+                                                    solve( lanes );
+                                                    lanes.store( x, success, first, used );
+                                                },
+                                                pool );
+    return std::count( success.begin(), success.end(), 1 );
+}
+
+} // End of detail namespace
+
+/**
+ * Solve many small symmetric positive-definite systems A[i] x[i] = b[i], such as the
+ * per-point normal equations of a triangulation.  Systems are Cholesky factored
+ * BATCH_LANES at a time in structure-of-arrays form, and groups of them are spread
+ * over the pool.  Nothing is allocated per system.
+ *
+ * success[i] is set to 1 if system i was solved and 0 if A[i] was not numerically
+ * positive-definite, in which case x[i] is zero.  Returns the number solved.  Throws
+ * std::runtime_error if the spans differ in length.  Intended for N of 2 to 6.
+ */
+template <size_t N>
+size_t solve_symmetric_batch( std::span<const Matrix<double,N,N>> A,
+                              std::span<const Vector_<double,N>>  b,
+                              std::span<Vector_<double,N>>        x,
+                              std::span<uint8_t>                  success,
+                              parallel::Thread_Pool&              pool = parallel::Thread_Pool::global() )
+{
+    return detail::solve_lanes<N>( "solve_symmetric_batch", A, b, x, success,
+                                   []( detail::Batch_Lanes<N>& lanes ){ lanes.cholesky_solve(); },
+                                   pool );
+}
+
+/**
+ * Solve many small general systems A[i] x[i] = b[i] by LU factorization with partial
+ * pivoting, BATCH_LANES at a time in structure-of-arrays form.
+ *
+ * success[i] is set to 1 if system i was solved and 0 if A[i] was singular to working
+ * precision, in which case x[i] is zero.  Returns the number solved.  Throws
+ * std::runtime_error if the spans differ in length.  Intended for N of 2 to 6.
+ */
+template <size_t N>
+size_t solve_batch( std::span<const Matrix<double,N,N>> A,
+                    std::span<const Vector_<double,N>>  b,
+                    std::span<Vector_<double,N>>        x,
+                    std::span<uint8_t>                  success,
+                    parallel::Thread_Pool&              pool = parallel::Thread_Pool::global() )
+{
+    return detail::solve_lanes<N>( "solve_batch", A, b, x, success,
+                                   []( detail::Batch_Lanes<N>& lanes ){ lanes.lu_solve(); },
+                                   pool );
+}
+
+} // End of tmns::math::linalg namespace
@@ -7,15 +7,199 @@
 
 // Terminus Libraries
 #include <terminus/core/error/ErrorCategory.hpp>
+#include <terminus/math/linalg/Cholesky.hpp>
+#include <terminus/math/matrix/Matrix.hpp>
 #include <terminus/math/matrix/MatrixN.hpp>
 #include <terminus/math/types/Type_Deduction.hpp>
+#include <terminus/math/vector/Vector.hpp>
 #include <terminus/math/vector/VectorN.hpp>
 
+// C++ Libraries
+#include <array>
+#include <cstddef>
+
 namespace tmns::math::linalg {
 
+namespace detail {
+
+/**
+ * Which factorization factor_symmetric() produced
+ */
+enum class Symmetric_Factor { NONE,     ///< A is singular
+                              CHOLESKY, ///< L L^T, see cholesky_decompose()
+                              LDLT      ///< Pivoted L D L^T, see ldlt_decompose()
+                            };
+
+/**
+ * Factor symmetric A with Cholesky, falling back to pivoted LDL^T if A is not
+ * positive-definite.  The factor is built in work, which must hold a copy of A on
+ * entry, and the LDL^T interchanges in pivots, which must hold n entries.
+ * Allocates nothing.
+ */
+template <typename MatrixT,
+          typename PivotsT>
+Symmetric_Factor factor_symmetric( const MatrixT& A,
+                                   MatrixT&       work,
+                                   PivotsT&       pivots )
+{
+    if( cholesky_decompose( work ) )
+    {
+        return Symmetric_Factor::CHOLESKY;
+    }
+
+    // Cholesky only touches the lower triangle, so that is all there is to restore
+    for( size_t r = 0; r < A.rows(); r++ )
+    {
+        for( size_t c = 0; c <= r; c++ )
+        {
+            work( r, c ) = A( r, c );
+        }
+    }
+    if( ldlt_decompose( work, pivots ) )
+    {
+        return Symmetric_Factor::LDLT;
+    }
+    return Symmetric_Factor::NONE;
+}
+
+/**
+ * Solve with a factor from factor_symmetric(), overwriting b with x
+ */
+template <typename MatrixT,
+          typename PivotsT,
+          typename VectorT>
+void solve_factored( Symmetric_Factor kind,
+                     const MatrixT&   work,
+                     const PivotsT&   pivots,
+                     VectorT&         b )
+{
+    if( kind == Symmetric_Factor::CHOLESKY )
+    {
+        cholesky_solve( work, b );
+    }
+    else
+    {
+        ldlt_solve( work, pivots, b );
+    }
+}
+
+/**
+ * Solve A x = b for symmetric A using a Cholesky factorization, falling back to
+ * pivoted LDL^T if A is not positive-definite.  The factor is built in work, which
+ * must hold a copy of A on entry, pivots must hold n entries, and b is overwritten
+ * with x.  Allocates nothing.
+ *
+ * @return False if A is singular to working precision
+ */
+template <typename MatrixT,
+          typename PivotsT,
+          typename VectorT>
+bool solve_symmetric_in_place( const MatrixT& A,
+                               MatrixT&       work,
+                               PivotsT&       pivots,
+                               VectorT&       b )
+{
+    const auto kind = factor_symmetric( A, work, pivots );
+    if( kind == Symmetric_Factor::NONE )
+    {
+        return false;
+    }
+    solve_factored( kind, work, pivots, b );
+    return true;
+}
+
+/**
+ * As solve_symmetric_in_place(), for each column of B, factoring A once.  column
+ * is scratch of A's size.
+ */
+template <typename MatrixT,
+          typename PivotsT,
+          typename RhsT,
+          typename VectorT>
+bool solve_symmetric_columns_in_place( const MatrixT& A,
+                                       MatrixT&       work,
+                                       PivotsT&       pivots,
+                                       RhsT&          B,
+                                       VectorT&       column )
+{
+    const auto kind = factor_symmetric( A, work, pivots );
+    if( kind == Symmetric_Factor::NONE )
+    {
+        return false;
+    }
+    for( size_t c = 0; c < B.cols(); c++ )
+    {
+        for( size_t r = 0; r < B.rows(); r++ )
+        {
+            column[r] = B( r, c );
+        }
+        solve_factored( kind, work, pivots, column );
+        for( size_t r = 0; r < B.rows(); r++ )
+        {
+            B( r, c ) = column[r];
+        }
+    }
+    return true;
+}
+
+} // End of detail namespace
+
+/**
+ * Solve the equation Ax=b where A is a symmetric matrix, normally positive definite.
+ *
+ * A Cholesky (LL^T) factorization is used, falling back to LDL^T with Bunch-Kaufman
+ * pivoting when A is not positive-definite, so indefinite systems with zero or tiny
+ * diagonal entries are still solved.  Only the lower triangle of A is read.  Returns an error if
+ * A is not square, does not match b, or is singular.
+ */
 ImageResult<VectorN<double>> solve_symmetric( const MatrixN<double>& A,
                                               const VectorN<double>& b );
 
+/**
+ * Fixed-size version of solve_symmetric().  Everything stays on the stack.
+ */
+template <size_t N>
+ImageResult<Vector_<double,N>> solve_symmetric( const Matrix<double,N,N>& A,
+                                                const Vector_<double,N>&  b )
+{
+    Matrix<double,N,N> work = A;
+    Vector_<double,N> x = b;
+    std::array<std::ptrdiff_t,N> pivots;
+    if( !detail::solve_symmetric_in_place( A, work, pivots, x ) )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "solve_symmetric: matrix is singular" );
+    }
+    return outcome::ok<Vector_<double,N>>( x );
+}
+
+/**
+ * Solve AX=B for each column of B, with symmetric A factored once.  Returns an error
+ * if A is not square, does not match B, or is singular.
+ */
+ImageResult<MatrixN<double>> solve_symmetric( const MatrixN<double>& A,
+                                              const MatrixN<double>& B );
+
+/**
+ * Fixed-size version of the multiple right-hand side solve_symmetric()
+ */
+template <size_t N,
+          size_t K>
+ImageResult<Matrix<double,N,K>> solve_symmetric( const Matrix<double,N,N>& A,
+                                                 const Matrix<double,N,K>& B )
+{
+    Matrix<double,N,N> work = A;
+    Matrix<double,N,K> X = B;
+    Vector_<double,N> column;
+    std::array<std::ptrdiff_t,N> pivots;
+    if( !detail::solve_symmetric_columns_in_place( A, work, pivots, X, column ) )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "solve_symmetric: matrix is singular" );
+    }
+    return outcome::ok<Matrix<double,N,K>>( X );
+}
+
 /**
  * Solve the equation Ax=b where A is a symmetric positive definite matrix.  This version of
  * this method will not modify A and b. The result (x) is returned as the return value.
@@ -29,24 +213,71 @@ ImageResult<VectorN<typename Promote_Type<typename AMatrixT::value_type,
 {
     using real_type = typename Promote_Type<typename AMatrixT::value_type,
                                             typename BVectorT::value_type>::type;
-    MatrixN<real_type> Abuf = A;
-    VectorN<real_type> result = B;
-    
-    return solve_symmetric( A, B );
+    MatrixN<double> Abuf = A;
+    VectorN<double> Bbuf = B;
+
+    auto result = solve_symmetric( Abuf, Bbuf );
+    if( result.has_error() )
+    {
+        return result.error();
+    }
+    return outcome::ok<VectorN<real_type>>( VectorN<real_type>( result.value() ) );
 }
 
 /**
- * x = solve(A,b) - Computes the solution to a real system of linear equations:
- * 
- * A*x=b
- * 
- * Based on the LAPACK GESV routines, this solution is computed using LU decomposition and
- * back/forward substitution.
- * 
- * Computes the minimum-norm solution to a real linear least squares problem.
+ * Conditioning of a solve() by singular value decomposition
+ */
+struct SVD_Solve_Info
+{
+    /// @brief Number of singular values above the threshold, i.e. the numerical rank
+    size_t rank { 0 };
+
+    /// @brief Largest over smallest singular value of A.  Infinite if A is rank deficient.
+    double condition { 0 };
+};
+
+/// @brief Smallest dimension of A at which solve() switches from the Jacobi SVD to the
+///        divide-and-conquer one, which is faster on large matrices
+static constexpr size_t SVD_BDC_MIN_SIZE = 32;
+
+/**
+ * x = solve(A,b) - Computes the minimum-norm solution to a real linear least squares
+ * problem:
+ *
+ * min | A*x - b |
+ *
+ * by singular value decomposition A = U S V^T.  Singular values at or below eps are
+ * treated as zero, giving the truncated solution x = V S^+ U^T b.  This is applied
+ * right to left, so the pseudo-inverse is never formed.
+ *
+ * Fails with INVALID_INPUT if A and b do not match.
+ */
+ImageResult<VectorN<double>> solve( const MatrixN<double>& mat_A,
+                                    const VectorN<double>& vec_b,
+                                    double                 eps = 0.00000001 );
+
+/**
+ * As above, also reporting the rank and condition number of A
  */
 ImageResult<VectorN<double>> solve( const MatrixN<double>& mat_A,
                                     const VectorN<double>& vec_b,
+                                    SVD_Solve_Info&        info,
+                                    double                 eps = 0.00000001 );
+
+/**
+ * X = solve(A,B) - Least squares solve for each column of B, sharing one
+ * decomposition of A
+ */
+ImageResult<MatrixN<double>> solve( const MatrixN<double>& mat_A,
+                                    const MatrixN<double>& mat_B,
+                                    double                 eps = 0.00000001 );
+
+/**
+ * As above, also reporting the rank and condition number of A
+ */
+ImageResult<MatrixN<double>> solve( const MatrixN<double>& mat_A,
+                                    const MatrixN<double>& mat_B,
+                                    SVD_Solve_Info&        info,
                                     double                 eps = 0.00000001 );
 
 } // End of tmns::math::linalg
\ No newline at end of file
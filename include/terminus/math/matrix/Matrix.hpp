@@ -250,17 +250,9 @@ class Matrix : public Matrix_Base<Matrix<ElementT,RowsN,ColsN> >
         value_type& operator()( size_t row,
                                 size_t col )
         {
-            if( row >= RowsN )
+            if( row >= RowsN || col >= ColsN ) [[unlikely]]
             {
-                std::stringstream sout;
-                sout << "Row: " << row << " > RowsN: " << RowsN;
-                throw std::runtime_error( sout.str() );
-            }
-            if( col >= ColsN )
-            {
-                std::stringstream sout;
-                sout << "Col: " << col << " > ColsN: " << ColsN;
-                throw std::runtime_error( sout.str() );
+                throw_out_of_range( row, col );
             }
             return m_data[ row * ColsN + col ];
         }
@@ -271,17 +263,9 @@ class Matrix : public Matrix_Base<Matrix<ElementT,RowsN,ColsN> >
         value_type const& operator()( size_t row,
                                       size_t col ) const
         {
-            if( row >= RowsN )
+            if( row >= RowsN || col >= ColsN ) [[unlikely]]
             {
-                std::stringstream sout;
-                sout << "Row: " << row << " > RowsN: " << RowsN;
-                throw std::runtime_error( sout.str() );
-            }
-            if( col >= ColsN )
-            {
-                std::stringstream sout;
-                sout << "Col: " << col << " > ColsN: " << ColsN;
-                throw std::runtime_error( sout.str() );
+                throw_out_of_range( row, col );
             }
             return m_data[ row * ColsN + col ];
         }
@@ -568,6 +552,25 @@ class Matrix : public Matrix_Base<Matrix<ElementT,RowsN,ColsN> >
 
     private:
 
+        /**
+         * Report an out-of-range element access.  Kept out of line so the
+         * checks in operator() stay cheap enough to inline.
+         */
+        [[noreturn]] static void throw_out_of_range( size_t row,
+                                                     size_t col )
+        {
+            std::stringstream sout;
+            if( row >= RowsN )
+            {
+                sout << "Row: " << row << " > RowsN: " << RowsN;
+            }
+            else
+            {
+                sout << "Col: " << col << " > ColsN: " << ColsN;
+            }
+            throw std::runtime_error( sout.str() );
+        }
+
         /// Array Information
         array_type m_data;
 
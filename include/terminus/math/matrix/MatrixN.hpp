@@ -6,6 +6,7 @@
 #pragma once
 
 // Terminus Libraries
+#include "../types/Small_Buffer_Array.hpp"
 #include "Matrix.hpp"
 #include "Sub_Matrix.hpp"
 
@@ -13,6 +14,9 @@ namespace tmns::math {
 
 /**
  * Dynamicall allocated, arbitrary-dimension matrix class.
+ *
+ * Elements are stored inline up to Matrix_Inline_Capacity<ElementT>::value, after
+ * which they spill to the heap.
  */
 template <typename ElementT>
 class Matrix<ElementT,0,0> : public Matrix_Base<Matrix<ElementT> >
@@ -20,7 +24,7 @@ class Matrix<ElementT,0,0> : public Matrix_Base<Matrix<ElementT> >
     public:
 
         /// @brief  Array Type
-        using array_type = std::vector<ElementT>;
+        using array_type = Small_Buffer_Array<ElementT,Matrix_Inline_Capacity<ElementT>::value>;
     
         /// @brief Underlying Element / Value Type
         using value_type = ElementT;
@@ -47,13 +51,10 @@ class Matrix<ElementT,0,0> : public Matrix_Base<Matrix<ElementT> >
          */
         Matrix( size_t rows,
                 size_t cols )
-            : m_rows( rows ),
-              m_cols( cols ),
-              m_data( rows * cols )
+            : m_data( rows * cols, 0 ),
+              m_rows( rows ),
+              m_cols( cols )
         {
-            std::fill( m_data.begin(),
-                       m_data.end(),
-                       0 );
         }
 
         /**
@@ -97,6 +98,16 @@ class Matrix<ElementT,0,0> : public Matrix_Base<Matrix<ElementT> >
              m_cols( mat.m_cols )
         {
         }
+
+        /**
+         * Move Constructor
+         */
+        Matrix( Matrix&& mat ) noexcept
+            : m_data( std::move( mat.m_data ) ),
+              m_rows( mat.m_rows ),
+              m_cols( mat.m_cols )
+        {
+        }
         
         /**
          * Generalized copy constructor for any base type
@@ -115,11 +126,20 @@ class Matrix<ElementT,0,0> : public Matrix_Base<Matrix<ElementT> >
          */
         Matrix& operator = ( const Matrix& mat )
         {
-            // Make a copy of the data
-            Matrix temp( mat );
-            m_rows = temp.m_rows;
-            m_cols = temp.m_cols;
-            m_data = temp.m_data;
+            m_rows = mat.m_rows;
+            m_cols = mat.m_cols;
+            m_data = mat.m_data;
+            return (*this);
+        }
+
+        /**
+         * Move assignment operator
+         */
+        Matrix& operator = ( Matrix&& mat ) noexcept
+        {
+            m_rows = mat.m_rows;
+            m_cols = mat.m_cols;
+            m_data = std::move( mat.m_data );
             return (*this);
         }
 
@@ -129,11 +149,11 @@ class Matrix<ElementT,0,0> : public Matrix_Base<Matrix<ElementT> >
         template <typename OtherMatrixT>
         Matrix& operator = ( const Matrix_Base<OtherMatrixT>& mat )
         {
-            // Make a copy of the data
+            // Make a copy of the data, as the expression may reference this matrix
             Matrix temp( mat );
             m_rows = temp.m_rows;
             m_cols = temp.m_cols;
-            m_data = temp.m_data;
+            m_data = std::move( temp.m_data );
             return (*this);
         }
 
@@ -202,7 +222,7 @@ class Matrix<ElementT,0,0> : public Matrix_Base<Matrix<ElementT> >
             }
             else
             {
-                m_data.resize( rows * cols, false );
+                m_data.resize( rows * cols, 0 );
             }
             m_rows = rows;
             m_cols = cols;
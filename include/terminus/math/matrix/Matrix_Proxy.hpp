@@ -6,8 +6,23 @@
 #pragma once
 
 // Terminus Libraries
+#include "../types/Strided_View.hpp"
+#include "Indexing_Matrix_Iterator.hpp"
 #include "Matrix_Base.hpp"
 
+// C++ Libraries
+#include <array>
+#include <cstddef>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <version>
+
+#if defined( __cpp_lib_mdspan )
+#include <mdspan>
+#endif
+
 namespace tmns::math {
 
 /**
@@ -46,6 +61,13 @@ class Matrix_Proxy : public Matrix_Base<Matrix_Proxy<ElementT,RowsN,ColsN> >
             : m_ptr(ptr) 
         {}
 
+        /**
+         * Constructor given a packed row-major span of exactly RowsN x ColsN elements
+         */
+        Matrix_Proxy( std::span<ElementT,RowsN*ColsN> buffer )
+            : m_ptr( buffer.data() )
+        {}
+
         /**
          * Copy Assignment Operator
          */
@@ -56,7 +78,7 @@ class Matrix_Proxy : public Matrix_Base<Matrix_Proxy<ElementT,RowsN,ColsN> >
             {
                 std::stringstream sout;
                 sout << "Matrices are not the same size. This (" << RowsN << " x " 
-                     << ColsN << ") vs (" << m.rows << " x " << m.cols << ")";
+                     << ColsN << ") vs (" << m.rows() << " x " << m.cols() << ")";
                 throw std::runtime_error( sout.str() );
             }
             Matrix<ElementT,RowsN,ColsN> tmp( m );
@@ -198,6 +220,14 @@ class Matrix_Proxy : public Matrix_Base<Matrix_Proxy<ElementT,RowsN,ColsN> >
             return m_ptr + rows() * cols();
         }
 
+        /**
+         * Get the elements as a span
+         */
+        std::span<ElementT,RowsN*ColsN> to_span() const
+        {
+            return std::span<ElementT,RowsN*ColsN>( m_ptr, RowsN * ColsN );
+        }
+
         /**
          * Get name
          */
@@ -232,11 +262,15 @@ struct Matrix_Cols<Matrix_Proxy<ElementT,RowsN,ColsN> >
 
 /**
  * @class MatrixProxy<ElementT>
- * 
+ *
  * A arbitrary-dimension matrix proxy class, treating an arbitrary
- * block of memory as a Matrix in packed row-major format.
- * 
- * An arbitrary-dimension matrix proxy class.
+ * block of memory as a Matrix.
+ *
+ * Elements are addressed as ptr[ row * row_stride + col * col_stride ], with
+ * strides counted in elements.  The defaults describe packed row-major data.
+ * Column-major (layout_left) buffers, NumPy-style strided arrays, GDAL RasterIO
+ * buffers with custom pixel/line spacing and sub-windows of any of these can
+ * all be viewed in place.  Byte strides must be divided by sizeof(ElementT).
  */
 template <typename ElementT>
 class Matrix_Proxy<ElementT,0,0> : public Matrix_Base<Matrix_Proxy<ElementT>>
@@ -248,43 +282,126 @@ class Matrix_Proxy<ElementT,0,0> : public Matrix_Base<Matrix_Proxy<ElementT>>
 
         /// @brief Reference Type
         using reference_type = ElementT&;
-        
+
         /// @brief Const Reference Type
         using const_reference_type = const ElementT&;
-        
+
         /// @brief Iterator Type
-        using iter_t = ElementT*;
+        using iter_t = Indexing_Matrix_Iterator<Matrix_Proxy>;
 
         /// @brief Const Iterator Type
-        using const_iter_t = const ElementT*;
+        using const_iter_t = Indexing_Matrix_Iterator<const Matrix_Proxy>;
 
         /**
-         * Constructs a matrix with zero size.
+         * Constructs a proxy over packed row-major data.
          */
         Matrix_Proxy( ElementT* ptr,
                       size_t    rows,
                       size_t    cols )
             : m_ptr(ptr),
               m_rows(rows),
-              m_cols(cols)
+              m_cols(cols),
+              m_row_stride( static_cast<std::ptrdiff_t>( cols ) ),
+              m_col_stride( 1 )
         {}
 
         /**
-         * Construct a matrix with another container
+         * Constructs a proxy over strided data.  Strides are in elements and
+         * may be negative (e.g. a vertically flipped raster).
          */
-        template <typename ValueT>
-        Matrix_Proxy( const Matrix_Base<ValueT>& matrix )
-            : m_ptr(matrix.data()),
-              m_rows(matrix.rows()),
-              m_cols(matrix.cols())
+        Matrix_Proxy( ElementT*      ptr,
+                      size_t         rows,
+                      size_t         cols,
+                      std::ptrdiff_t row_stride,
+                      std::ptrdiff_t col_stride )
+            : m_ptr(ptr),
+              m_rows(rows),
+              m_cols(cols),
+              m_row_stride( row_stride ),
+              m_col_stride( col_stride )
         {}
 
+        /**
+         * Constructs a proxy over packed row-major data held in a span.
+         * Throws if the span is too small.
+         */
+        Matrix_Proxy( std::span<ElementT> buffer,
+                      size_t              rows,
+                      size_t              cols )
+            : Matrix_Proxy( buffer, rows, cols, cols, 1 )
+        {}
+
+        /**
+         * Constructs a proxy over strided data held in a span.  Throws if
+         * any element would fall outside the span.
+         */
+        Matrix_Proxy( std::span<ElementT> buffer,
+                      size_t              rows,
+                      size_t              cols,
+                      size_t              row_stride,
+                      size_t              col_stride )
+            : Matrix_Proxy( buffer.data(),
+                            rows,
+                            cols,
+                            static_cast<std::ptrdiff_t>( row_stride ),
+                            static_cast<std::ptrdiff_t>( col_stride ) )
+        {
+            if( rows > 0 && cols > 0 &&
+                ( rows - 1 ) * row_stride + ( cols - 1 ) * col_stride >= buffer.size() )
+            {
+                std::stringstream sout;
+                sout << "Matrix_Proxy: " << rows << " x " << cols << " view with strides ("
+                     << row_stride << ", " << col_stride << ") exceeds buffer of "
+                     << buffer.size() << " elements.";
+                throw std::runtime_error( sout.str() );
+            }
+        }
+
+        /**
+         * Constructs a proxy over a rank-2 strided view, e.g. a std::mdspan with
+         * layout_right, layout_left or layout_stride.
+         */
+        template <Strided_View<2> ViewT>
+        Matrix_Proxy( const ViewT& view )
+            requires ( std::is_convertible_v<decltype( view.data_handle() ),ElementT*> )
+            : Matrix_Proxy( view.data_handle(),
+                            view.extent( 0 ),
+                            view.extent( 1 ),
+                            static_cast<std::ptrdiff_t>( view.stride( 0 ) ),
+                            static_cast<std::ptrdiff_t>( view.stride( 1 ) ) )
+        {}
+
+        /**
+         * Construct a proxy over a densely-packed matrix
+         */
+        template <typename MatrixT>
+        Matrix_Proxy( Matrix_Base<MatrixT>& matrix )
+            : Matrix_Proxy( matrix.impl().data(),
+                            matrix.impl().rows(),
+                            matrix.impl().cols() )
+        {}
+
+        /**
+         * Construct a read-only proxy over a densely-packed matrix
+         */
+        template <typename MatrixT>
+        Matrix_Proxy( const Matrix_Base<MatrixT>& matrix ) requires ( std::is_const_v<ElementT> )
+            : Matrix_Proxy( matrix.impl().data(),
+                            matrix.impl().rows(),
+                            matrix.impl().cols() )
+        {}
+
+        /**
+         * Copy Constructor.  Shallow.
+         */
+        Matrix_Proxy( const Matrix_Proxy& ) = default;
+
         /**
          * Standard copy assignment operator.
          */
         Matrix_Proxy& operator = ( const Matrix_Proxy& m )
         {
-            if( m.impl().rows() != rows() || 
+            if( m.impl().rows() != rows() ||
                 m.impl().cols() != cols() )
             {
                 std::stringstream sout;
@@ -302,7 +419,7 @@ class Matrix_Proxy<ElementT,0,0> : public Matrix_Base<Matrix_Proxy<ElementT>>
         template <typename T>
         Matrix_Proxy& operator=( const Matrix_Base<T>& m )
         {
-            if( m.impl().rows() != rows() || 
+            if( m.impl().rows() != rows() ||
                 m.impl().cols() != cols() )
             {
                 std::stringstream sout;
@@ -338,7 +455,7 @@ class Matrix_Proxy<ElementT,0,0> : public Matrix_Base<Matrix_Proxy<ElementT>>
         {
             return m_rows;
         }
-        
+
         /**
          * Get the matrix columns
          */
@@ -347,11 +464,36 @@ class Matrix_Proxy<ElementT,0,0> : public Matrix_Base<Matrix_Proxy<ElementT>>
             return m_cols;
         }
 
+        /**
+         * Get the distance, in elements, between consecutive rows
+         */
+        std::ptrdiff_t row_stride() const
+        {
+            return m_row_stride;
+        }
+
+        /**
+         * Get the distance, in elements, between consecutive columns
+         */
+        std::ptrdiff_t col_stride() const
+        {
+            return m_col_stride;
+        }
+
+        /**
+         * Check if the elements are packed in row-major order with no gaps
+         */
+        bool is_contiguous() const
+        {
+            return ( m_col_stride == 1 || m_cols <= 1 ) &&
+                   ( m_row_stride == static_cast<std::ptrdiff_t>( m_cols ) || m_rows <= 1 );
+        }
+
         /**
          * Change the size of the matrix.
          * Elements in memory are preserved when specified.
          */
-        void set_size( size_t new_rows, 
+        void set_size( size_t new_rows,
                        size_t new_cols,
                        [[maybe_unused]] bool preserve = false )
         {
@@ -367,7 +509,7 @@ class Matrix_Proxy<ElementT,0,0> : public Matrix_Base<Matrix_Proxy<ElementT>>
         value_type& operator()( size_t row,
                                 size_t col )
         {
-            return m_ptr[row*m_cols+col];
+            return m_ptr[ offset( row, col ) ];
         }
 
         /**
@@ -376,55 +518,108 @@ class Matrix_Proxy<ElementT,0,0> : public Matrix_Base<Matrix_Proxy<ElementT>>
         value_type const& operator()( size_t row,
                                       size_t col ) const
         {
-            return m_ptr[row*m_cols+col];
+            return m_ptr[ offset( row, col ) ];
         }
 
         /**
-         * Get the data pointer
+         * Get a proxy over a rectangular window of this one, sharing its
+         * memory and strides.  Throws if the window does not fit.
+         */
+        Matrix_Proxy window( size_t start_row,
+                             size_t start_col,
+                             size_t num_rows,
+                             size_t num_cols ) const
+        {
+            if( start_row + num_rows > rows() ||
+                start_col + num_cols > cols() )
+            {
+                std::stringstream sout;
+                sout << "Matrix_Proxy: Window (" << start_row << ", " << start_col << ") + ("
+                     << num_rows << " x " << num_cols << ") exceeds " << rows() << " x " << cols() << ".";
+                throw std::runtime_error( sout.str() );
+            }
+            ElementT* start = ( num_rows > 0 && num_cols > 0 ) ? m_ptr + offset( start_row, start_col ) : m_ptr;
+            return Matrix_Proxy( start, num_rows, num_cols, m_row_stride, m_col_stride );
+        }
+
+        /**
+         * Get the elements as a span.  Throws unless is_contiguous().
+         */
+        std::span<ElementT> to_span() const
+        {
+            if( !is_contiguous() )
+            {
+                throw std::runtime_error( "Matrix_Proxy: Cannot convert a strided proxy to std::span." );
+            }
+            return std::span<ElementT>( m_ptr, rows() * cols() );
+        }
+
+#if defined( __cpp_lib_mdspan )
+        /**
+         * Get the view as a layout_stride mdspan.  Throws on negative strides,
+         * which mdspan cannot represent.
+         */
+        std::mdspan<ElementT,std::dextents<size_t,2>,std::layout_stride> to_mdspan() const
+        {
+            if( m_row_stride < 0 || m_col_stride < 0 )
+            {
+                throw std::runtime_error( "Matrix_Proxy: Cannot convert negative strides to std::mdspan." );
+            }
+            using extents_t = std::dextents<size_t,2>;
+            std::layout_stride::mapping<extents_t> mapping( extents_t( m_rows, m_cols ),
+                                                            std::array<size_t,2>{ static_cast<size_t>( m_row_stride ),
+                                                                                  static_cast<size_t>( m_col_stride ) } );
+            return std::mdspan<ElementT,extents_t,std::layout_stride>( m_ptr, mapping );
+        }
+#endif
+
+        /**
+         * Get the data pointer.  This is element (0,0); the rest of the data is
+         * only packed row-major when is_contiguous().
          */
         value_type *data()
         {
-            return &( operator()( 0, 0 ) );
+            return m_ptr;
         }
-        
+
         /**
          * Get the data pointer
          */
         const value_type* data() const
         {
-            return &( operator()(0,0) );
+            return m_ptr;
         }
-    
+
         /**
          * Get the beginning iterator position
          */
         iter_t begin()
         {
-            return m_ptr;
+            return iter_t( *this, 0, 0 );
         }
-        
+
         /**
          * Get the beginning iterator position
          */
         const_iter_t begin() const
         {
-            return m_ptr;
+            return const_iter_t( *this, 0, 0 );
         }
-        
+
         /**
          * Get the end iterator position
          */
         iter_t end()
         {
-            return m_ptr + rows() * cols();
+            return iter_t( *this, rows(), 0 );
         }
-        
+
         /**
          * Get the end iterator position
          */
         const_iter_t end() const
         {
-            return m_ptr + rows() * cols();
+            return const_iter_t( *this, rows(), 0 );
         }
 
         /**
@@ -440,30 +635,57 @@ class Matrix_Proxy<ElementT,0,0> : public Matrix_Base<Matrix_Proxy<ElementT>>
 
     private:
 
+        /**
+         * Offset of an element from the data pointer
+         */
+        std::ptrdiff_t offset( size_t row,
+                               size_t col ) const
+        {
+            return static_cast<std::ptrdiff_t>( row ) * m_row_stride +
+                   static_cast<std::ptrdiff_t>( col ) * m_col_stride;
+        }
+
         /// Data Pointer
         ElementT* m_ptr { nullptr };
-        
+
         /// Matrix Rows
         size_t m_rows;
-        
+
         /// Matrix Columns
         size_t m_cols;
 
+        /// Distance between rows, in elements
+        std::ptrdiff_t m_row_stride;
+
+        /// Distance between columns, in elements
+        std::ptrdiff_t m_col_stride;
+
 }; // End of Matrix_Proxy Class
 
 /**
- * Shallow view of an image as a matrix.  Returns a Matrix_Proxy object with the same 
- * element type as the channel type in the original image.
+ * Shallow view of a densely-packed matrix.  Returns a Matrix_Proxy object with the same
+ * element type as the original.
  */
 template <typename ContainerT>
-Matrix_Proxy<typename ContainerT::value_type>  matrix_proxy( const ContainerT& container )
+    requires std::derived_from<ContainerT,Matrix_Base<ContainerT>>
+Matrix_Proxy<typename ContainerT::value_type> matrix_proxy( ContainerT& container )
 {
     return Matrix_Proxy<typename ContainerT::value_type>( container );
 }
 
 /**
- * Shallow view of an image as a matrix.  Returns a Matrix_Proxy object with the same 
- * element type as the channel type in the original image.
+ * Shallow, read-only view of a densely-packed matrix.  The elements are const, since
+ * the container is.
+ */
+template <typename ContainerT>
+    requires std::derived_from<ContainerT,Matrix_Base<ContainerT>>
+Matrix_Proxy<const typename ContainerT::value_type> matrix_proxy( const ContainerT& container )
+{
+    return Matrix_Proxy<const typename ContainerT::value_type>( container );
+}
+
+/**
+ * Shallow view of a packed row-major block of memory as a matrix.
  */
 template <typename DataT>
 Matrix_Proxy<DataT> matrix_proxy( DataT* data_ptr,
@@ -473,4 +695,37 @@ Matrix_Proxy<DataT> matrix_proxy( DataT* data_ptr,
     return Matrix_Proxy<DataT>( data_ptr, rows, cols );
 }
 
-} // End of tmns::math namespace
\ No newline at end of file
+/**
+ * Shallow view of a strided block of memory as a matrix.  Strides are in elements.
+ */
+template <typename DataT>
+Matrix_Proxy<DataT> matrix_proxy( DataT*         data_ptr,
+                                  size_t         rows,
+                                  size_t         cols,
+                                  std::ptrdiff_t row_stride,
+                                  std::ptrdiff_t col_stride )
+{
+    return Matrix_Proxy<DataT>( data_ptr, rows, cols, row_stride, col_stride );
+}
+
+/**
+ * Shallow view of a packed row-major span as a matrix.  Throws if the span is too small.
+ */
+template <typename DataT>
+Matrix_Proxy<DataT> matrix_proxy( std::span<DataT> buffer,
+                                  size_t           rows,
+                                  size_t           cols )
+{
+    return Matrix_Proxy<DataT>( buffer, rows, cols );
+}
+
+/**
+ * Shallow view of a rank-2 strided view, such as a std::mdspan, as a matrix.
+ */
+template <Strided_View<2> ViewT>
+Matrix_Proxy<Strided_View_Element<ViewT>> matrix_proxy( const ViewT& view )
+{
+    return Matrix_Proxy<Strided_View_Element<ViewT>>( view );
+}
+
+} // End of tmns::math namespace
@@ -27,6 +27,16 @@ struct Matrix_Cols
     const static size_t value = 0;
 };
 
+/**
+ * Number of elements a dynamically-sized MatrixN<ValueT> stores inline before
+ * spilling to the heap.  The default covers up to a 6x6 matrix.  Specialize this
+ * to tune the footprint for a given type.
+ */
+template <typename ValueT>
+struct Matrix_Inline_Capacity
+{
+    const static size_t value = 36;
+};
 
 /**
  * A wrapper template class for matrices and matrix expressions. Provides
@@ -0,0 +1,133 @@
+/**
+ * @file    Auto_Diff_Model_Base.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/optimization/Least_Squares_Model_Base.hpp>
+#include <terminus/math/types/Jet.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <algorithm>
+
+namespace tmns::math::optimize {
+
+namespace detail {
+
+/**
+ * Swap the scalar type of a vector, e.g. VectorN<double> to VectorN<Jet<double,8>>
+ */
+template <typename VectorT,
+          typename ScalarT>
+struct Rebind_Scalar;
+
+template <typename ValueT,
+          size_t   Dims,
+          typename ScalarT>
+struct Rebind_Scalar<Vector_<ValueT,Dims>,ScalarT>
+{
+    using type = Vector_<ScalarT,Dims>;
+};
+
+} // End of detail namespace
+
+/**
+ * @class Auto_Diff_Model_Base
+ *
+ * Opt-in replacement for Least_Squares_Model_Base which computes the exact Jacobian
+ * using forward-mode automatic differentiation instead of finite differences.
+ *
+ * Your sub-class templates its model function on the scalar type,
+ *
+ *     template <typename T>
+ *     VectorN<T> operator()( VectorN<T> const& x ) const;
+ *
+ * writing the math with unqualified function calls (`sin( x(0) )`, with `using std::sin;`).
+ * The solver calls it with doubles to evaluate the model and with Jet<double,JetN> to
+ * get h(x) and all of dh/dx in a single pass.  Problems with more than JetN parameters
+ * are differentiated JetN columns at a time.
+ *
+ * The domain_type must be a Vector_ or VectorN.  A custom difference() still applies
+ * to the residuals, but it is not used for the derivatives.
+ */
+template <typename ImplT,
+          int      JetN = 8>
+class Auto_Diff_Model_Base : public Least_Squares_Model_Base<ImplT>
+{
+    public:
+
+        /// @brief Scalar type the model is evaluated with for derivatives
+        using jet_type = Jet<double,JetN>;
+
+        using Least_Squares_Model_Base<ImplT>::impl;
+
+        /**
+         * Evaluate the exact Jacobian dh/dx at x
+         */
+        template <typename DomainT>
+        MatrixN<double> jacobian( const DomainT& x ) const
+        {
+            MatrixN<double> J;
+            jacobian( x, J );
+            return J;
+        }
+
+        /**
+         * Evaluate the exact Jacobian dh/dx at x into an existing matrix, which is
+         * resized if needed.  The solvers pick this up in place of the numerical Jacobian.
+         */
+        template <typename DomainT,
+                  typename JacobianT>
+        void jacobian( const DomainT& x,
+                       JacobianT&     J ) const
+        {
+            typename detail::Rebind_Scalar<DomainT,jet_type>::type x_jet;
+            detail::set_vector_size( x_jet, x.size() );
+            for( size_t i = 0; i < x.size(); i++ )
+            {
+                x_jet[i] = jet_type( x[i] );
+            }
+
+            if( x.size() == 0 )
+            {
+                detail::set_matrix_size( J, impl()( x ).size(), 0 );
+                return;
+            }
+
+            for( size_t start = 0; start < x.size(); start += JetN )
+            {
+                // Seed the derivatives for this block of parameters
+                const size_t count = std::min<size_t>( JetN, x.size() - start );
+                for( size_t k = 0; k < count; k++ )
+                {
+                    x_jet[start + k].derivative( k ) = 1;
+                }
+
+                const auto h = impl()( x_jet );
+                if( start == 0 )
+                {
+                    detail::set_matrix_size( J, h.size(), x.size() );
+                }
+
+                for( size_t r = 0; r < h.size(); r++ )
+                {
+                    for( size_t k = 0; k < count; k++ )
+                    {
+                        J( r, start + k ) = h[r].derivative( k );
+                    }
+                }
+
+                for( size_t k = 0; k < count; k++ )
+                {
+                    x_jet[start + k].derivative( k ) = 0;
+                }
+            }
+        }
+
+}; // End of Auto_Diff_Model_Base class
+
+} // End of tmns::math::optimize namespace
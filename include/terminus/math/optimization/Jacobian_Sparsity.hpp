@@ -0,0 +1,417 @@
+/**
+ * @file    Jacobian_Sparsity.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/MatrixN.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * @class Jacobian_Sparsity
+ *
+ * Which entries of a Jacobian can be non-zero, stored by column, together with a
+ * Curtis-Powell-Reid grouping of the columns.  Columns in the same group share no
+ * rows, so the numerical Jacobian can perturb a whole group with one evaluation of
+ * the model and still tell the columns apart.  The number of evaluations drops from
+ * the number of parameters to the number of groups, which for banded or block
+ * structured problems is the bandwidth or block size.
+ *
+ * Declare the pattern yourself, or discover it with probe_jacobian_sparsity().  Give
+ * it to a model through Numeric_Jacobian_Options::sparsity.
+ */
+class Jacobian_Sparsity
+{
+    public:
+
+        /**
+         * Default Constructor.  Empty pattern.
+         */
+        Jacobian_Sparsity() = default;
+
+        /**
+         * Create a pattern from the (row, column) positions of its non-zeros.
+         * Duplicates are ignored.  Throws std::out_of_range if an entry lies outside
+         * a rows by cols matrix.
+         */
+        Jacobian_Sparsity( size_t                                     rows,
+                           size_t                                     cols,
+                           const std::vector<std::pair<size_t,size_t>>& entries )
+          : m_rows( rows ),
+            m_cols( cols )
+        {
+            for( const auto& [row, col] : entries )
+            {
+                if( row >= rows || col >= cols )
+                {
+                    std::stringstream sout;
+                    sout << "Jacobian_Sparsity: entry (" << row << ", " << col
+                         << ") outside a " << rows << " x " << cols << " Jacobian";
+                    throw std::out_of_range( sout.str() );
+                }
+            }
+
+            // Sort column-major and drop duplicates
+            auto sorted = entries;
+            std::sort( sorted.begin(), sorted.end(), []( const auto& a, const auto& b )
+            {
+                return a.second != b.second ? a.second < b.second : a.first < b.first;
+            } );
+            sorted.erase( std::unique( sorted.begin(), sorted.end() ), sorted.end() );
+
+            m_col_offsets.assign( cols + 1, 0 );
+            m_row_indices.reserve( sorted.size() );
+            for( const auto& [row, col] : sorted )
+            {
+                m_col_offsets[col + 1]++;
+                m_row_indices.push_back( row );
+            }
+            for( size_t c = 0; c < cols; c++ )
+            {
+                m_col_offsets[c + 1] += m_col_offsets[c];
+            }
+
+            color_columns();
+        }
+
+        /**
+         * Create a pattern from the non-zeros of a dense matrix
+         */
+        static Jacobian_Sparsity from_dense( const MatrixN<double>& J )
+        {
+            std::vector<std::pair<size_t,size_t>> entries;
+            for( size_t r = 0; r < J.rows(); r++ )
+            {
+                for( size_t c = 0; c < J.cols(); c++ )
+                {
+                    if( J( r, c ) != 0 )
+                    {
+                        entries.emplace_back( r, c );
+                    }
+                }
+            }
+            return Jacobian_Sparsity( J.rows(), J.cols(), entries );
+        }
+
+        /**
+         * Get the number of rows (residuals)
+         */
+        size_t rows() const
+        {
+            return m_rows;
+        }
+
+        /**
+         * Get the number of columns (parameters)
+         */
+        size_t cols() const
+        {
+            return m_cols;
+        }
+
+        /**
+         * Get the number of structural non-zeros
+         */
+        size_t non_zeros() const
+        {
+            return m_row_indices.size();
+        }
+
+        /**
+         * Get the rows which can be non-zero in a column, in increasing order
+         */
+        std::span<const size_t> column( size_t col ) const
+        {
+            return std::span<const size_t>( m_row_indices.data() + m_col_offsets[col],
+                                            m_col_offsets[col + 1] - m_col_offsets[col] );
+        }
+
+        /**
+         * Get where a column's entries start in a Sparse_Jacobian's values
+         */
+        size_t column_offset( size_t col ) const
+        {
+            return m_col_offsets[col];
+        }
+
+        /**
+         * Get the number of column groups, i.e. model evaluations per forward-difference Jacobian
+         */
+        size_t num_groups() const
+        {
+            return m_group_offsets.empty() ? 0 : m_group_offsets.size() - 1;
+        }
+
+        /**
+         * Get the columns in a group
+         */
+        std::span<const size_t> group( size_t index ) const
+        {
+            return std::span<const size_t>( m_group_columns.data() + m_group_offsets[index],
+                                            m_group_offsets[index + 1] - m_group_offsets[index] );
+        }
+
+        /**
+         * Get the group a column belongs to
+         */
+        size_t group_of( size_t col ) const
+        {
+            return m_column_groups[col];
+        }
+
+    private:
+
+        /**
+         * Curtis-Powell-Reid: take the columns in order, putting each in the first
+         * group where it shares no row with a column already there.
+         */
+        void color_columns()
+        {
+            // Columns touching each row
+            std::vector<size_t> row_offsets( m_rows + 1, 0 );
+            for( auto row : m_row_indices )
+            {
+                row_offsets[row + 1]++;
+            }
+            for( size_t r = 0; r < m_rows; r++ )
+            {
+                row_offsets[r + 1] += row_offsets[r];
+            }
+            std::vector<size_t> row_columns( m_row_indices.size() );
+            std::vector<size_t> next( row_offsets.begin(), row_offsets.end() - 1 );
+            for( size_t c = 0; c < m_cols; c++ )
+            {
+                for( auto row : column( c ) )
+                {
+                    row_columns[next[row]++] = c;
+                }
+            }
+
+            // Greedy grouping.  forbidden[g] == c marks group g as clashing with column c.
+            const size_t UNASSIGNED = m_cols;
+            m_column_groups.assign( m_cols, UNASSIGNED );
+            std::vector<size_t> forbidden;
+            size_t num_groups = 0;
+            for( size_t c = 0; c < m_cols; c++ )
+            {
+                for( auto row : column( c ) )
+                {
+                    for( size_t k = row_offsets[row]; k < row_offsets[row + 1]; k++ )
+                    {
+                        const size_t group = m_column_groups[row_columns[k]];
+                        if( group != UNASSIGNED )
+                        {
+                            forbidden[group] = c;
+                        }
+                    }
+                }
+
+                size_t group = 0;
+                while( group < num_groups && forbidden[group] == c )
+                {
+                    group++;
+                }
+                if( group == num_groups )
+                {
+                    forbidden.push_back( UNASSIGNED );
+                    num_groups++;
+                }
+                m_column_groups[c] = group;
+            }
+
+            // Columns of each group, in increasing order
+            m_group_offsets.assign( num_groups + 1, 0 );
+            for( auto group : m_column_groups )
+            {
+                m_group_offsets[group + 1]++;
+            }
+            for( size_t g = 0; g < num_groups; g++ )
+            {
+                m_group_offsets[g + 1] += m_group_offsets[g];
+            }
+            m_group_columns.resize( m_cols );
+            next.assign( m_group_offsets.begin(), m_group_offsets.end() - 1 );
+            for( size_t c = 0; c < m_cols; c++ )
+            {
+                m_group_columns[next[m_column_groups[c]]++] = c;
+            }
+        }
+
+        /// @brief Matrix dimensions
+        size_t m_rows { 0 };
+        size_t m_cols { 0 };
+
+        /// @brief Start of each column in m_row_indices
+        std::vector<size_t> m_col_offsets;
+
+        /// @brief Row of each non-zero, ordered by column
+        std::vector<size_t> m_row_indices;
+
+        /// @brief Group of each column
+        std::vector<size_t> m_column_groups;
+
+        /// @brief Start of each group in m_group_columns
+        std::vector<size_t> m_group_offsets;
+
+        /// @brief Columns ordered by group
+        std::vector<size_t> m_group_columns;
+
+}; // End of Jacobian_Sparsity class
+
+/**
+ * @class Sparse_Jacobian
+ *
+ * Jacobian values stored against a Jacobian_Sparsity, column by column.  The
+ * pattern must outlive the Jacobian.
+ */
+class Sparse_Jacobian
+{
+    public:
+
+        /**
+         * Constructor
+         */
+        explicit Sparse_Jacobian( const Jacobian_Sparsity& pattern )
+          : m_pattern( &pattern ),
+            m_values( pattern.non_zeros(), 0 )
+        {}
+
+        /**
+         * Get the pattern
+         */
+        const Jacobian_Sparsity& pattern() const
+        {
+            return *m_pattern;
+        }
+
+        /**
+         * Get the number of rows
+         */
+        size_t rows() const
+        {
+            return m_pattern->rows();
+        }
+
+        /**
+         * Get the number of columns
+         */
+        size_t cols() const
+        {
+            return m_pattern->cols();
+        }
+
+        /**
+         * Get the values, ordered as the pattern's non-zeros
+         */
+        std::vector<double>& values()
+        {
+            return m_values;
+        }
+
+        /**
+         * Get the values, ordered as the pattern's non-zeros
+         */
+        const std::vector<double>& values() const
+        {
+            return m_values;
+        }
+
+        /**
+         * Get an element, which is zero outside the pattern
+         */
+        double operator()( size_t row,
+                           size_t col ) const
+        {
+            auto rows = m_pattern->column( col );
+            auto iter = std::lower_bound( rows.begin(), rows.end(), row );
+            if( iter == rows.end() || *iter != row )
+            {
+                return 0;
+            }
+            return m_values[m_pattern->column_offset( col ) + ( iter - rows.begin() )];
+        }
+
+        /**
+         * Expand to a dense matrix
+         */
+        MatrixN<double> to_dense() const
+        {
+            MatrixN<double> J( rows(), cols() );
+            for( size_t c = 0; c < cols(); c++ )
+            {
+                auto column = m_pattern->column( c );
+                for( size_t k = 0; k < column.size(); k++ )
+                {
+                    J( column[k], c ) = m_values[m_pattern->column_offset( c ) + k];
+                }
+            }
+            return J;
+        }
+
+        /**
+         * y = J x, so the Jacobian can serve as a linalg::Linear_Operator.  y must
+         * already have rows() elements.
+         */
+        template <typename VectorT,
+                  typename OutputT>
+        void apply( const VectorT& x,
+                    OutputT&       y ) const
+        {
+            for( size_t r = 0; r < rows(); r++ )
+            {
+                y[r] = 0;
+            }
+            for( size_t c = 0; c < cols(); c++ )
+            {
+                auto column = m_pattern->column( c );
+                const double* values = m_values.data() + m_pattern->column_offset( c );
+                for( size_t k = 0; k < column.size(); k++ )
+                {
+                    y[column[k]] += values[k] * x[c];
+                }
+            }
+        }
+
+        /**
+         * y = J^T x.  y must already have cols() elements.
+         */
+        template <typename VectorT,
+                  typename OutputT>
+        void apply_transpose( const VectorT& x,
+                              OutputT&       y ) const
+        {
+            for( size_t c = 0; c < cols(); c++ )
+            {
+                auto column = m_pattern->column( c );
+                const double* values = m_values.data() + m_pattern->column_offset( c );
+                double value = 0;
+                for( size_t k = 0; k < column.size(); k++ )
+                {
+                    value += values[k] * x[column[k]];
+                }
+                y[c] = value;
+            }
+        }
+
+    private:
+
+        /// @brief Pattern of the non-zeros
+        const Jacobian_Sparsity* m_pattern;
+
+        /// @brief Non-zero values, column by column
+        std::vector<double> m_values;
+
+}; // End of Sparse_Jacobian class
+
+} // End of tmns::math::optimize namespace
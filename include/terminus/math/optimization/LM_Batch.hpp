@@ -0,0 +1,105 @@
+/**
+ * @file    LM_Batch.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+#include <terminus/math/optimization/LM_Workspace.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+
+namespace tmns::math::optimize {
+
+/**
+ * Outcome of one problem in a batch.  Kept small, as batches can hold
+ * hundreds of thousands of problems.
+ */
+struct LM_Batch_Result
+{
+    /// @brief Convergence status
+    LM_STATUS_CODE status { LM_STATUS_CODE::ERROR_STATUS_UNKNOWN };
+
+    /// @brief Number of outer iterations taken
+    int32_t iterations { 0 };
+};
+
+namespace detail {
+
+/// @brief Problems claimed by a thread at a time
+static constexpr size_t LM_BATCH_GRAIN = 16;
+
+} // End of detail namespace
+
+/**
+ * Solve many independent problems sharing one model type, e.g. per-tie-point
+ * triangulation.  Problem i starts from seeds[i], fits observations[i], and writes
+ * its solution and status to solutions[i] and results[i].
+ *
+ * Problems are spread over the pool in small blocks which idle threads claim as
+ * they finish, so uneven convergence rates stay balanced.  Each thread reuses one
+ * LM_Workspace for all of its problems, and when domain_type and result_type are
+ * fixed-size the solves do not touch the heap.
+ *
+ * The model is shared by all threads, so its evaluation must be thread-safe.  A
+ * problem whose linear solve fails keeps its seed as the solution and reports
+ * LM_STATUS_CODE::ERROR_SOLVE_FAILED.
+ *
+ * Throws std::runtime_error if the spans differ in length.
+ */
+template <typename ImplT>
+void levenberg_marquardt_batch( const Least_Squares_Model_Base<ImplT>&       least_squares_model,
+                                std::span<const typename ImplT::domain_type> seeds,
+                                std::span<const typename ImplT::result_type> observations,
+                                std::span<typename ImplT::domain_type>       solutions,
+                                std::span<LM_Batch_Result>                   results,
+                                double                                       abs_tolerance  = MATH_LM_ABS_TOL,
+                                double                                       rel_tolerance  = MATH_LM_REL_TOL,
+                                double                                       max_iterations = MATH_LM_MAX_ITER,
+                                parallel::Thread_Pool&                       pool           = parallel::Thread_Pool::global() )
+{
+    const size_t num_problems = seeds.size();
+    if( observations.size() != num_problems ||
+        solutions.size()    != num_problems ||
+        results.size()      != num_problems )
+    {
+        std::stringstream sout;
+        sout << "levenberg_marquardt_batch: mismatched batch sizes.  Seeds: " << num_problems
+             << ", Observations: " << observations.size() << ", Solutions: " << solutions.size()
+             << ", Results: " << results.size();
+        throw std::runtime_error( sout.str() );
+    }
+
+    parallel::parallel_for_with_state( 0, num_problems, detail::LM_BATCH_GRAIN,
+                                       [](){ return LM_Workspace<ImplT>(); },
+                                       [&]( LM_Workspace<ImplT>& workspace,
+                                            size_t               begin,
+                                            size_t               end )
+                                       {
+                                           for( size_t i = begin; i < end; i++ )
+                                           {
+                                               LM_STATUS_CODE status;
+                                               auto solution = levenberg_marquardt( least_squares_model,
+                                                                                    seeds[i],
+                                                                                    observations[i],
+                                                                                    workspace,
+                                                                                    status,
+                                                                                    abs_tolerance,
+                                                                                    rel_tolerance,
+                                                                                    max_iterations );
+                                               solutions[i] = solution.has_error() ? seeds[i] : solution.value();
+                                               results[i].status     = status;
+                                               results[i].iterations = workspace.iterations();
+                                           }
+                                       },
+                                       pool );
+}
+
+} // End of tmns::math::optimize namespace
@@ -0,0 +1,317 @@
+/**
+ * @file    LM_Covariance.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/core/error/ErrorCategory.hpp>
+#include <terminus/math/matrix/Matrix_Base.hpp>
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/optimization/LM_Workspace.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Parameter covariances from the normal equations of a least squares fit.
+ *
+ * Near a solution the covariance of the parameters is variance * ( J^T J )^-1.  Given
+ * the Cholesky factor L L^T = J^T J, which levenberg_marquardt() keeps when the
+ * workspace has set_keep_factorization(), that is variance * L^-T L^-1.  Every entry
+ * is a dot product of columns of L^-1, and column j of L^-1 is zero above row j, so
+ *
+ *     Cov( B, B ) = variance * Z^T Z,   L Z = E_B
+ *
+ * for a block B of parameters needs only the forward substitutions for its own
+ * columns, starting at its first row.  The full inverse is never formed unless
+ * covariance() is asked for, so diagonal blocks and standard deviations of large
+ * problems stay cheap in memory.
+ *
+ * With a Local_Parameterization the covariance is of the tangent space.
+ */
+namespace tmns::math::optimize {
+
+/**
+ * A run of consecutive parameters, e.g. one pose or one point
+ */
+struct Covariance_Block
+{
+    /// @brief First parameter
+    size_t begin { 0 };
+
+    /// @brief Number of parameters
+    size_t size { 0 };
+};
+
+namespace detail {
+
+/**
+ * Column col of L^-1, which is zero above row col.  Writes rows [col, n) of z.
+ */
+template <typename MatrixT,
+          typename VectorT>
+void inverse_factor_column( const MatrixT& L,
+                            size_t         col,
+                            VectorT&       z )
+{
+    const size_t n = L.rows();
+    z[col] = 1.0 / L( col, col );
+    for( size_t i = col + 1; i < n; i++ )
+    {
+        double value = 0;
+        for( size_t k = col; k < i; k++ )
+        {
+            value -= L( i, k ) * z[k];
+        }
+        z[i] = value / L( i, i );
+    }
+}
+
+/**
+ * Throw std::out_of_range unless a block lies within n parameters
+ */
+inline void check_covariance_block( const Covariance_Block& block,
+                                    size_t                  n )
+{
+    if( block.begin > n || block.size > n - block.begin )
+    {
+        std::stringstream sout;
+        sout << "Covariance block [" << block.begin << ", " << block.begin + block.size
+             << ") outside " << n << " parameters";
+        throw std::out_of_range( sout.str() );
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Full covariance variance * ( L L^T )^-1 from a lower Cholesky factor.  O(n^3)
+ * time and O(n^2) memory; prefer covariance_blocks() when only parts are needed.
+ */
+template <typename MatrixT>
+MatrixN<double> covariance( const Matrix_Base<MatrixT>& factor,
+                            double                      variance = 1,
+                            parallel::Thread_Pool&      pool     = parallel::Thread_Pool::global() )
+{
+    const MatrixT& L = factor.impl();
+    const size_t n = L.rows();
+
+    // W = L^-1, column by column
+    MatrixN<double> W( n, n );
+    parallel::parallel_for_with_state( 0, n, 1,
+                                       [n](){ return VectorN<double>( n ); },
+                                       [&]( VectorN<double>& z,
+                                            size_t           begin,
+                                            size_t           end )
+                                       {
+                                           for( size_t c = begin; c < end; c++ )
+                                           {
+                                               detail::inverse_factor_column( L, c, z );
+                                               for( size_t r = c; r < n; r++ )
+                                               {
+                                                   W( r, c ) = z[r];
+                                               }
+                                           }
+                                       },
+                                       pool );
+
+    // Cov = variance * W^T W, summing only where both columns are non-zero
+    MatrixN<double> output( n, n );
+    parallel::parallel_for( 0, n, 1,
+                            [&]( size_t begin,
+                                 size_t end )
+                            {
+                                for( size_t c = begin; c < end; c++ )
+                                {
+                                    for( size_t r = 0; r <= c; r++ )
+                                    {
+                                        double value = 0;
+                                        for( size_t k = c; k < n; k++ )
+                                        {
+                                            value += W( k, r ) * W( k, c );
+                                        }
+                                        output( r, c ) = variance * value;
+                                        output( c, r ) = variance * value;
+                                    }
+                                }
+                            },
+                            pool );
+    return output;
+} // End covariance
+
+/**
+ * Covariance of each block of parameters with itself, from a lower Cholesky factor.
+ * Costs O( (n - begin)^2 * size ) per block and no n by n storage.  Throws
+ * std::out_of_range if a block lies outside the parameters.
+ */
+template <typename MatrixT>
+std::vector<MatrixN<double>> covariance_blocks( const Matrix_Base<MatrixT>&       factor,
+                                                std::span<const Covariance_Block> blocks,
+                                                double                            variance = 1,
+                                                parallel::Thread_Pool&            pool     = parallel::Thread_Pool::global() )
+{
+    const MatrixT& L = factor.impl();
+    const size_t n = L.rows();
+    for( const auto& block : blocks )
+    {
+        detail::check_covariance_block( block, n );
+    }
+
+    std::vector<MatrixN<double>> output( blocks.size() );
+    parallel::parallel_for_with_state( 0, blocks.size(), 1,
+                                       [n](){ return VectorN<double>( n ); },
+                                       [&]( VectorN<double>& z,
+                                            size_t           begin,
+                                            size_t           end )
+                                       {
+                                           for( size_t b = begin; b < end; b++ )
+                                           {
+                                               const auto& block = blocks[b];
+
+                                               // Z = L^-1 E_B, from the block's first row down
+                                               MatrixN<double> Z( n - block.begin, block.size );
+                                               for( size_t c = 0; c < block.size; c++ )
+                                               {
+                                                   const size_t col = block.begin + c;
+                                                   detail::inverse_factor_column( L, col, z );
+                                                   for( size_t r = col; r < n; r++ )
+                                                   {
+                                                       Z( r - block.begin, c ) = z[r];
+                                                   }
+                                               }
+
+                                               auto& cov = output[b];
+                                               cov.set_size( block.size, block.size );
+                                               for( size_t c = 0; c < block.size; c++ )
+                                               {
+                                                   for( size_t r = 0; r <= c; r++ )
+                                                   {
+                                                       double value = 0;
+                                                       for( size_t k = c; k < Z.rows(); k++ )
+                                                       {
+                                                           value += Z( k, r ) * Z( k, c );
+                                                       }
+                                                       cov( r, c ) = variance * value;
+                                                       cov( c, r ) = variance * value;
+                                                   }
+                                               }
+                                           }
+                                       },
+                                       pool );
+    return output;
+} // End covariance_blocks
+
+/**
+ * Standard deviation of each parameter, sqrt( variance * ( L L^T )^-1_ii ), from a
+ * lower Cholesky factor.  O(n^3 / 6) time and O(n) memory per thread.
+ */
+template <typename MatrixT>
+VectorN<double> marginal_standard_deviations( const Matrix_Base<MatrixT>& factor,
+                                              double                      variance = 1,
+                                              parallel::Thread_Pool&      pool     = parallel::Thread_Pool::global() )
+{
+    const MatrixT& L = factor.impl();
+    const size_t n = L.rows();
+
+    VectorN<double> output( n );
+    parallel::parallel_for_with_state( 0, n, 1,
+                                       [n](){ return VectorN<double>( n ); },
+                                       [&]( VectorN<double>& z,
+                                            size_t           begin,
+                                            size_t           end )
+                                       {
+                                           for( size_t c = begin; c < end; c++ )
+                                           {
+                                               detail::inverse_factor_column( L, c, z );
+                                               double value = 0;
+                                               for( size_t r = c; r < n; r++ )
+                                               {
+                                                   value += z[r] * z[r];
+                                               }
+                                               output[c] = std::sqrt( variance * value );
+                                           }
+                                       },
+                                       pool );
+    return output;
+} // End marginal_standard_deviations
+
+/**
+ * Estimate of the residual variance at the last solution, |e|^2 / ( m - n ), for
+ * scaling the covariances when the measurement noise is unknown.  Needs a workspace
+ * whose solve kept its factorization, as e is then the residual at the solution.
+ * Returns 0 if there are no more residuals than parameters.
+ */
+template <typename ImplT>
+double residual_variance( LM_Workspace<ImplT>& workspace )
+{
+    const size_t m = workspace.num_residuals();
+    const size_t n = workspace.num_tangent();
+    if( m <= n )
+    {
+        return 0;
+    }
+    const double norm = workspace.error().magnitude();
+    return norm * norm / static_cast<double>( m - n );
+}
+
+/**
+ * Full covariance from the factorization kept by the workspace's last solve.  Fails
+ * with INVALID_INPUT if it was not kept or J^T J was singular.
+ */
+template <typename ImplT>
+ImageResult<MatrixN<double>> covariance( const LM_Workspace<ImplT>& workspace,
+                                         double                     variance = 1,
+                                         parallel::Thread_Pool&     pool     = parallel::Thread_Pool::global() )
+{
+    if( !workspace.normal_factor_valid() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "covariance: workspace holds no factorization" );
+    }
+    return outcome::ok<MatrixN<double>>( covariance( workspace.normal_factor(), variance, pool ) );
+}
+
+/**
+ * Covariance blocks from the factorization kept by the workspace's last solve.  Fails
+ * with INVALID_INPUT if it was not kept or J^T J was singular.
+ */
+template <typename ImplT>
+ImageResult<std::vector<MatrixN<double>>> covariance_blocks( const LM_Workspace<ImplT>&        workspace,
+                                                             std::span<const Covariance_Block> blocks,
+                                                             double                            variance = 1,
+                                                             parallel::Thread_Pool&            pool     = parallel::Thread_Pool::global() )
+{
+    if( !workspace.normal_factor_valid() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "covariance_blocks: workspace holds no factorization" );
+    }
+    return outcome::ok<std::vector<MatrixN<double>>>( covariance_blocks( workspace.normal_factor(), blocks, variance, pool ) );
+}
+
+/**
+ * Parameter standard deviations from the factorization kept by the workspace's last
+ * solve.  Fails with INVALID_INPUT if it was not kept or J^T J was singular.
+ */
+template <typename ImplT>
+ImageResult<VectorN<double>> marginal_standard_deviations( const LM_Workspace<ImplT>& workspace,
+                                                           double                     variance = 1,
+                                                           parallel::Thread_Pool&     pool     = parallel::Thread_Pool::global() )
+{
+    if( !workspace.normal_factor_valid() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "marginal_standard_deviations: workspace holds no factorization" );
+    }
+    return outcome::ok<VectorN<double>>( marginal_standard_deviations( workspace.normal_factor(), variance, pool ) );
+}
+
+} // End of tmns::math::optimize namespace
@@ -7,10 +7,19 @@
 
 namespace tmns::math::optimize {
 
-enum class LM_STATUS_CODE { ERROR_DID_NOT_CONVERGE        = -1,
+enum class LM_STATUS_CODE { ERROR_CANCELLED               = -3,
+                            ERROR_SOLVE_FAILED            = -2,
+                            ERROR_DID_NOT_CONVERGE        = -1,
                             ERROR_STATUS_UNKNOWN          = 0,
                             ERROR_CONVERGED_ABS_TOLERANCE = 1,
                             ERROR_CONVERGED_REL_TOLERANCE = 2 };
 
+/**
+ * How the Jacobian is refreshed between outer iterations
+ */
+enum class Jacobian_Update_Method { FULL    = 0, ///< Recompute every iteration
+                                    BROYDEN = 1  ///< Rank-1 updates between periodic recomputes
+                                  };
+
 
 } // End of tmns::math::optimize namespace
\ No newline at end of file
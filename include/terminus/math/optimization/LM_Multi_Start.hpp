@@ -0,0 +1,184 @@
+/**
+ * @file    LM_Multi_Start.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/core/error/ErrorCategory.hpp>
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+#include <terminus/math/optimization/LM_Workspace.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * Controls when levenberg_marquardt_multi_start() gives up on a start
+ */
+struct LM_Multi_Start_Options
+{
+    /// @brief Outer iterations a start always gets before it may be cancelled
+    int min_iterations { 3 };
+
+    /// @brief Cancel a start whose residual norm is above this multiple of the best
+    ///        norm reached by any start so far.  Infinity disables cancellation.
+    double cancel_ratio { 2.0 };
+};
+
+/**
+ * Outcome of one start of levenberg_marquardt_multi_start()
+ */
+struct LM_Start_Result
+{
+    /// @brief Convergence status, ERROR_CANCELLED if the start was abandoned
+    LM_STATUS_CODE status { LM_STATUS_CODE::ERROR_STATUS_UNKNOWN };
+
+    /// @brief Number of outer iterations taken
+    int32_t iterations { 0 };
+
+    /// @brief Residual 2-norm where the start finished
+    double final_norm { std::numeric_limits<double>::infinity() };
+};
+
+namespace detail {
+
+/**
+ * Lower value to candidate if it is smaller
+ */
+inline void atomic_min( std::atomic<double>& value,
+                        double               candidate )
+{
+    double current = value.load( std::memory_order_relaxed );
+    while( candidate < current &&
+           !value.compare_exchange_weak( current, candidate, std::memory_order_relaxed ) )
+    {}
+}
+
+} // End of detail namespace
+
+/**
+ * Solve a non-convex problem from several seeds at once, returning the solution
+ * with the lowest residual norm.  Start i begins at seeds[i] and reports its outcome
+ * in results[i].
+ *
+ * Starts run concurrently on the pool, sharing the best norm any of them has reached
+ * in an atomic.  Since the norm never increases within a start, that is a cost some
+ * start has already achieved.  After options.min_iterations outer iterations, a start
+ * whose norm is still above options.cancel_ratio times the best is abandoned, with
+ * LM_STATUS_CODE::ERROR_CANCELLED.  This is a heuristic: a slow start may have gone
+ * on to win.  Which starts are cancelled depends on timing, but ties in the final
+ * norm go to the lowest index.
+ *
+ * The model is shared by all threads, so its evaluation must be thread-safe.  Fails
+ * with INVALID_INPUT if there are no seeds or no start returned a solution with a
+ * finite residual norm, as when every linear solve failed or the model gave NaN.
+ * Throws std::runtime_error if seeds and results differ in length.
+ */
+template <typename ImplT>
+ImageResult<typename ImplT::domain_type> levenberg_marquardt_multi_start( const Least_Squares_Model_Base<ImplT>&       least_squares_model,
+                                                                          std::span<const typename ImplT::domain_type> seeds,
+                                                                          const typename ImplT::result_type&           observation,
+                                                                          std::span<LM_Start_Result>                   results,
+                                                                          const LM_Multi_Start_Options&                options        = LM_Multi_Start_Options(),
+                                                                          double                                       abs_tolerance  = MATH_LM_ABS_TOL,
+                                                                          double                                       rel_tolerance  = MATH_LM_REL_TOL,
+                                                                          double                                       max_iterations = MATH_LM_MAX_ITER,
+                                                                          parallel::Thread_Pool&                       pool           = parallel::Thread_Pool::global() )
+{
+    using domain_type = typename ImplT::domain_type;
+
+    const size_t num_starts = seeds.size();
+    if( results.size() != num_starts )
+    {
+        std::stringstream sout;
+        sout << "levenberg_marquardt_multi_start: mismatched sizes.  Seeds: " << num_starts
+             << ", Results: " << results.size();
+        throw std::runtime_error( sout.str() );
+    }
+    if( num_starts == 0 )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "levenberg_marquardt_multi_start: no seeds given" );
+    }
+
+    std::atomic<double> incumbent { std::numeric_limits<double>::infinity() };
+    std::vector<domain_type> solutions( num_starts );
+
+    parallel::parallel_for_with_state( 0, num_starts, 1,
+                                       [](){ return LM_Workspace<ImplT>(); },
+                                       [&]( LM_Workspace<ImplT>& workspace,
+                                            size_t               begin,
+                                            size_t               end )
+                                       {
+                                           workspace.set_cancel( [&]( const LM_Iteration_Info& info )
+                                           {
+                                               // A rejected trial is not where the start stands
+                                               const double norm = info.norm_end();
+                                               detail::atomic_min( incumbent, norm );
+                                               return info.iteration >= options.min_iterations &&
+                                                      norm > options.cancel_ratio * incumbent.load( std::memory_order_relaxed );
+                                           } );
+
+                                           for( size_t i = begin; i < end; i++ )
+                                           {
+                                               LM_STATUS_CODE status;
+                                               auto solution = levenberg_marquardt( least_squares_model,
+                                                                                    seeds[i],
+                                                                                    observation,
+                                                                                    workspace,
+                                                                                    status,
+                                                                                    abs_tolerance,
+                                                                                    rel_tolerance,
+                                                                                    max_iterations );
+                                               results[i].status     = status;
+                                               results[i].iterations = workspace.iterations();
+                                               results[i].final_norm = std::numeric_limits<double>::infinity();
+                                               if( solution.has_error() )
+                                               {
+                                                   continue;
+                                               }
+
+                                               // Norm at the solution, reusing the workspace buffers
+                                               solutions[i] = solution.value();
+                                               least_squares_model.evaluate( solutions[i], workspace.h() );
+                                               least_squares_model.difference_into( observation, workspace.h(), workspace.error() );
+                                               results[i].final_norm = workspace.error().magnitude();
+                                               detail::atomic_min( incumbent, results[i].final_norm );
+                                           }
+                                       },
+                                       pool );
+
+    size_t best = num_starts;
+    for( size_t i = 0; i < num_starts; i++ )
+    {
+        // Only a start which returned a solution with a finite residual can win
+        if( !std::isfinite( results[i].final_norm ) ||
+            results[i].status == LM_STATUS_CODE::ERROR_SOLVE_FAILED )
+        {
+            continue;
+        }
+        if( best == num_starts || results[i].final_norm < results[best].final_norm )
+        {
+            best = i;
+        }
+    }
+    if( best == num_starts )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "levenberg_marquardt_multi_start: no start reached a finite residual" );
+    }
+    return outcome::ok<domain_type>( solutions[best] );
+} // End levenberg_marquardt_multi_start
+
+} // End of tmns::math::optimize namespace
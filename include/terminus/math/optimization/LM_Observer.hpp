@@ -0,0 +1,189 @@
+/**
+ * @file    LM_Observer.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/log/utility.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <utility>
+
+namespace tmns::math::optimize {
+
+/**
+ * Statistics for one outer iteration of levenberg_marquardt()
+ */
+struct LM_Iteration_Info
+{
+    /// @brief Outer iteration, starting from 1
+    int iteration { 0 };
+
+    /// @brief Damped solves tried before a step was accepted or rejected
+    int inner_iterations { 0 };
+
+    /// @brief Damping of the last solve tried
+    double lambda { 0 };
+
+    /// @brief Residual norm at the start of the iteration
+    double norm_start { 0 };
+
+    /// @brief Residual norm at the last trial step, even if it was rejected
+    double norm_try { 0 };
+
+    /// @brief True if the trial step was taken
+    bool accepted { false };
+
+    /// @brief True if the Jacobian came from a Broyden update rather than a full computation
+    bool broyden_update { false };
+
+    /// @brief Iterations of an iterative linear solver, or 0 for a direct solve
+    int linear_iterations { 0 };
+
+    /// @brief Time spent evaluating the model, excluding the Jacobian
+    std::chrono::nanoseconds model_time { 0 };
+
+    /// @brief Time spent computing the Jacobian
+    std::chrono::nanoseconds jacobian_time { 0 };
+
+    /// @brief Time spent forming and solving the normal equations
+    std::chrono::nanoseconds solve_time { 0 };
+
+    /**
+     * Residual norm the iteration ended at:  the trial if it was taken, otherwise the
+     * norm it started from
+     */
+    double norm_end() const
+    {
+        return accepted ? norm_try : norm_start;
+    }
+};
+
+/**
+ * Callback run by the solver after each outer iteration
+ */
+using LM_Observer = std::function<void( const LM_Iteration_Info& )>;
+
+/**
+ * Check run by the solver after each outer iteration.  Returning true stops the solve.
+ */
+using LM_Cancel_Check = std::function<bool( const LM_Iteration_Info& )>;
+
+/**
+ * How much of their progress the Levenberg-Marquardt solvers hand to terminus_log
+ */
+enum class LM_Log_Level { NONE  = 0,
+                          DEBUG = 1,
+                          TRACE = 2 };
+
+namespace detail {
+
+/// @brief Process-wide solver log level.  TRACE passes everything on, leaving the
+///        logger's own level in charge.
+inline std::atomic<LM_Log_Level> g_lm_log_level { LM_Log_Level::TRACE };
+
+/**
+ * Accumulates wall-clock time for a solver phase, doing nothing unless enabled
+ */
+class LM_Phase_Timer
+{
+    public:
+
+        using clock_type = std::chrono::steady_clock;
+
+        /**
+         * Constructor
+         */
+        explicit LM_Phase_Timer( bool enabled )
+            : m_enabled( enabled )
+        {}
+
+        /**
+         * Start timing
+         */
+        void start()
+        {
+            if( m_enabled )
+            {
+                m_start = clock_type::now();
+            }
+        }
+
+        /**
+         * Stop timing, adding the elapsed time to total
+         */
+        void stop( std::chrono::nanoseconds& total )
+        {
+            if( m_enabled )
+            {
+                total += std::chrono::duration_cast<std::chrono::nanoseconds>( clock_type::now() - m_start );
+            }
+        }
+
+    private:
+
+        /// @brief Whether to read the clock at all
+        bool m_enabled;
+
+        /// @brief Start of the current interval
+        clock_type::time_point m_start;
+
+}; // End of LM_Phase_Timer class
+
+} // End of detail namespace
+
+/**
+ * Set how much the Levenberg-Marquardt solvers pass to terminus_log.  The default,
+ * TRACE, passes every message, so the logger's level decides what is written.
+ * Messages above the level set here never reach the logger, so NONE takes logging
+ * out of the solver loops entirely, e.g. for large batches of solves.
+ */
+inline void set_lm_log_level( LM_Log_Level level )
+{
+    detail::g_lm_log_level.store( level, std::memory_order_relaxed );
+}
+
+/**
+ * Get the Levenberg-Marquardt log level
+ */
+inline LM_Log_Level lm_log_level()
+{
+    return detail::g_lm_log_level.load( std::memory_order_relaxed );
+}
+
+namespace detail {
+
+/**
+ * Forward to tmns::log::debug() unless the solver log level is NONE.  Arguments are
+ * passed by reference, so nothing is formatted here; vectors and matrices are never
+ * converted to strings by the solvers.
+ */
+template <typename... ArgsT>
+void lm_debug( ArgsT&&... args )
+{
+    if( lm_log_level() >= LM_Log_Level::DEBUG ) [[unlikely]]
+    {
+        tmns::log::debug( std::forward<ArgsT>( args )... );
+    }
+}
+
+/**
+ * Forward to tmns::log::trace() only if the solver log level allows it
+ */
+template <typename... ArgsT>
+void lm_trace( ArgsT&&... args )
+{
+    if( lm_log_level() >= LM_Log_Level::TRACE ) [[unlikely]]
+    {
+        tmns::log::trace( std::forward<ArgsT>( args )... );
+    }
+}
+
+} // End of detail namespace
+
+} // End of tmns::math::optimize namespace
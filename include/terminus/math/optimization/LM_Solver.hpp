@@ -0,0 +1,185 @@
+/**
+ * @file    LM_Solver.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/core/error/ErrorCategory.hpp>
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+#include <terminus/math/optimization/LM_Workspace.hpp>
+
+namespace tmns::math::optimize {
+
+/**
+ * @class LM_Solver
+ *
+ * Levenberg-Marquardt for a sequence of closely related problems, such as tracking a
+ * target from frame to frame.  Each solve starts from the damping the previous one
+ * finished with, rather than from scratch, and reuses the same workspace so it does
+ * not allocate.  Optionally the last Jacobian is reused for the first iteration as
+ * well, saving its computation when consecutive problems barely differ; it is
+ * recomputed if the first step stalls.
+ *
+ * The solver keeps a reference to the model, which must outlive it.  Call reset()
+ * when the problem changes abruptly, e.g. when a track is lost.
+ */
+template <typename ImplT>
+class LM_Solver
+{
+    public:
+
+        /// @brief Parameter vector type
+        using domain_type = typename ImplT::domain_type;
+
+        /// @brief Residual vector type
+        using result_type = typename ImplT::result_type;
+
+        /**
+         * Constructor
+         *
+         * @param model          Model to solve
+         * @param reuse_jacobian Use the previous solve's last Jacobian for the first iteration
+         */
+        explicit LM_Solver( const Least_Squares_Model_Base<ImplT>& model,
+                            bool                                   reuse_jacobian = false,
+                            double                                 abs_tolerance  = MATH_LM_ABS_TOL,
+                            double                                 rel_tolerance  = MATH_LM_REL_TOL,
+                            double                                 max_iterations = MATH_LM_MAX_ITER )
+          : m_model( model ),
+            m_abs_tolerance( abs_tolerance ),
+            m_rel_tolerance( rel_tolerance ),
+            m_max_iterations( max_iterations )
+        {
+            LM_Warm_Start_Options options;
+            options.jacobian = reuse_jacobian;
+            m_workspace.set_warm_start( options );
+        }
+
+        /**
+         * Solve from a seed, warm-started from the previous solve
+         */
+        ImageResult<domain_type> solve( const domain_type& seed,
+                                        const result_type& observation )
+        {
+            auto result = levenberg_marquardt( m_model,
+                                               seed,
+                                               observation,
+                                               m_workspace,
+                                               m_status,
+                                               m_abs_tolerance,
+                                               m_rel_tolerance,
+                                               m_max_iterations );
+            if( result.has_error() )
+            {
+                return result.error();
+            }
+
+            // Later solves continue from where this one finished
+            auto options = m_workspace.warm_start();
+            options.damping = true;
+            m_workspace.set_warm_start( options );
+
+            m_solution     = result.value();
+            m_has_solution = true;
+            return result;
+        }
+
+        /**
+         * Solve seeded from the previous solution.  Fails if there has not been one.
+         */
+        ImageResult<domain_type> solve( const result_type& observation )
+        {
+            if( !m_has_solution )
+            {
+                return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                                      "LM_Solver: no previous solution to seed from" );
+            }
+            const domain_type seed = m_solution;
+            return solve( seed, observation );
+        }
+
+        /**
+         * Forget the previous solve, so the next starts cold
+         */
+        void reset()
+        {
+            auto options = m_workspace.warm_start();
+            options.damping = false;
+            m_workspace.set_warm_start( options );
+            m_workspace.set_jacobian_valid( false );
+            m_has_solution = false;
+        }
+
+        /**
+         * Check if a previous solution is available
+         */
+        bool has_solution() const
+        {
+            return m_has_solution;
+        }
+
+        /**
+         * Get the previous solution
+         */
+        const domain_type& solution() const
+        {
+            return m_solution;
+        }
+
+        /**
+         * Get the convergence status of the last solve
+         */
+        LM_STATUS_CODE status() const
+        {
+            return m_status;
+        }
+
+        /**
+         * Get the number of outer iterations taken by the last solve
+         */
+        int iterations() const
+        {
+            return m_workspace.iterations();
+        }
+
+        /**
+         * Get the damping the next solve starts from
+         */
+        double lambda() const
+        {
+            return m_workspace.lambda();
+        }
+
+        /**
+         * Get the workspace, e.g. to set an observer or Jacobian update method
+         */
+        LM_Workspace<ImplT>& workspace()
+        {
+            return m_workspace;
+        }
+
+    private:
+
+        /// @brief Model being solved
+        const Least_Squares_Model_Base<ImplT>& m_model;
+
+        /// @brief Convergence criteria
+        double m_abs_tolerance;
+        double m_rel_tolerance;
+        double m_max_iterations;
+
+        /// @brief Buffers and warm-start state
+        LM_Workspace<ImplT> m_workspace;
+
+        /// @brief Status of the last solve
+        LM_STATUS_CODE m_status { LM_STATUS_CODE::ERROR_STATUS_UNKNOWN };
+
+        /// @brief Last solution
+        domain_type m_solution;
+        bool m_has_solution { false };
+
+}; // End of LM_Solver class
+
+} // End of tmns::math::optimize namespace
@@ -0,0 +1,316 @@
+/**
+ * @file    LM_Step_Control.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/optimization/LM_Enums.hpp>
+#include <terminus/math/optimization/LM_Observer.hpp>
+
+// C++ Libraries
+#include <utility>
+
+namespace tmns::math::optimize::detail {
+
+/// @brief Damped solves tried in one outer iteration before giving up on the step
+static constexpr int LM_MAX_INNER_ITERATIONS = 5;
+
+/// @brief Factor the damping grows by after a rejected step and shrinks by after each
+///        outer iteration
+static constexpr double LM_LAMBDA_FACTOR = 10;
+
+/**
+ * @class LM_Step_Control
+ *
+ * Damping and convergence bookkeeping shared by the Levenberg-Marquardt solvers, so
+ * they differ only in how they linearize and solve the damped system.  Each outer
+ * iteration runs
+ *
+ *     control.start_iteration();
+ *     while( control.searching() )
+ *     {
+ *         ... solve with control.lambda(), then
+ *         control.record_trial( norm_try );      // or control.record_failed_solve()
+ *     }
+ *     done = control.check_convergence( status );
+ *     if( control.accepted() ) { take the step }
+ *     control.finish_iteration();
+ *
+ * A trial worse than the starting norm raises lambda tenfold.  After
+ * LM_MAX_INNER_ITERATIONS solves the step is abandoned (short-circuited) and the
+ * norm stays where it started.  Every outer iteration ends by lowering lambda tenfold.
+ */
+class LM_Step_Control
+{
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param norm_start     Residual norm at the seed
+         * @param abs_tolerance  Converged once the norm falls below this
+         * @param rel_tolerance  Converged once an accepted step improves the norm by less than this fraction
+         * @param max_iterations Limit on outer iterations
+         * @param name           Prefix for log messages, or null to log nothing
+         * @param lambda         Initial damping
+         */
+        LM_Step_Control( double      norm_start,
+                         double      abs_tolerance,
+                         double      rel_tolerance,
+                         double      max_iterations,
+                         const char* name,
+                         double      lambda = 0.1 )
+          : m_abs_tolerance( abs_tolerance ),
+            m_rel_tolerance( rel_tolerance ),
+            m_max_iterations( max_iterations ),
+            m_name( name ),
+            m_lambda( lambda ),
+            m_norm_start( norm_start ),
+            m_norm_try( norm_start ),
+            m_last_trial( norm_start )
+        {}
+
+        /**
+         * Check the seed.  Sets status and returns true if it already meets the
+         * absolute tolerance.
+         */
+        bool converged_at_start( LM_STATUS_CODE& status ) const
+        {
+            if( m_norm_start < m_abs_tolerance )
+            {
+                status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
+                log( "CONVERGED TO ABSOLUTE TOLERANCE" );
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Begin an outer iteration from the norm the previous one ended at
+         */
+        void start_iteration()
+        {
+            m_outer_iterations++;
+            m_inner_iterations = 0;
+            m_short_circuit    = false;
+            m_norm_try         = m_norm_start + 1.0;
+            m_last_trial       = m_norm_try;
+        }
+
+        /**
+         * Begin an outer iteration from a freshly evaluated norm
+         */
+        void start_iteration( double norm_start )
+        {
+            m_norm_start = norm_start;
+            start_iteration();
+        }
+
+        /**
+         * True while no damped step has improved on the starting norm
+         */
+        bool searching() const
+        {
+            return m_norm_try > m_norm_start;
+        }
+
+        /**
+         * Record the norm reached by a damped step
+         */
+        void record_trial( double norm_try )
+        {
+            m_norm_try   = norm_try;
+            m_last_trial = norm_try;
+            if( m_norm_try > m_norm_start )
+            {
+                // Increase lambda and try again
+                m_lambda *= LM_LAMBDA_FACTOR;
+            }
+            count_inner_iteration();
+        }
+
+        /**
+         * Record a damped system which could not be solved, e.g. one which is not
+         * numerically positive-definite at this lambda
+         */
+        void record_failed_solve()
+        {
+            m_lambda   *= LM_LAMBDA_FACTOR;
+            m_norm_try  = m_norm_start + 1.0;
+            count_inner_iteration();
+        }
+
+        /**
+         * Apply the convergence tests at the end of an outer iteration, setting status
+         * to the tolerance reached.  The relative test needs an accepted step, and is
+         * skipped if check_relative is false (e.g. a step from an approximate Jacobian
+         * the solver is about to retry with an exact one).
+         *
+         * @return True if the solve is done
+         */
+        bool check_convergence( LM_STATUS_CODE& status,
+                                bool            check_relative = true ) const
+        {
+            bool done = false;
+
+            // Percentage change convergence criterion. Only if we did not do a short-circuit,
+            // as in that case the solution did not improve.
+            if( check_relative && accepted() && progress() < m_rel_tolerance )
+            {
+                status = LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE;
+                log( "CONVERGED TO RELATIVE TOLERANCE" );
+                done = true;
+            }
+
+            // Absolute error convergence criterion
+            if( m_norm_try < m_abs_tolerance )
+            {
+                status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
+                log( "CONVERGED TO ABSOLUTE TOLERANCE" );
+                done = true;
+            }
+
+            // Max iterations convergence criterion
+            if( m_outer_iterations >= m_max_iterations )
+            {
+                log( "REACHED MAX ITERATIONS!" );
+                done = true;
+            }
+            return done;
+        }
+
+        /**
+         * End an outer iteration.  The norm moves to the accepted trial, or stays
+         * put after a short-circuit, and lambda is lowered.
+         */
+        void finish_iteration()
+        {
+            m_norm_start = m_norm_try;
+            m_lambda    /= LM_LAMBDA_FACTOR;
+            log( "end of outer iteration ", m_outer_iterations, " with error ", m_norm_try,
+                 ", lambda = ", m_lambda );
+        }
+
+        /**
+         * True if the outer iteration found a better point
+         */
+        bool accepted() const
+        {
+            return !m_short_circuit;
+        }
+
+        /**
+         * Fractional improvement of the outer iteration, zero after a short-circuit
+         */
+        double progress() const
+        {
+            return ( m_norm_start - m_norm_try ) / m_norm_start;
+        }
+
+        /**
+         * Get the damping for the next solve
+         */
+        double lambda() const
+        {
+            return m_lambda;
+        }
+
+        /**
+         * Get the norm at the start of the outer iteration
+         */
+        double norm_start() const
+        {
+            return m_norm_start;
+        }
+
+        /**
+         * Get the norm the outer iteration ends at:  the accepted trial, or the starting
+         * norm after a short-circuit
+         */
+        double norm_try() const
+        {
+            return m_norm_try;
+        }
+
+        /**
+         * Get the norm of the last damped step tried, even if it was rejected
+         */
+        double last_trial() const
+        {
+            return m_last_trial;
+        }
+
+        /**
+         * Get the number of damped solves in this outer iteration
+         */
+        int inner_iterations() const
+        {
+            return m_inner_iterations;
+        }
+
+        /**
+         * Get the number of outer iterations started
+         */
+        int outer_iterations() const
+        {
+            return m_outer_iterations;
+        }
+
+    private:
+
+        /**
+         * Count a damped solve, short-circuiting once there have been too many
+         */
+        void count_inner_iteration()
+        {
+            ++m_inner_iterations; // Sanity check on iterations in this loop
+            if( m_inner_iterations > LM_MAX_INNER_ITERATIONS )
+            {
+                log( "too many inner iterations - short circuiting" );
+                m_short_circuit = true;
+                m_norm_try      = m_norm_start;
+            }
+        }
+
+        /**
+         * Log with the solver's prefix
+         */
+        template <typename... ArgsT>
+        void log( ArgsT&&... args ) const
+        {
+            if( m_name )
+            {
+                lm_debug( m_name, ": ", std::forward<ArgsT>( args )... );
+            }
+        }
+
+        /// @brief Convergence settings
+        double m_abs_tolerance;
+        double m_rel_tolerance;
+        double m_max_iterations;
+
+        /// @brief Log prefix, or null
+        const char* m_name;
+
+        /// @brief Current damping
+        double m_lambda;
+
+        /// @brief Norm at the start of the outer iteration, and where it ends
+        double m_norm_start;
+        double m_norm_try;
+
+        /// @brief Norm of the last damped step tried
+        double m_last_trial;
+
+        /// @brief Iteration counts
+        int m_outer_iterations { 0 };
+        int m_inner_iterations { 0 };
+
+        /// @brief True if the outer iteration gave up on improving
+        bool m_short_circuit { false };
+
+}; // End of LM_Step_Control class
+
+} // End of tmns::math::optimize::detail namespace
@@ -0,0 +1,577 @@
+/**
+ * @file    LM_Workspace.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/Matrix.hpp>
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/optimization/Least_Squares_Model_Base.hpp>
+#include <terminus/math/optimization/LM_Enums.hpp>
+#include <terminus/math/optimization/LM_Observer.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <utility>
+
+namespace tmns::math::optimize {
+
+/**
+ * Controls how levenberg_marquardt() refreshes the Jacobian
+ */
+struct LM_Jacobian_Update_Options
+{
+    /// @brief Recompute every iteration, or use Broyden updates in between
+    Jacobian_Update_Method method { Jacobian_Update_Method::FULL };
+
+    /// @brief With BROYDEN, recompute at least every this many outer iterations
+    int refresh_interval { 10 };
+
+    /// @brief With BROYDEN, recompute when a step reduces the norm by less than this fraction
+    double stall_tolerance { 1e-3 };
+};
+
+/**
+ * Controls what levenberg_marquardt() carries over from the previous solve with the
+ * same workspace, for sequences of closely related problems such as tracking
+ */
+struct LM_Warm_Start_Options
+{
+    /// @brief Start from the damping the previous solve finished with, rather than 0.1
+    bool damping { false };
+
+    /// @brief Use the previous solve's last Jacobian for the first iteration, if the
+    ///        problem size is unchanged.  Recomputed if the first step stalls.
+    bool jacobian { false };
+};
+
+/**
+ * Jacobian work done by the last levenberg_marquardt() solve
+ */
+struct LM_Jacobian_Statistics
+{
+    /// @brief Full Jacobian computations
+    int recomputed { 0 };
+
+    /// @brief Jacobians carried over from the previous solve
+    int reused { 0 };
+
+    /// @brief Broyden updates used in place of a full computation
+    int broyden_updates { 0 };
+
+    /// @brief Model evaluations a numerical Jacobian would have made for those updates
+    size_t evaluations_saved { 0 };
+};
+
+/**
+ * @class LM_Workspace
+ *
+ * Every buffer the Levenberg-Marquardt loop needs, sized once from the problem
+ * dimensions.  Pass the same workspace into repeated calls of levenberg_marquardt()
+ * and, once it has been sized, the solver performs no heap allocation.
+ *
+ * Resizing to new dimensions only allocates when the buffers have to grow, so a
+ * workspace can be shared between problems of differing sizes.  When domain_type
+ * is a fixed-size Vector_, the normal equations use fixed-size storage as well.
+ * A workspace must not be used by two solves at the same time.
+ */
+template <typename ImplT>
+class LM_Workspace
+{
+    public:
+
+        /// @brief Parameter vector type
+        using domain_type = typename ImplT::domain_type;
+
+        /// @brief Residual vector type
+        using result_type = typename ImplT::result_type;
+
+        /// @brief Jacobian type
+        using jacobian_type = typename ImplT::jacobian_type;
+
+        /// @brief Number of parameters if known at compile time, else 0
+        static constexpr size_t PARAMS_N = Vector_Size<domain_type>::value;
+
+        /// @brief Normal equations matrix type.  Fixed-size when the domain is.
+        using matrix_type = Matrix<double,PARAMS_N,PARAMS_N>;
+
+        /// @brief Normal equations vector type.  Fixed-size when the domain is.
+        using vector_type = Vector_<double,PARAMS_N>;
+
+        /**
+         * Default Constructor.  Buffers are sized by the first solve.
+         */
+        LM_Workspace() = default;
+
+        /**
+         * Create a workspace for a problem of the given size
+         *
+         * @param num_params    Number of parameters (length of domain_type)
+         * @param num_residuals Number of residuals (length of result_type)
+         */
+        LM_Workspace( size_t num_params,
+                      size_t num_residuals )
+        {
+            resize( num_params, num_residuals );
+        }
+
+        /**
+         * Size all buffers for a problem.  Does nothing if the dimensions are unchanged.
+         *
+         * @param num_tangent Degrees of freedom the solver steps in, when the model has
+         *                    a Local_Parameterization.  Defaults to num_params.
+         */
+        void resize( size_t num_params,
+                     size_t num_residuals,
+                     size_t num_tangent = 0 )
+        {
+            if( num_tangent == 0 )
+            {
+                num_tangent = num_params;
+            }
+            if( num_params    == m_num_params &&
+                num_residuals == m_num_residuals &&
+                num_tangent   == m_num_tangent )
+            {
+                return;
+            }
+
+            detail::set_matrix_size( m_jacobian, num_residuals, num_tangent );
+            detail::set_matrix_size( m_hessian, num_tangent, num_tangent );
+            detail::set_matrix_size( m_factor, num_tangent, num_tangent );
+            detail::set_vector_size( m_gradient, num_tangent );
+            detail::set_vector_size( m_diagonal, num_tangent );
+            detail::set_vector_size( m_step, num_tangent );
+
+            detail::set_vector_size( m_x, num_params );
+            detail::set_vector_size( m_x_try, num_params );
+            detail::set_vector_size( m_h, num_residuals );
+            detail::set_vector_size( m_error, num_residuals );
+            detail::set_vector_size( m_h_try, num_residuals );
+            detail::set_vector_size( m_error_try, num_residuals );
+            detail::set_vector_size( m_output_change, num_residuals );
+            detail::set_vector_size( m_update_scratch, num_tangent );
+
+            detail::set_vector_size( m_scratch.x_step, num_params );
+            detail::set_vector_size( m_scratch.h_step, num_residuals );
+            detail::set_vector_size( m_scratch.h_back, num_residuals );
+            detail::set_vector_size( m_scratch.delta, num_residuals );
+
+            m_num_params     = num_params;
+            m_num_residuals  = num_residuals;
+            m_num_tangent    = num_tangent;
+            m_jacobian_valid = false;
+            m_normal_factor_valid = false;
+        }
+
+        /**
+         * Get the number of parameters the workspace is sized for
+         */
+        size_t num_params() const
+        {
+            return m_num_params;
+        }
+
+        /**
+         * Get the number of degrees of freedom the workspace is sized for
+         */
+        size_t num_tangent() const
+        {
+            return m_num_tangent;
+        }
+
+        /**
+         * Get the number of residuals the workspace is sized for
+         */
+        size_t num_residuals() const
+        {
+            return m_num_residuals;
+        }
+
+        /**
+         * Get the number of outer iterations taken by the last solve
+         */
+        int iterations() const
+        {
+            return m_iterations;
+        }
+
+        /**
+         * Record the number of outer iterations taken by a solve
+         */
+        void set_iterations( int iterations )
+        {
+            m_iterations = iterations;
+        }
+
+        /**
+         * Get the callback run after each outer iteration
+         */
+        const LM_Observer& observer() const
+        {
+            return m_observer;
+        }
+
+        /**
+         * Set a callback to run after each outer iteration, or an empty one to stop.
+         * Phase timings are only measured while an observer is set.
+         */
+        void set_observer( LM_Observer observer )
+        {
+            m_observer = std::move( observer );
+        }
+
+        /**
+         * Get the check run after each outer iteration to stop the solve early
+         */
+        const LM_Cancel_Check& cancel() const
+        {
+            return m_cancel;
+        }
+
+        /**
+         * Set a check to run after each outer iteration, or an empty one to stop.
+         * When it returns true the solve ends with LM_STATUS_CODE::ERROR_CANCELLED.
+         */
+        void set_cancel( LM_Cancel_Check cancel )
+        {
+            m_cancel = std::move( cancel );
+        }
+
+        /**
+         * Get how the Jacobian is refreshed between iterations
+         */
+        const LM_Jacobian_Update_Options& jacobian_update() const
+        {
+            return m_jacobian_update;
+        }
+
+        /**
+         * Set how the Jacobian is refreshed between iterations
+         */
+        void set_jacobian_update( const LM_Jacobian_Update_Options& options )
+        {
+            m_jacobian_update = options;
+        }
+
+        /**
+         * Get what is carried over from the previous solve
+         */
+        const LM_Warm_Start_Options& warm_start() const
+        {
+            return m_warm_start;
+        }
+
+        /**
+         * Set what is carried over from the previous solve
+         */
+        void set_warm_start( const LM_Warm_Start_Options& options )
+        {
+            m_warm_start = options;
+        }
+
+        /**
+         * Get the damping the last solve finished with
+         */
+        double lambda() const
+        {
+            return m_lambda;
+        }
+
+        /**
+         * Set the damping a warm-started solve begins from
+         */
+        void set_lambda( double lambda )
+        {
+            m_lambda = lambda;
+        }
+
+        /**
+         * Check if jacobian() holds a Jacobian from a previous solve
+         */
+        bool jacobian_valid() const
+        {
+            return m_jacobian_valid;
+        }
+
+        /**
+         * Mark whether jacobian() holds a usable Jacobian.  Clear this when the model
+         * changes, so a warm start does not reuse a Jacobian of the old one.
+         */
+        void set_jacobian_valid( bool valid )
+        {
+            m_jacobian_valid = valid;
+        }
+
+        /**
+         * Check if solves factor J^T J at their solution for covariance queries
+         */
+        bool keep_factorization() const
+        {
+            return m_keep_factorization;
+        }
+
+        /**
+         * Have each solve finish by relinearizing at its solution and storing the
+         * Cholesky factor of the undamped J^T J in normal_factor().  Costs one more
+         * Jacobian and factorization per solve.  See LM_Covariance.hpp.
+         */
+        void set_keep_factorization( bool keep )
+        {
+            m_keep_factorization = keep;
+        }
+
+        /**
+         * Check if normal_factor() holds the factor for the last solve.  False if it
+         * was not kept or J^T J was not positive-definite at the solution.
+         */
+        bool normal_factor_valid() const
+        {
+            return m_normal_factor_valid;
+        }
+
+        /**
+         * Record whether normal_factor() is usable
+         */
+        void set_normal_factor_valid( bool valid )
+        {
+            m_normal_factor_valid = valid;
+        }
+
+        /**
+         * Jacobian work done by the last solve
+         */
+        LM_Jacobian_Statistics& jacobian_statistics()
+        {
+            return m_jacobian_statistics;
+        }
+
+        /**
+         * Jacobian work done by the last solve
+         */
+        const LM_Jacobian_Statistics& jacobian_statistics() const
+        {
+            return m_jacobian_statistics;
+        }
+
+        /**
+         * Measurement Jacobian at the current parameters
+         */
+        jacobian_type& jacobian()
+        {
+            return m_jacobian;
+        }
+
+        /**
+         * Gauss-Newton approximation of the cost Hessian, J^T J
+         */
+        matrix_type& hessian()
+        {
+            return m_hessian;
+        }
+
+        /**
+         * Damped Hessian, overwritten by its Cholesky factor
+         */
+        matrix_type& factor()
+        {
+            return m_factor;
+        }
+
+        /**
+         * Lower Cholesky factor L of J^T J at the last solution, L L^T = J^T J.  The
+         * strict upper triangle is unused.
+         */
+        matrix_type& normal_factor()
+        {
+            return m_normal_factor;
+        }
+
+        /**
+         * Lower Cholesky factor L of J^T J at the last solution
+         */
+        const matrix_type& normal_factor() const
+        {
+            return m_normal_factor;
+        }
+
+        /**
+         * Negative cost gradient, -J^T e
+         */
+        vector_type& gradient()
+        {
+            return m_gradient;
+        }
+
+        /**
+         * Undamped Hessian diagonal, kept so damping can be re-applied
+         */
+        vector_type& diagonal()
+        {
+            return m_diagonal;
+        }
+
+        /**
+         * Solved parameter update
+         */
+        vector_type& step()
+        {
+            return m_step;
+        }
+
+        /**
+         * Current parameters
+         */
+        domain_type& x()
+        {
+            return m_x;
+        }
+
+        /**
+         * Trial parameters
+         */
+        domain_type& x_try()
+        {
+            return m_x_try;
+        }
+
+        /**
+         * Model output at the current parameters
+         */
+        result_type& h()
+        {
+            return m_h;
+        }
+
+        /**
+         * Residual at the current parameters
+         */
+        result_type& error()
+        {
+            return m_error;
+        }
+
+        /**
+         * Model output at the trial parameters
+         */
+        result_type& h_try()
+        {
+            return m_h_try;
+        }
+
+        /**
+         * Residual at the trial parameters
+         */
+        result_type& error_try()
+        {
+            return m_error_try;
+        }
+
+        /**
+         * Change in model output over the last accepted step, for Broyden updates
+         */
+        result_type& output_change()
+        {
+            return m_output_change;
+        }
+
+        /**
+         * Parameter-sized scratch for Broyden updates
+         */
+        vector_type& update_scratch()
+        {
+            return m_update_scratch;
+        }
+
+        /**
+         * Buffers for the numerical Jacobian
+         */
+        Numeric_Jacobian_Scratch<domain_type,result_type>& scratch()
+        {
+            return m_scratch;
+        }
+
+    private:
+
+        /// @brief Number of parameters
+        size_t m_num_params { 0 };
+
+        /// @brief Number of residuals
+        size_t m_num_residuals { 0 };
+
+        /// @brief Number of degrees of freedom
+        size_t m_num_tangent { 0 };
+
+        /// @brief Outer iterations taken by the last solve
+        int m_iterations { 0 };
+
+        /// @brief Per-iteration callback
+        LM_Observer m_observer;
+
+        /// @brief Per-iteration early stop
+        LM_Cancel_Check m_cancel;
+
+        /// @brief Jacobian refresh strategy
+        LM_Jacobian_Update_Options m_jacobian_update;
+
+        /// @brief Jacobian work done by the last solve
+        LM_Jacobian_Statistics m_jacobian_statistics;
+
+        /// @brief What to carry over from the previous solve
+        LM_Warm_Start_Options m_warm_start;
+
+        /// @brief Damping the last solve finished with
+        double m_lambda { 0.1 };
+
+        /// @brief True if m_jacobian holds the last solve's Jacobian
+        bool m_jacobian_valid { false };
+
+        /// @brief Factor J^T J at the solution
+        bool m_keep_factorization { false };
+
+        /// @brief True if m_normal_factor holds the last solve's factor
+        bool m_normal_factor_valid { false };
+
+        /// @brief Measurement Jacobian
+        jacobian_type m_jacobian;
+
+        /// @brief Normal equations matrix
+        matrix_type m_hessian;
+
+        /// @brief Factorization storage
+        matrix_type m_factor;
+
+        /// @brief Factor of J^T J at the solution, sized on first use
+        matrix_type m_normal_factor;
+
+        /// @brief Normal equations right-hand side
+        vector_type m_gradient;
+
+        /// @brief Diagonal backup
+        vector_type m_diagonal;
+
+        /// @brief Parameter update
+        vector_type m_step;
+
+        /// @brief Current and trial parameters
+        domain_type m_x;
+        domain_type m_x_try;
+
+        /// @brief Current and trial model outputs and residuals
+        result_type m_h;
+        result_type m_error;
+        result_type m_h_try;
+        result_type m_error_try;
+
+        /// @brief Broyden update buffers
+        result_type m_output_change;
+        vector_type m_update_scratch;
+
+        /// @brief Numerical Jacobian buffers
+        Numeric_Jacobian_Scratch<domain_type,result_type> m_scratch;
+
+}; // End of LM_Workspace class
+
+} // End of tmns::math::optimize namespace
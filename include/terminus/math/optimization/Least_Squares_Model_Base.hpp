@@ -7,11 +7,189 @@
 
 // Terminus Libraries
 #include <terminus/math/matrix.hpp>
+#include <terminus/math/optimization/Jacobian_Sparsity.hpp>
 #include <terminus/math/optimization/LM_Enums.hpp>
+#include <terminus/math/optimization/Local_Parameterization.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
 #include <terminus/math/vector/VectorN.hpp>
 
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace tmns::math::optimize {
 
+namespace detail {
+
+/**
+ * Resize a dynamic vector or matrix.  Fixed-size types are left alone.
+ */
+template <typename VectorT>
+void set_vector_size( VectorT& v,
+                      size_t   size )
+{
+    if constexpr ( requires { v.set_size( size ); } )
+    {
+        if( v.size() != size )
+        {
+            v.set_size( size );
+        }
+    }
+}
+
+template <typename MatrixT>
+void set_matrix_size( MatrixT& m,
+                      size_t   rows,
+                      size_t   cols )
+{
+    if constexpr ( requires { m.set_size( rows, cols ); } )
+    {
+        if( m.rows() != rows || m.cols() != cols )
+        {
+            m.set_size( rows, cols );
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Finite-difference formula used by the numerical Jacobian
+ */
+enum class Difference_Method { FORWARD, ///< ( h(x+e) - h(x) ) / e.  One evaluation per parameter.
+                               CENTRAL  ///< ( h(x+e) - h(x-e) ) / 2e.  Two evaluations per parameter, O(e^2) error.
+                             };
+
+/**
+ * How the numerical Jacobian picks the step e for each parameter
+ */
+enum class Step_Method { FIXED,    ///< e = 1e-7 * ( 1 + |x| )
+                         ADAPTIVE  ///< e scaled to the optimal order for the difference method and |x|
+                       };
+
+/**
+ * Configuration for the numerical Jacobian.  The defaults reproduce the original
+ * sequential forward-difference behavior.
+ */
+struct Numeric_Jacobian_Options
+{
+    /// @brief Difference formula
+    Difference_Method difference { Difference_Method::FORWARD };
+
+    /// @brief Step selection
+    Step_Method step { Step_Method::FIXED };
+
+    /// @brief Evaluate columns concurrently on a thread pool.  Your model must be
+    ///        safe to evaluate from several threads at once.
+    bool parallel { false };
+
+    /// @brief Pool for parallel evaluation.  Uses the global pool if null.
+    parallel::Thread_Pool* pool { nullptr };
+
+    /// @brief Known zeros of the Jacobian.  When set, structurally orthogonal columns
+    ///        are perturbed together, one evaluation per column group.  Must outlive
+    ///        its use by the model.
+    const Jacobian_Sparsity* sparsity { nullptr };
+
+    /**
+     * Get the step for a parameter with the given value
+     */
+    double step_size( double x ) const
+    {
+        if( step == Step_Method::FIXED )
+        {
+            return 1e-7 + std::fabs( x * 1e-7 );
+        }
+
+        // Balance truncation against round-off: sqrt(eps) for forward, cbrt(eps) for central
+        static const double FORWARD_SCALE = std::sqrt( std::numeric_limits<double>::epsilon() );
+        static const double CENTRAL_SCALE = std::cbrt( std::numeric_limits<double>::epsilon() );
+        double h = ( difference == Difference_Method::FORWARD ? FORWARD_SCALE : CENTRAL_SCALE ) *
+                   std::max( std::fabs( x ), 1.0 );
+
+        // Use the step which is actually representable at x
+        volatile double x_step = x + h;
+        return x_step - x;
+    }
+};
+
+/**
+ * Scratch storage for the in-place numerical Jacobian.  Keep one alive across
+ * calls (LM_Workspace does this) and the derivative evaluation never allocates
+ * once the buffers are sized.
+ */
+template <typename DomainT,
+          typename ResultT>
+struct Numeric_Jacobian_Scratch
+{
+    /// @brief Perturbed parameter vector
+    DomainT x_step;
+
+    /// @brief Model output at x_step
+    ResultT h_step;
+
+    /// @brief Model output at the backward step, for central differences
+    ResultT h_back;
+
+    /// @brief Difference between h_step and the nominal output
+    ResultT delta;
+
+    /// @brief Tangent-space step, with a Local_Parameterization
+    VectorN<double> tangent_step;
+
+    /// @brief Analytic Jacobian w.r.t. the stored parameters, and the derivative of
+    ///        the parameterization, with a Local_Parameterization
+    MatrixN<double> ambient_jacobian;
+    MatrixN<double> plus_jacobian;
+};
+
+namespace detail {
+
+/**
+ * Finite-difference one parameter, the step shared by every numerical Jacobian.
+ * Moves params[i] by the configured step, calls eval( params, forward ) and, for
+ * central differences, eval( params, back ), then restores params[i] and calls
+ * store( forward, base, epsilon ), where base is back or the nominal output and
+ * ( forward - base ) / epsilon is the derivative.
+ */
+template <typename ParamsT,
+          typename ResultT,
+          typename EvalT,
+          typename StoreT>
+void difference_parameter( const Numeric_Jacobian_Options& options,
+                           ParamsT&                        params,
+                           size_t                          i,
+                           const ResultT&                  nominal,
+                           ResultT&                        forward,
+                           ResultT&                        back,
+                           EvalT&&                         eval,
+                           StoreT&&                        store )
+{
+    const double value = params[i];
+    double epsilon = options.step_size( value );
+
+    params[i] = value + epsilon;
+    eval( params, forward );
+    if( options.difference == Difference_Method::CENTRAL )
+    {
+        params[i] = value - epsilon;
+        eval( params, back );
+        params[i] = value;
+        store( forward, back, 2 * epsilon );
+        return;
+    }
+    params[i] = value;
+    store( forward, nominal, epsilon );
+}
+
+} // End of detail namespace
+
 /**
  * First thing we need is a generic idea of a measurement function or model function.
  * The model function needs to provide a way to evaluate h(x) as well as a way to 
@@ -94,23 +272,218 @@ class Least_Squares_Model_Base
             // Jacobian is #params x #outputs
             MatrixN<double> H( h0.size(), x.size() );
 
+            Numeric_Jacobian_Scratch<DomainT,decltype(h0)> scratch;
+            jacobian( x, h0, H, scratch );
+            return H;
+        }
+
+        /**
+         * In-place version of the numerical Jacobian.  h0 must hold h(x) and H must
+         * already be sized #outputs x #params.  Allocation free once the scratch
+         * buffers have been sized by a previous call, unless parallel evaluation is
+         * enabled in the jacobian options, which sizes one scratch per worker thread
+         * on every call.
+         *
+         * This is hidden by any jacobian() you define in your sub-class, which is how
+         * the solvers tell whether to use it or your analytic version.
+         *
+         * With a sparsity pattern in the jacobian options, columns are perturbed a group
+         * at a time.  See Jacobian_Sparsity.
+         */
+        template <typename DomainT,
+                  typename ResultT,
+                  typename JacobianT>
+        void jacobian( const DomainT&                             x,
+                       const ResultT&                             h0,
+                       JacobianT&                                 H,
+                       Numeric_Jacobian_Scratch<DomainT,ResultT>& scratch ) const
+        {
+            if( m_jacobian_options.sparsity )
+            {
+                // Entries outside the pattern are never written
+                for( size_t r = 0; r < H.rows(); r++ )
+                {
+                    for( size_t c = 0; c < H.cols(); c++ )
+                    {
+                        H( r, c ) = 0;
+                    }
+                }
+                jacobian_grouped( x, h0, H, *m_jacobian_options.sparsity, scratch );
+                return;
+            }
+
             /**
              * For each param dimension, add epsilon and re-evaluate h() to
              * get numerical derivative w.r.t. that parameter
              */
-            for( unsigned i=0; i<x.size(); ++i )
+            for_each_unknown( x.size(), x, scratch, [&]( size_t begin, size_t end, auto& local )
             {
-                DomainT xi = x;
+                for( size_t i = begin; i < end; i++ )
+                {
+                    jacobian_column( i, x, h0, H, local );
+                }
+            } );
+        }
+
+        /**
+         * As above, filling only the non-zeros of a sparse Jacobian, a column group
+         * at a time.  The pattern of H is used, not the one in the jacobian options.
+         */
+        template <typename DomainT,
+                  typename ResultT>
+        void jacobian( const DomainT&                             x,
+                       const ResultT&                             h0,
+                       Sparse_Jacobian&                           H,
+                       Numeric_Jacobian_Scratch<DomainT,ResultT>& scratch ) const
+        {
+            jacobian_grouped( x, h0, H, H.pattern(), scratch );
+        }
+
+        /**
+         * Get the numerical Jacobian configuration
+         */
+        const Numeric_Jacobian_Options& jacobian_options() const
+        {
+            return m_jacobian_options;
+        }
+
+        /**
+         * Set the numerical Jacobian configuration (difference formula, step size
+         * and parallel evaluation).  Has no effect if you define your own jacobian().
+         */
+        void set_jacobian_options( const Numeric_Jacobian_Options& options )
+        {
+            m_jacobian_options = options;
+        }
+
+        /**
+         * Get the parameterization of the domain, or null if it is Euclidean
+         */
+        const Local_Parameterization* parameterization() const
+        {
+            return m_parameterization;
+        }
+
+        /**
+         * Make the solvers step in the tangent space of a Local_Parameterization, e.g.
+         * 3 parameters per quaternion rather than 4.  Jacobians, numerical or your
+         * own, are then taken w.r.t. the tangent space.  Pass null to go back to the
+         * ambient space.  Must outlive its use by the model.
+         */
+        void set_parameterization( const Local_Parameterization* parameterization )
+        {
+            m_parameterization = parameterization;
+        }
 
-                // Variable step size, depending on parameter value
-                double epsilon = 1e-7 + std::fabs( xi(i) * 1e-7 );
-                xi(i) += epsilon;
+        /**
+         * Get the number of degrees of freedom of x
+         */
+        template <typename DomainT>
+        size_t tangent_size( const DomainT& x ) const
+        {
+            return m_parameterization ? m_parameterization->tangent_size() : x.size();
+        }
 
-                // Evaluate function with this step and compute the derivative w.r.t. parameter i
-                VectorN<double> hi = impl().operator()(xi);
-                select_col(H,i) = this->difference( hi, h0 ) / epsilon;
+        /**
+         * Get the number of model evaluations one numerical Jacobian at x makes, as
+         * jacobian_into() would compute it:  one or two (CENTRAL) per tangent direction
+         * with a parameterization, else per column group of a sparsity pattern, else per
+         * parameter.
+         */
+        template <typename DomainT>
+        size_t jacobian_evaluations( const DomainT& x ) const
+        {
+            size_t columns = x.size();
+            if( m_parameterization )
+            {
+                columns = m_parameterization->tangent_size();
+            }
+            else if( m_jacobian_options.sparsity )
+            {
+                columns = m_jacobian_options.sparsity->num_groups();
+            }
+            return columns * ( m_jacobian_options.difference == Difference_Method::CENTRAL ? 2 : 1 );
+        }
+
+        /**
+         * out = x [+] ( scale * delta ), with delta in the tangent space.  Plain
+         * addition unless a parameterization is set.
+         */
+        template <typename DomainT,
+                  typename DeltaT>
+        void retract( const DomainT& x,
+                      const DeltaT&  delta,
+                      double         scale,
+                      DomainT&       out ) const
+        {
+            if( m_parameterization )
+            {
+                m_parameterization->plus( x, delta, scale, out );
+                return;
+            }
+            for( size_t i = 0; i < x.size(); i++ )
+            {
+                out[i] = x[i] + scale * delta[i];
+            }
+        }
+
+        /**
+         * Evaluate h(x) into an existing result object.  Uses a method
+         * `void operator()( domain_type const& x, result_type& h ) const` if your
+         * sub-class provides one, which lets large problems avoid returning a fresh
+         * result every call.
+         */
+        template <typename DomainT,
+                  typename ResultT>
+        void evaluate( const DomainT& x,
+                       ResultT&       h ) const
+        {
+            if constexpr ( requires { impl()( x, h ); } )
+            {
+                impl()( x, h );
+            }
+            else
+            {
+                h = impl()( x );
+            }
+        }
+
+        /**
+         * Evaluate the Jacobian into an existing matrix, dispatching to, in order:
+         * - an in-place `jacobian( x, J )` defined by your sub-class,
+         * - the in-place numerical Jacobian above, if you did not define any jacobian(),
+         * - your by-value `jacobian( x )`.
+         *
+         * With a parameterization set, J is w.r.t. the tangent space and must be sized
+         * #outputs x tangent_size( x ).  Your Jacobian is converted to it; the numerical
+         * one perturbs along the tangent directions.
+         */
+        template <typename DomainT,
+                  typename ResultT,
+                  typename JacobianT>
+        void jacobian_into( const DomainT&                             x,
+                            const ResultT&                             h0,
+                            JacobianT&                                 J,
+                            Numeric_Jacobian_Scratch<DomainT,ResultT>& scratch ) const
+        {
+            if( m_parameterization )
+            {
+                tangent_jacobian_into( x, h0, J, scratch );
+                return;
+            }
+
+            if constexpr ( requires { impl().jacobian( x, J ); } )
+            {
+                impl().jacobian( x, J );
+            }
+            else if constexpr ( requires { impl().jacobian( x, h0, J, scratch ); } )
+            {
+                impl().jacobian( x, h0, J, scratch );
+            }
+            else
+            {
+                J = impl().jacobian( x );
             }
-            return H;
         }
 
         /**
@@ -126,6 +499,339 @@ class Least_Squares_Model_Base
             return ( a - b );
         }
 
+        /**
+         * In-place version of the default difference.  Hidden, like jacobian(), if
+         * your sub-class defines its own difference().
+         */
+        template <class T>
+        void difference( const T& a,
+                         const T& b,
+                         T&       out ) const
+        {
+            detail::set_vector_size( out, a.size() );
+            for( size_t i = 0; i < a.size(); i++ )
+            {
+                out[i] = a[i] - b[i];
+            }
+        }
+
+        /**
+         * Compute difference( a, b ) into an existing object, using your in-place
+         * difference( a, b, out ) if defined, else your by-value difference( a, b ).
+         */
+        template <class T>
+        void difference_into( const T& a,
+                              const T& b,
+                              T&       out ) const
+        {
+            if constexpr ( requires { impl().difference( a, b, out ); } )
+            {
+                impl().difference( a, b, out );
+            }
+            else
+            {
+                out = impl().difference( a, b );
+            }
+        }
+
+    private:
+
+        /**
+         * Jacobian w.r.t. the tangent space of the parameterization
+         */
+        template <typename DomainT,
+                  typename ResultT,
+                  typename JacobianT>
+        void tangent_jacobian_into( const DomainT&                             x,
+                                    const ResultT&                             h0,
+                                    JacobianT&                                 J,
+                                    Numeric_Jacobian_Scratch<DomainT,ResultT>& scratch ) const
+        {
+            const size_t num_tangent = m_parameterization->tangent_size();
+            if( m_parameterization->ambient_size() != x.size() )
+            {
+                std::stringstream sout;
+                sout << "Least_Squares_Model_Base: parameterization of " << m_parameterization->ambient_size()
+                     << " parameters given for " << x.size();
+                throw std::runtime_error( sout.str() );
+            }
+
+            // Your own Jacobian, chained with the derivative of x [+] delta
+            if constexpr ( !requires { impl().jacobian( x, h0, J, scratch ); } )
+            {
+                auto& J_ambient = scratch.ambient_jacobian;
+                detail::set_matrix_size( J_ambient, h0.size(), x.size() );
+                if constexpr ( requires { impl().jacobian( x, J_ambient ); } )
+                {
+                    impl().jacobian( x, J_ambient );
+                }
+                else
+                {
+                    const auto J_model = impl().jacobian( x );
+                    for( size_t r = 0; r < h0.size(); r++ )
+                    {
+                        for( size_t c = 0; c < x.size(); c++ )
+                        {
+                            J_ambient( r, c ) = J_model( r, c );
+                        }
+                    }
+                }
+
+                m_parameterization->plus_jacobian( x, scratch.plus_jacobian );
+                for( size_t r = 0; r < h0.size(); r++ )
+                {
+                    for( size_t c = 0; c < num_tangent; c++ )
+                    {
+                        double value = 0;
+                        for( size_t k = 0; k < x.size(); k++ )
+                        {
+                            value += J_ambient( r, k ) * scratch.plus_jacobian( k, c );
+                        }
+                        J( r, c ) = value;
+                    }
+                }
+                return;
+            }
+
+            // Numerical, stepping along each tangent direction
+            for_each_unknown( num_tangent, x, scratch, [&]( size_t begin, size_t end, auto& local )
+            {
+                detail::set_vector_size( local.tangent_step, num_tangent );
+                local.tangent_step.fill( 0 );
+                for( size_t i = begin; i < end; i++ )
+                {
+                    double epsilon = m_jacobian_options.step_size( 0 );
+                    local.tangent_step[i] = epsilon;
+
+                    m_parameterization->plus( x, local.tangent_step, 1, local.x_step );
+                    evaluate( local.x_step, local.h_step );
+                    if( m_jacobian_options.difference == Difference_Method::CENTRAL )
+                    {
+                        m_parameterization->plus( x, local.tangent_step, -1, local.x_step );
+                        evaluate( local.x_step, local.h_back );
+                        difference_into( local.h_step, local.h_back, local.delta );
+                        epsilon *= 2;
+                    }
+                    else
+                    {
+                        difference_into( local.h_step, h0, local.delta );
+                    }
+
+                    for( size_t r = 0; r < h0.size(); r++ )
+                    {
+                        J( r, i ) = local.delta[r] / epsilon;
+                    }
+                    local.tangent_step[i] = 0;
+                }
+            } );
+        }
+
+        /**
+         * Numerical Jacobian perturbing each column group of a sparsity pattern at once
+         */
+        template <typename DomainT,
+                  typename ResultT,
+                  typename JacobianT>
+        void jacobian_grouped( const DomainT&                             x,
+                               const ResultT&                             h0,
+                               JacobianT&                                 H,
+                               const Jacobian_Sparsity&                   pattern,
+                               Numeric_Jacobian_Scratch<DomainT,ResultT>& scratch ) const
+        {
+            if( pattern.cols() != x.size() || pattern.rows() != h0.size() )
+            {
+                std::stringstream sout;
+                sout << "Least_Squares_Model_Base: " << pattern.rows() << " x " << pattern.cols()
+                     << " sparsity pattern given for a " << h0.size() << " x " << x.size() << " Jacobian";
+                throw std::runtime_error( sout.str() );
+            }
+
+            for_each_unknown( pattern.num_groups(), x, scratch, [&]( size_t begin, size_t end, auto& local )
+            {
+                for( size_t g = begin; g < end; g++ )
+                {
+                    jacobian_group( g, x, h0, H, pattern, local );
+                }
+            } );
+        }
+
+        /**
+         * Call fill( begin, end, scratch ) over [0,count) columns or column groups, with
+         * scratch.x_step set to x.  With parallel evaluation each worker thread creates
+         * one scratch of its own and keeps it for every range it claims; nothing mutable
+         * is shared besides the disjoint columns being filled.  Otherwise the caller's
+         * scratch is used.
+         */
+        template <typename DomainT,
+                  typename ResultT,
+                  typename FillT>
+        void for_each_unknown( size_t                                     count,
+                               const DomainT&                             x,
+                               Numeric_Jacobian_Scratch<DomainT,ResultT>& scratch,
+                               const FillT&                               fill ) const
+        {
+            if( m_jacobian_options.parallel && count > 1 )
+            {
+                auto& pool = m_jacobian_options.pool ? *m_jacobian_options.pool
+                                                     : parallel::Thread_Pool::global();
+                parallel::parallel_for_with_state( 0, count, 1,
+                                                   [&]()
+                                                   {
+                                                       Numeric_Jacobian_Scratch<DomainT,ResultT> local;
+                                                       local.x_step = x;
+                                                       return local;
+                                                   },
+                                                   [&]( Numeric_Jacobian_Scratch<DomainT,ResultT>& local,
+                                                        size_t                                     begin,
+                                                        size_t                                     end )
+                                                   {
+                                                       fill( begin, end, local );
+                                                   },
+                                                   pool );
+                return;
+            }
+
+            scratch.x_step = x;
+            fill( 0, count, scratch );
+        }
+
+        /**
+         * Fill the columns of group g of the numerical Jacobian.  scratch.x_step must
+         * equal x on entry and is restored on exit.
+         */
+        template <typename DomainT,
+                  typename ResultT,
+                  typename JacobianT>
+        void jacobian_group( size_t                                     g,
+                             const DomainT&                             x,
+                             const ResultT&                             h0,
+                             JacobianT&                                 H,
+                             const Jacobian_Sparsity&                   pattern,
+                             Numeric_Jacobian_Scratch<DomainT,ResultT>& scratch ) const
+        {
+            const auto columns = pattern.group( g );
+            const bool central = m_jacobian_options.difference == Difference_Method::CENTRAL;
+
+            for( auto c : columns )
+            {
+                scratch.x_step(c) = x(c) + m_jacobian_options.step_size( x(c) );
+            }
+            evaluate( scratch.x_step, scratch.h_step );
+            if( central )
+            {
+                for( auto c : columns )
+                {
+                    scratch.x_step(c) = x(c) - m_jacobian_options.step_size( x(c) );
+                }
+                evaluate( scratch.x_step, scratch.h_back );
+                difference_into( scratch.h_step, scratch.h_back, scratch.delta );
+            }
+            else
+            {
+                difference_into( scratch.h_step, h0, scratch.delta );
+            }
+
+            // Each row of the group's columns was moved by only one of them
+            for( auto c : columns )
+            {
+                const double epsilon = m_jacobian_options.step_size( x(c) ) * ( central ? 2 : 1 );
+                const auto rows = pattern.column( c );
+                for( size_t k = 0; k < rows.size(); k++ )
+                {
+                    if constexpr ( std::is_same_v<JacobianT,Sparse_Jacobian> )
+                    {
+                        H.values()[pattern.column_offset( c ) + k] = scratch.delta[rows[k]] / epsilon;
+                    }
+                    else
+                    {
+                        H( rows[k], c ) = scratch.delta[rows[k]] / epsilon;
+                    }
+                }
+                scratch.x_step(c) = x(c);
+            }
+        }
+
+        /**
+         * Fill column i of the numerical Jacobian.  scratch.x_step must equal x on
+         * entry and is restored on exit.
+         */
+        template <typename DomainT,
+                  typename ResultT,
+                  typename JacobianT>
+        void jacobian_column( size_t                                     i,
+                              [[maybe_unused]] const DomainT&            x,
+                              const ResultT&                             h0,
+                              JacobianT&                                 H,
+                              Numeric_Jacobian_Scratch<DomainT,ResultT>& scratch ) const
+        {
+            detail::difference_parameter( m_jacobian_options, scratch.x_step, i, h0,
+                                          scratch.h_step, scratch.h_back,
+                                          [&]( const DomainT& x_step, ResultT& out )
+                                          {
+                                              evaluate( x_step, out );
+                                          },
+                                          [&]( const ResultT& forward, const ResultT& base, double epsilon )
+                                          {
+                                              difference_into( forward, base, scratch.delta );
+                                              for( size_t r = 0; r < h0.size(); r++ )
+                                              {
+                                                  H( r, i ) = scratch.delta[r] / epsilon;
+                                              }
+                                          } );
+        }
+
+        /// @brief Numerical Jacobian configuration
+        Numeric_Jacobian_Options m_jacobian_options;
+
+        /// @brief Manifold structure of the domain, or null if Euclidean
+        const Local_Parameterization* m_parameterization { nullptr };
+
 }; // End of Least_Squares_Model_Base
 
+/**
+ * Discover the sparsity of a model's Jacobian by evaluating it at x and at a second,
+ * nearby point, keeping every entry non-zero at either.  An entry which happens to
+ * vanish at both points is missed, so probe away from special values such as zero.
+ * Probe before setting a sparsity on the model, or only its entries are found.
+ */
+template <typename ImplT,
+          typename DomainT>
+Jacobian_Sparsity probe_jacobian_sparsity( const Least_Squares_Model_Base<ImplT>& model,
+                                           const DomainT&                         x )
+{
+    using result_type = typename ImplT::result_type;
+
+    result_type h0;
+    typename ImplT::jacobian_type J;
+    Numeric_Jacobian_Scratch<DomainT,result_type> scratch;
+    std::vector<std::pair<size_t,size_t>> entries;
+
+    DomainT point = x;
+    for( int probe = 0; probe < 2; probe++ )
+    {
+        if( probe == 1 )
+        {
+            for( size_t i = 0; i < point.size(); i++ )
+            {
+                point[i] = x[i] + ( i % 2 == 0 ? 1e-3 : -1e-3 ) * ( 1 + std::fabs( x[i] ) );
+            }
+        }
+
+        model.evaluate( point, h0 );
+        detail::set_matrix_size( J, h0.size(), point.size() );
+        model.jacobian_into( point, h0, J, scratch );
+        for( size_t r = 0; r < h0.size(); r++ )
+        {
+            for( size_t c = 0; c < point.size(); c++ )
+            {
+                if( J( r, c ) != 0 )
+                {
+                    entries.emplace_back( r, c );
+                }
+            }
+        }
+    }
+    return Jacobian_Sparsity( h0.size(), x.size(), entries );
+}
+
 } // End of tmns::math::optimize
\ No newline at end of file
@@ -6,10 +6,18 @@
 #pragma once
 
 // Terminus Libraries
+#include <terminus/core/error/ErrorCategory.hpp>
+#include <terminus/math/linalg/Cholesky.hpp>
 #include <terminus/math/linalg/Solvers.hpp>
 #include <terminus/math/matrix/Matrix_Operations.hpp>
 #include <terminus/math/optimization/Least_Squares_Model_Base.hpp>
 #include <terminus/math/optimization/LM_Enums.hpp>
+#include <terminus/math/optimization/LM_Step_Control.hpp>
+#include <terminus/math/optimization/LM_Workspace.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
 
 namespace tmns::math::optimize {
 
@@ -39,10 +47,126 @@ namespace tmns::math::optimize {
 #define MATH_LM_REL_TOL (1e-16)
 #define MATH_LM_MAX_ITER (100)
 
+namespace detail {
+
+/// @brief Range a warm-started damping is clamped to, so a long previous solve
+///        cannot leave it vanishingly small or large
+static constexpr double LM_WARM_LAMBDA_MIN = 1e-10;
+static constexpr double LM_WARM_LAMBDA_MAX = 1e10;
+
+/**
+ * Broyden rank-1 update of the Jacobian J and Gauss-Newton Hessian H = scale * J^T J
+ * after a step s which changed the model output by y.
+ *
+ * J becomes J + u s^T with u = ( y - J s ) / s^T s.  H receives the matching terms
+ * scale * ( v s^T + s v^T + (u^T u) s s^T ), with v = J^T u, so the normal equations
+ * stay consistent in O(n^2) rather than O(m n^2).  Takes the solver's delta_x, which
+ * is -s, and overwrites output_change with u and scratch with v.
+ */
+template <typename JacobianT,
+          typename HessianT,
+          typename StepT,
+          typename ChangeT,
+          typename ScratchT>
+void broyden_update( JacobianT&   J,
+                     HessianT&    hessian,
+                     const StepT& delta_x,
+                     ChangeT&     output_change,
+                     ScratchT&    scratch,
+                     double       scale )
+{
+    const size_t rows = J.rows();
+    const size_t cols = J.cols();
+
+    double step_sq = 0;
+    for( size_t c = 0; c < cols; c++ )
+    {
+        step_sq += delta_x[c] * delta_x[c];
+    }
+    if( !( step_sq > 0 ) )
+    {
+        return;
+    }
+
+    // u = ( y - J s ) / s^T s
+    double u_sq = 0;
+    for( size_t r = 0; r < rows; r++ )
+    {
+        double J_s = 0;
+        for( size_t c = 0; c < cols; c++ )
+        {
+            J_s -= J( r, c ) * delta_x[c];
+        }
+        output_change[r] = ( output_change[r] - J_s ) / step_sq;
+        u_sq += output_change[r] * output_change[r];
+    }
+
+    // v = J^T u, using the Jacobian before the update
+    for( size_t c = 0; c < cols; c++ )
+    {
+        double value = 0;
+        for( size_t r = 0; r < rows; r++ )
+        {
+            value += J( r, c ) * output_change[r];
+        }
+        scratch[c] = value;
+    }
+
+    for( size_t r = 0; r < rows; r++ )
+    {
+        for( size_t c = 0; c < cols; c++ )
+        {
+            J( r, c ) -= output_change[r] * delta_x[c];
+        }
+    }
+
+    for( size_t a = 0; a < cols; a++ )
+    {
+        for( size_t b = 0; b < cols; b++ )
+        {
+            hessian( a, b ) += scale * ( u_sq * delta_x[a] * delta_x[b]
+                                         - scratch[a] * delta_x[b]
+                                         - delta_x[a] * scratch[b] );
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Levenberg-Marquardt using caller-owned storage.  The workspace is sized from the
+ * seed and observation, and every buffer the iterations need lives inside it, so
+ * repeated solves with the same workspace perform no heap allocation once it has
+ * been sized.  To keep the model evaluations allocation-free as well, give your
+ * model an in-place `void operator()( domain_type const& x, result_type& h ) const`
+ * and, optionally, an in-place `void jacobian( domain_type const& x, jacobian_type& J ) const`.
+ *
+ * With set_jacobian_update() on the workspace, the Jacobian can be carried between
+ * iterations by Broyden rank-1 updates, recomputing it only every few iterations or
+ * when progress stalls.  workspace.jacobian_statistics() reports the evaluations saved.
+ *
+ * With set_warm_start() on the workspace, a solve can begin from the damping and
+ * Jacobian the previous solve with that workspace finished with.  See LM_Solver.
+ *
+ * Progress goes to terminus_log at debug and trace level, unless turned off with
+ * set_lm_log_level().  For telemetry, set an observer on the workspace; it receives
+ * an LM_Iteration_Info after each outer iteration.
+ * A cancel check set on the workspace can stop the solve after any outer iteration,
+ * returning the parameters reached so far with LM_STATUS_CODE::ERROR_CANCELLED.
+ *
+ * With set_keep_factorization() on the workspace, the solve ends by factoring J^T J
+ * at the solution, from which LM_Covariance.hpp extracts parameter covariances.
+ *
+ * If the model has a Local_Parameterization, steps are taken in its tangent space and
+ * applied with x [+] delta, so rotations stay rotations.  The domain must then be
+ * dynamically sized.  Fails with INVALID_INPUT if the parameterization does not match
+ * the seed, or the residual at the seed is not finite.
+ */
 template <typename ImplT>
 ImageResult<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Model_Base<ImplT>& least_squares_model,
                                                               const typename ImplT::domain_type&     seed,
                                                               const typename ImplT::result_type&     observation,
+                                                              LM_Workspace<ImplT>&                   workspace,
                                                               LM_STATUS_CODE&                        status,
                                                               double                                 abs_tolerance  = MATH_LM_ABS_TOL,
                                                               double                                 rel_tolerance  = MATH_LM_REL_TOL,
@@ -51,171 +175,332 @@ ImageResult<typename ImplT::domain_type> levenberg_marquardt( const Least_Square
     // Initialize the status
     status = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
 
-    const ImplT& model = least_squares_model.impl();
-    bool   done   = false;
-    double Rinv   = 10;
-    double lambda = 0.1;
+    double Rinv         = 10;
+    double lambda_start = 0.1;
 
-    typename ImplT::domain_type x_try, x = seed;
-    typename ImplT::result_type h        = model(x);
-    typename ImplT::result_type error    = model.difference(observation, h);
-    double norm_start = error.magnitude();
+    // Steps live in the tangent space of the parameters
+    const auto* parameterization = least_squares_model.parameterization();
+    if( parameterization && parameterization->ambient_size() != seed.size() )
+    {
+        status = LM_STATUS_CODE::ERROR_STATUS_UNKNOWN;
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "levenberg_marquardt: parameterization does not match the seed size" );
+    }
+    const size_t num_params = least_squares_model.tangent_size( seed );
+    if( LM_Workspace<ImplT>::PARAMS_N != 0 && num_params != seed.size() )
+    {
+        status = LM_STATUS_CODE::ERROR_STATUS_UNKNOWN;
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "levenberg_marquardt: a parameterization needs a dynamically sized domain" );
+    }
 
-    tmns::log::debug( "LM: initial guess for the model is ", seed.to_log_string() );
-    tmns::log::trace( "LM: starting error ", error.to_log_string() );
-    tmns::log::debug( "LM: starting norm is: ", norm_start );
+    workspace.resize( seed.size(), observation.size(), num_params );
+    workspace.set_normal_factor_valid( false );
+    auto& x         = workspace.x();
+    auto& x_try     = workspace.x_try();
+    auto& h         = workspace.h();
+    auto& error     = workspace.error();
+    auto& h_try     = workspace.h_try();
+    auto& error_try = workspace.error_try();
+    auto& J         = workspace.jacobian();
+    auto& del_J     = workspace.gradient();
+    auto& hessian   = workspace.hessian();
+    auto& hessian_lm = workspace.factor();
+    auto& diagonal  = workspace.diagonal();
+    auto& delta_x   = workspace.step();
+
+    // Jacobian refresh strategy
+    const auto& update = workspace.jacobian_update();
+    auto& statistics   = workspace.jacobian_statistics();
+    statistics = LM_Jacobian_Statistics();
+    const size_t evaluations_per_jacobian = least_squares_model.jacobian_evaluations( seed );
+    bool have_jacobian  = false;
+    bool force_refresh  = false;
+    bool last_accepted  = false;
+    int  jacobian_age   = 0;
+
+    // Carry over from the previous solve
+    const auto& warm_start = workspace.warm_start();
+    if( warm_start.damping )
+    {
+        lambda_start = std::clamp( workspace.lambda(), detail::LM_WARM_LAMBDA_MIN, detail::LM_WARM_LAMBDA_MAX );
+    }
+    bool reuse_jacobian = warm_start.jacobian && workspace.jacobian_valid();
 
-    // Solution may already be good enough
-    if( norm_start < abs_tolerance )
+    // Phase timings are only taken for an observer
+    const auto& observer = workspace.observer();
+    const auto& cancel   = workspace.cancel();
+    detail::LM_Phase_Timer timer( static_cast<bool>( observer ) );
+    LM_Iteration_Info info;
+
+    x = seed;
+    least_squares_model.evaluate( x, h );
+    least_squares_model.difference_into( observation, h, error );
+    detail::LM_Step_Control control( error.magnitude(), abs_tolerance, rel_tolerance, max_iterations, "LM", lambda_start );
+
+    // A NaN or infinite residual gives no direction to search in, and no trial could beat it
+    if( !std::isfinite( control.norm_start() ) )
     {
-        status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
-        tmns::log::debug( "CONVERGED TO ABSOLUTE TOLERANCE" );
-        done = true;
+        status = LM_STATUS_CODE::ERROR_STATUS_UNKNOWN;
+        workspace.set_iterations( 0 );
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "levenberg_marquardt: residual at the seed is not finite" );
     }
 
-    int outer_iter = 0;
+    detail::lm_debug( "LM: solving for ", num_params, " parameters from ", observation.size(), " observations" );
+    detail::lm_debug( "LM: starting norm is: ", control.norm_start() );
+
+    // Solution may already be good enough
+    bool done = control.converged_at_start( status );
     while( !done )
     {
-        bool shortCircuit = false;
-        outer_iter++;
-        tmns::log::debug( "LM: outer iteration ", outer_iter, "   x = ", x.to_log_string() );
+        info = LM_Iteration_Info();
 
         // Compute the value, derivative, and hessian of the cost function
         // at the current point.  These remain valid until the parameter
         // vector changes.
 
         // expected measurement with new x
-        h = model(x);
+        timer.start();
+        least_squares_model.evaluate( x, h );
 
         // Difference between observed and predicted and error (2-norm of difference)
-        error = model.difference( observation, h );
-        norm_start = error.magnitude();
-        tmns::log::debug( "LM: outer iteration starting robust norm: ", norm_start );
-
-        // Measurement Jacobian
-        typename ImplT::jacobian_type J = model.jacobian(x);
+        least_squares_model.difference_into( observation, h, error );
+        control.start_iteration( error.magnitude() );
+        timer.stop( info.model_time );
+        info.iteration = control.outer_iterations();
+        detail::lm_debug( "LM: outer iteration ", info.iteration, " starting robust norm: ", control.norm_start() );
+
+        // Measurement Jacobian, recomputed or carried forward by a Broyden update
+        const bool use_broyden = update.method == Jacobian_Update_Method::BROYDEN &&
+                                 have_jacobian && last_accepted && !force_refresh &&
+                                 jacobian_age < update.refresh_interval;
+        const bool use_previous = reuse_jacobian;
+        reuse_jacobian = false;
+        timer.start();
+        if( use_broyden )
+        {
+            detail::broyden_update( J, hessian, delta_x, workspace.output_change(),
+                                    workspace.update_scratch(), Rinv );
+            jacobian_age++;
+            statistics.broyden_updates++;
+            statistics.evaluations_saved += evaluations_per_jacobian;
+        }
+        else if( use_previous )
+        {
+            have_jacobian = true;
+            jacobian_age  = 1;
+            statistics.reused++;
+            statistics.evaluations_saved += evaluations_per_jacobian;
+        }
+        else
+        {
+            least_squares_model.jacobian_into( x, h, J, workspace.scratch() );
+            have_jacobian = true;
+            force_refresh = false;
+            jacobian_age  = 1;
+            statistics.recomputed++;
+        }
+        timer.stop( info.jacobian_time );
+        info.broyden_update = use_broyden;
 
-        VectorN<double> del_J = -1.0 * Rinv * (transpose(J) * error);
+        // Gradient and Hessian of cost function (using Gauss-Newton approximation),
+        // accumulated directly so no J^T temporaries are formed
+        timer.start();
+        for( size_t c = 0; c < num_params; c++ )
+        {
+            double value = 0;
+            for( size_t r = 0; r < error.size(); r++ )
+            {
+                value += J( r, c ) * error[r];
+            }
+            del_J[c] = -1.0 * Rinv * value;
 
-        // Hessian of cost function (using Gauss-Newton approximation)
-        MatrixN<double> hessian = Rinv * ( transpose( J ) * J );
+            // A Broyden update already adjusted the Hessian
+            for( size_t k = 0; !use_broyden && k <= c; k++ )
+            {
+                double hvalue = 0;
+                for( size_t r = 0; r < error.size(); r++ )
+                {
+                    hvalue += J( r, c ) * J( r, k );
+                }
+                hessian( c, k ) = Rinv * hvalue;
+                hessian( k, c ) = Rinv * hvalue;
+            }
+            diagonal[c] = hessian( c, c );
+        }
+        timer.stop( info.solve_time );
 
-        int64_t iterations = 0;
-        double norm_try = norm_start + 1.0;
-        while( norm_try > norm_start )
+        while( control.searching() )
         {
             // Increase diagonal elements to dynamically mix gradient
             // descent and Gauss-Newton.
-            Matrix<double> hessian_lm = hessian;
-            for( unsigned i = 0; i < hessian_lm.rows(); ++i )
+            const double lambda = control.lambda();
+            timer.start();
+            hessian_lm = hessian;
+            for( unsigned i = 0; i < num_params; ++i )
             {
-                hessian_lm(i,i) += hessian_lm(i,i)*lambda + lambda;
+                hessian_lm(i,i) = diagonal[i] + diagonal[i]*lambda + lambda;
             }
 
-            // Solve for update
-            typename ImplT::domain_type delta_x;
-            if( hessian_lm.rows() <= 2 && hessian_lm.determinant() > 0.0 )
+            // Solve for update.  By construction, hessian_lm is symmetric and positive-definite.
+            delta_x = del_J;
+            if( linalg::cholesky_decompose( hessian_lm ) )
             {
-                // Direct method is more efficient for small matrices, also
-                // here we avoid calling LAPACK which we've seen misbehave
-                // in this situation in a multi-threaded environment.
-                delta_x = hessian_lm.inverse() * del_J;
+                linalg::cholesky_solve( hessian_lm, delta_x );
             }
             else
             {
-                try
+                // If lambda is very small, the matrix becomes numerically
+                // singular. In that case use the more general solver.
+                hessian_lm = hessian;
+                for( unsigned i = 0; i < num_params; ++i )
                 {
-                    // By construction, hessian_lm is symmetric and positive-definite.
-                    auto solve_res = linalg::solve_symmetric( hessian_lm, del_J );
-                    delta_x = solve_res.value();
+                    hessian_lm(i,i) = diagonal[i] + diagonal[i]*lambda + lambda;
                 }
-                catch ( const std::exception& e )
+                auto solve_res = linalg::solve( MatrixN<double>( hessian_lm ),
+                                                VectorN<double>( del_J ) );
+                if( solve_res.has_error() )
                 {
-                    // If lambda is very small, the matrix becomes numerically
-                    // singular. In that case use the more general least_squares solver.
-                    auto solve_res = linalg::solve( hessian_lm, del_J );
-                    if( solve_res.has_error() )
-                    {
-                        return solve_res.error();
-                    }
-                    delta_x = solve_res.value();
+                    timer.stop( info.solve_time );
+                    status = LM_STATUS_CODE::ERROR_SOLVE_FAILED;
+                    workspace.set_iterations( control.outer_iterations() );
+                    return solve_res.error();
                 }
+                delta_x = solve_res.value();
             }
+            timer.stop( info.solve_time );
 
             // update parameter vector
-            x_try = x - delta_x;
+            least_squares_model.retract( x, delta_x, -1.0, x_try );
 
-            typename ImplT::result_type h_try = model(x_try);
+            timer.start();
+            least_squares_model.evaluate( x_try, h_try );
+            least_squares_model.difference_into( observation, h_try, error_try );
+            const double norm_try = error_try.magnitude();
+            timer.stop( info.model_time );
 
-            typename ImplT::result_type error_try = model.difference(observation, h_try);
-            norm_try = error_try.magnitude();
+            detail::lm_trace( "\tLM: inner iteration ", control.inner_iterations(), " norm is ", norm_try );
 
-            tmns::log::debug( ADD_CURRENT_LOC(), "LM: inner iteration ", iterations, " error is ", error_try.to_log_string() );
-            tmns::log::trace( ADD_CURRENT_LOC(), "\tLM: inner iteration ", iterations, " norm is ", norm_try );
+            info.lambda   = lambda;
+            info.norm_try = norm_try;
+            control.record_trial( norm_try );
+        }
 
-            if( norm_try > norm_start )
-            {
-                // Increase lambda and try again
-                lambda *= 10;
-            }
+        // A poor step from an updated or reused Jacobian says little about
+        // convergence, so retry with a fresh one before judging.
+        const bool stalled = ( use_broyden || use_previous ) &&
+                             ( !control.accepted() || control.progress() < update.stall_tolerance );
+        if( stalled )
+        {
+            force_refresh = true;
+        }
+        done = control.check_convergence( status, !stalled );
 
-            ++iterations; // Sanity check on iterations in this loop
-            if( iterations > 5 )
+        // Take trial parameters as new parameters
+        // If we short-circuited the inner loop, then we didn't actually find a
+        // better p, so don't update it.
+        if( control.accepted() )
+        {
+            if( update.method == Jacobian_Update_Method::BROYDEN )
             {
-                tmns::log::debug( "\n****LM: too many inner iterations - short circuiting" );
-                shortCircuit = true;
-                norm_try     = norm_start;
+                auto& output_change = workspace.output_change();
+                for( size_t r = 0; r < h.size(); r++ )
+                {
+                    output_change[r] = h_try[r] - h[r];
+                }
             }
-            tmns::log::debug( "\tlambda = ", lambda );
+            x = x_try;
         }
+        last_accepted = control.accepted();
 
-        // Percentage change convergence criterion. Only if we did not do a short-circuit,
-        // as in that case the solution did not improve.
-        if( !shortCircuit && ( ( norm_start - norm_try ) / norm_start ) < rel_tolerance )
+        info.inner_iterations = control.inner_iterations();
+        info.norm_start       = control.norm_start();
+        info.accepted         = control.accepted();
+        if( observer )
         {
-            status = LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE;
-            tmns::log::debug( "CONVERGED TO RELATIVE TOLERANCE" );
-            done = true;
+            observer( info );
         }
 
-        // Absolute error convergence criterion
-        if( norm_try < abs_tolerance )
+        // Give up early if asked to
+        if( !done && cancel && cancel( info ) )
         {
-            status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
-            tmns::log::debug( "CONVERGED TO ABSOLUTE TOLERANCE" );
+            status = LM_STATUS_CODE::ERROR_CANCELLED;
+            detail::lm_debug( "LM: cancelled after outer iteration ", info.iteration );
             done = true;
         }
 
-        // Max iterations convergence criterion
-        if( outer_iter >= max_iterations )
-        {
-            tmns::log::debug( "REACHED MAX ITERATIONS!" );
-            done = true;
-        }
+        // Take trial error as new error, and decrease lambda
+        control.finish_iteration();
+    }
+    detail::lm_debug( "LM: finished with: ", control.outer_iterations() );
 
-        // Take trial parameters as new parameters
-        // If we short-circuited the inner loop, then we didn't actually find a
-        // better p, so don't update it.
-        if( !shortCircuit )
+    // Relinearize at the solution and factor J^T J for covariance queries
+    if( workspace.keep_factorization() )
+    {
+        least_squares_model.evaluate( x, h );
+        least_squares_model.difference_into( observation, h, error );
+        least_squares_model.jacobian_into( x, h, J, workspace.scratch() );
+        statistics.recomputed++;
+        have_jacobian = true;
+
+        auto& normal_factor = workspace.normal_factor();
+        detail::set_matrix_size( normal_factor, num_params, num_params );
+        for( size_t c = 0; c < num_params; c++ )
         {
-            x = x_try;
+            for( size_t k = c; k < num_params; k++ )
+            {
+                double value = 0;
+                for( size_t r = 0; r < error.size(); r++ )
+                {
+                    value += J( r, k ) * J( r, c );
+                }
+                normal_factor( k, c ) = value;
+            }
         }
+        workspace.set_normal_factor_valid( linalg::cholesky_decompose( normal_factor ) );
+    }
 
-        // Take trial error as new error
-        norm_start = norm_try;
-
-        // Decrease lambda
-        lambda /= 10;
-        tmns::log::debug( "lambda = ", lambda, "\nLM: end of outer iteration ",
-                          outer_iter, " with error ", norm_try );
+    workspace.set_iterations( control.outer_iterations() );
+    workspace.set_lambda( control.lambda() );
+    if( have_jacobian )
+    {
+        workspace.set_jacobian_valid( true );
     }
-    tmns::log::debug( "LM: finished with: ", outer_iter );
     return x;
 } // End levenberg_marquardt
 
+/**
+ * Levenberg-Marquardt with a temporary workspace.  Prefer the workspace overload
+ * when solving many problems of the same size.
+ */
+template <typename ImplT>
+ImageResult<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Model_Base<ImplT>& least_squares_model,
+                                                              const typename ImplT::domain_type&     seed,
+                                                              const typename ImplT::result_type&     observation,
+                                                              LM_STATUS_CODE&                        status,
+                                                              double                                 abs_tolerance  = MATH_LM_ABS_TOL,
+                                                              double                                 rel_tolerance  = MATH_LM_REL_TOL,
+                                                              double                                 max_iterations = MATH_LM_MAX_ITER)
+{
+    LM_Workspace<ImplT> workspace( seed.size(), observation.size() );
+    return levenberg_marquardt( least_squares_model,
+                                seed,
+                                observation,
+                                workspace,
+                                status,
+                                abs_tolerance,
+                                rel_tolerance,
+                                max_iterations );
+} // End levenberg_marquardt
+
 
 /**
  * As the similar class above, but with fixed matrix sizes and no logging.
+ *
+ * The domain_type and result_type of your sub-class must be Vector_<double,NI> and
+ * Vector_<double,NO>.  Define `jacobian( x )` returning a Matrix<double,NO,NI> to
+ * replace the numerical Jacobian.
  */
 template <typename ImplT,
           int      NI,
@@ -224,6 +509,9 @@ class Least_Squares_Model_Base_Fixed
 {
     public:
 
+        /// @brief Jacobian type
+        using jacobian_type = Matrix<double,NO,NI>;
+
         /**
          * Access the underlying type
          */
@@ -240,40 +528,43 @@ class Least_Squares_Model_Base_Fixed
             return static_cast<ImplT const&>( *this );
         }
 
+        /**
+         * Numerical Jacobian dh/dx at x
+         */
         template <class DomainT>
         Matrix<double, NO, NI> jacobian( DomainT const& x ) const
         {
-            // Get nominal function value
-            //std::cout << "x; = " << x << std::endl;
-            //std::cout << "impl().operator()(x); = " << impl().operator()(x) << std::endl;
-            Vector_<double, NO> h0 = impl().operator()(x);
-            //Vector<double> h0 = impl().operator()(x);
-            //std::cout << "h0 = " << h0 << std::endl;
-
-            // Jacobian is #params x #outputs
-            Matrix<double, NO, NI> H( h0.size(), x.size() );
-            //Matrix<double> H(h0.size(), x.size());
-            //std::cout << "H = " << H << std::endl;
+            Matrix<double, NO, NI> H;
+            jacobian( x, impl()( x ), H );
+            return H;
+        }
 
+        /**
+         * Numerical Jacobian dh/dx at x, given h0 = h(x), written into H
+         */
+        template <class DomainT,
+                  class ResultT>
+        void jacobian( DomainT const&          x,
+                       ResultT const&          h0,
+                       Matrix<double, NO, NI>& H ) const
+        {
             // For each param dimension, add epsilon and re-evaluate h() to
             // get numerical derivative w.r.t. that parameter
-            Vector_<double, NO> hi;
-            for( unsigned i = 0; i < x.size(); ++i )
+            DomainT xi = x;
+            for( size_t i = 0; i < NI; ++i )
             {
-                DomainT xi = x;
-
                 // Variable step size, depending on parameter value
-                double epsilon = 1e-7 + fabs(xi(i)*1e-7);
-                xi(i) += epsilon;
+                double epsilon = 1e-7 + std::fabs( x[i] * 1e-7 );
+                xi[i] = x[i] + epsilon;
 
                 // Evaluate function with this step and compute the derivative w.r.t. parameter i
-                hi = impl().operator()(xi);
-                //Vector<double> hi = impl().operator()(xi);
-                //std::cout << "hi = " << hi << std::endl;
-                select_col(H,i) = this->difference(hi,h0)/epsilon;
+                const ResultT delta = impl().difference( impl()( xi ), h0 );
+                for( size_t r = 0; r < NO; ++r )
+                {
+                    H( r, i ) = delta[r] / epsilon;
+                }
+                xi[i] = x[i];
             }
-            //std::cout << "H = " << H << std::endl;
-            return H;
         }
 
         template <class T>
@@ -286,7 +577,9 @@ class Least_Squares_Model_Base_Fixed
 
 
 /**
- * As the similar function above, but with a fixed, square matrix size.
+ * As the similar function above, but with fixed matrix sizes.  J, J^T J and the
+ * update solve all live on the stack, and nothing is logged, so the solver never
+ * touches the heap.  Intended for small problems with 2 to 9 parameters.
  */
 template <typename ImplT,
           int      NI,
@@ -299,44 +592,32 @@ typename ImplT::domain_type levenberg_marquardt_fixed( const Least_Squares_Model
                                                        double rel_tolerance = MATH_LM_REL_TOL,
                                                        double max_iterations = MATH_LM_MAX_ITER) {
 
+    using domain_type = typename ImplT::domain_type;
+    using result_type = typename ImplT::result_type;
+    static_assert( Vector_Size<domain_type>::value == NI, "domain_type must be a Vector_<double,NI>" );
+    static_assert( Vector_Size<result_type>::value == NO, "result_type must be a Vector_<double,NO>" );
+
     status = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
 
     const ImplT& model = least_squares_model.impl();
-    bool   done   = false;
-    double Rinv   = 10;
-    double lambda = 0.1;
+    double Rinv = 10;
 
-    typename ImplT::domain_type x_try, x = seed;
-    typename ImplT::result_type h = model(x);
-    typename ImplT::result_type error = model.difference(observation, h);
-    double norm_start = error.magnitude();
+    domain_type x_try, x = seed;
+    result_type h = model(x);
+    result_type error = model.difference(observation, h);
 
-    tmns::log::debug( "LM: initial guess for the model is ", seed );
-    tmns::log::debug( "LM: starting error ", error );
-    tmns::log::debug( "LM: starting norm is: ", norm_start );
+    // Nothing is logged
+    detail::LM_Step_Control control( error.magnitude(), abs_tolerance, rel_tolerance, max_iterations, nullptr );
 
     // Solution may already be good enough
-    if( norm_start < abs_tolerance )
-    {
-        status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
-        tmns::log::debug( "CONVERGED TO ABSOLUTE TOLERANCE" );
-        done = true;
-    }
+    bool done = control.converged_at_start( status );
 
-    typename ImplT::jacobian_type J;
-    Matrix<double, NI, NO> J_trans;
-    Matrix<double, NI, NI> J_trans_J;
+    Matrix<double, NO, NI> J;
+    Matrix<double, NI, NI> hessian, hessian_lm;
     Vector_<double, NI> del_J;
-    Matrix<double, NI, NI> hessian, hessian_lm, hessian_lm_inv;
-    
-    tmns::log::debug( "Start of loops" );
-    int outer_iter = 0;
+
     while( !done )
     {
-        bool shortCircuit = false;
-        outer_iter++;
-        tmns::log::debug( "LM: outer iteration ", outer_iter, "   x = ", x );
-
         // Compute the value, derivative, and hessian of the cost function
         // at the current point.  These remain valid until the parameter
         // vector changes.
@@ -346,143 +627,86 @@ typename ImplT::domain_type levenberg_marquardt_fixed( const Least_Squares_Model
 
         // Difference between observed and predicted and error (2-norm of difference)
         error = model.difference(observation, h);
-        tmns::log::trace( "error: ", error.to_string() );
-
-        norm_start = error.magnitude();
-        tmns::log::debug( "LM: outer iteration starting robust norm: ", norm_start );
-
-        // Measurement Jacobian
-        J = model.jacobian(x);
-
-        tmns::log::trace( "J: ", J.to_string() );
-      
-        J_trans = transpose( J );
-        tmns::log::trace( "J Transpose: ", J_trans.to_string() );
-
-        del_J = -1.0 * Rinv * ( J_trans * error );
-        //Vector<double> del_J = -1.0 * Rinv * (J_trans * error);
-        //std::cout << "del_J = " << del_J << std::endl;
-
-        // Hessian of cost function (using Gauss-Newton approximation)
-        J_trans_J = J_trans * J;
-        //std::cout << "J_trans_J = " << J_trans_J << std::endl;
-        hessian = Rinv * J_trans_J;
-        //Matrix<double> hessian = Rinv * J_trans_J;
-
-        //std::cout << "hessian = " << hessian << std::endl;
-      
-        int iterations = 0;
-        double norm_try = norm_start+1.0;
-        while (norm_try > norm_start)
+        control.start_iteration( error.magnitude() );
+
+        // Measurement Jacobian.  The three-argument form is hidden if the model defines its own.
+        if constexpr ( requires { model.jacobian( x, h, J ); } )
+        {
+            model.jacobian( x, h, J );
+        }
+        else
         {
+            J = model.jacobian( x );
+        }
 
+        // Gradient and Hessian of cost function (using Gauss-Newton approximation)
+        for( size_t c = 0; c < NI; ++c )
+        {
+            double value = 0;
+            for( size_t r = 0; r < NO; ++r )
+            {
+                value += J( r, c ) * error[r];
+            }
+            del_J[c] = -Rinv * value;
+
+            for( size_t c2 = 0; c2 <= c; ++c2 )
+            {
+                double hess = 0;
+                for( size_t r = 0; r < NO; ++r )
+                {
+                    hess += J( r, c ) * J( r, c2 );
+                }
+                hessian( c, c2 ) = Rinv * hess;
+                hessian( c2, c ) = Rinv * hess;
+            }
+        }
+
+        while( control.searching() )
+        {
             // Increase diagonal elements to dynamically mix gradient
             // descent and Gauss-Newton.
+            const double lambda = control.lambda();
             hessian_lm = hessian;
-            //Matrix<double> hessian_lm = hessian;
-            for( unsigned i = 0; i < hessian_lm.rows(); ++i )
+            for( size_t i = 0; i < NI; ++i )
             {
                 hessian_lm(i,i) += hessian_lm(i,i)*lambda + lambda;
             }
 
-            // Solve for update
-            typename ImplT::domain_type delta_x;
-            if( hessian_lm.rows() <= 2 && det( hessian_lm ) > 0.0 )
+            // Solve for update.  By construction, hessian_lm is symmetric and
+            // positive-definite; if it is numerically singular, damp harder.
+            auto delta_x = linalg::solve_symmetric( hessian_lm, del_J );
+            if( delta_x.has_error() )
             {
-                // Direct method is more efficient for small matrices, also
-                // here we avoid calling LAPACK which we've seen misbehave
-                // in this situation in a multi-threaded environment.
-                hessian_lm_inv = inverse(hessian_lm);
-                delta_x = hessian_lm_inv * del_J;
+                control.record_failed_solve();
             }
             else
             {
-                try
-                {
-                    // By construction, hessian_lm is symmetric and
-                    // positive-definite.
-                    delta_x = solve_symmetric( hessian_lm, del_J );
-                }
-                catch( const std::exception& e )
+                // update parameter vector
+                for( size_t i = 0; i < NI; ++i )
                 {
-                    // If lambda is very small, the matrix becomes numerically
-                    // singular. In that case use the more general least_squares solver.
-                    delta_x = least_squares( hessian_lm, del_J );
+                    x_try[i] = x[i] - delta_x.value()[i];
                 }
-            }
-
-            // update parameter vector
-            x_try = x - delta_x;
-
-            typename ImplT::result_type h_try = model(x_try);
 
-            typename ImplT::result_type error_try = model.difference(observation, h_try);
-            norm_try = norm_2(error_try);
-
-            tmns::log::debug( "LM: inner iteration ", iterations, " error is ", error_try );
-            tmns::log::debug( "\tLM: inner iteration ", iterations,  " norm is ", norm_try );
-
-            if( norm_try > norm_start )
-            {
-                // Increase lambda and try again
-                lambda *= 10;
-            }
-
-            ++iterations; // Sanity check on iterations in this loop
-        
-            if( iterations > 5 )
-            {
-                tmns::log::debug( "\n****LM: too many inner iterations - short circuiting" );
-                shortCircuit = true;
-                norm_try     = norm_start;
+                result_type error_try = model.difference( observation, model( x_try ) );
+                control.record_trial( error_try.magnitude() );
             }
-            tmns::log::debug( "\tlambda = ", lambda );
-        }
-
-        // Percentage change convergence criterion. Only if we did not do a short-circuit,
-        // as in that case the solution did not improve.
-        if( !shortCircuit && ( ( norm_start-norm_try ) / norm_start ) < rel_tolerance )
-        {
-            status = LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE;
-            tmns::log::debug( "CONVERGED TO RELATIVE TOLERANCE" );
-            done = true;
-        }
-
-        // Absolute error convergence criterion
-        if( norm_try < abs_tolerance )
-        {
-            status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
-            tmns::log::debug( "CONVERGED TO ABSOLUTE TOLERANCE" );
-            done = true;
-        }
-
-        // Max iterations convergence criterion
-        if( outer_iter >= max_iterations )
-        {
-            tmns::log::debug( "REACHED MAX ITERATIONS!" );
-            done = true;
         }
+        done = control.check_convergence( status );
 
         // Take trial parameters as new parameters
         // If we short-circuited the inner loop, then we didn't actually find a
         // better p, so don't update it.
-        if( !shortCircuit )
+        if( control.accepted() )
         {
             x = x_try;
         }
 
-        // Take trial error as new error
-        norm_start = norm_try;
-
-        // Decrease lambda
-        lambda /= 10;
-        tmns::log::debug( "lambda = ", lambda );
-        tmns::log::debug( "LM: end of outer iteration ", outer_iter, " with error ", norm_try );
+        // Take trial error as new error, and decrease lambda
+        control.finish_iteration();
     }
 
-    tmns::log::debug( "LM: finished with: ", outer_iter );
     return x;
 
-} // End levenberg_marquardt
+} // End levenberg_marquardt_fixed
 
 } // End of tmns::math::optimize
\ No newline at end of file
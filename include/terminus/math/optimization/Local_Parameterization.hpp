@@ -0,0 +1,382 @@
+/**
+ * @file    Local_Parameterization.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/Matrix.hpp>
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/Quaternion.hpp>
+#include <terminus/math/Quaternion_Utilities.hpp>
+#include <terminus/math/vector/Vector.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * Kinds of parameter block a Local_Parameterization can hold
+ */
+enum class Manifold_Type { EUCLIDEAN, ///< Ordinary parameters, updated by addition
+                           SO3,       ///< Quaternion [w, x, y, z], updated by q * exp( omega )
+                           SE3        ///< Quaternion [w, x, y, z] then translation [x, y, z]
+                         };
+
+namespace detail {
+
+/**
+ * Skew-symmetric cross product matrix of v
+ */
+inline Matrix<double,3,3> skew( const Vector3d& v )
+{
+    return Matrix<double,3,3>( {     0, -v[2],  v[1],
+                                  v[2],     0, -v[0],
+                                 -v[1],  v[0],     0 } );
+}
+
+/**
+ * I + b * K + c * K^2 for the skew matrix K of omega
+ */
+inline Matrix<double,3,3> skew_series( const Vector3d& omega,
+                                       double          b,
+                                       double          c )
+{
+    const auto K = skew( omega );
+    Matrix<double,3,3> out;
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t col = 0; col < 3; col++ )
+        {
+            double K2 = 0;
+            for( size_t k = 0; k < 3; k++ )
+            {
+                K2 += K( r, k ) * K( k, col );
+            }
+            out( r, col ) = ( r == col ? 1.0 : 0.0 ) + b * K( r, col ) + c * K2;
+        }
+    }
+    return out;
+}
+
+/**
+ * Left Jacobian V of SO(3), which maps the translational part of an se(3) tangent
+ * vector to the translation of its exponential
+ */
+inline Matrix<double,3,3> se3_left_jacobian( const Vector3d& omega )
+{
+    const double theta_sq = omega.magnitude_sq();
+    if( theta_sq < 1e-10 )
+    {
+        return skew_series( omega, 0.5 - theta_sq / 24.0, 1.0 / 6.0 - theta_sq / 120.0 );
+    }
+    const double theta = std::sqrt( theta_sq );
+    return skew_series( omega,
+                        ( 1 - std::cos( theta ) ) / theta_sq,
+                        ( theta - std::sin( theta ) ) / ( theta_sq * theta ) );
+}
+
+/**
+ * Inverse of se3_left_jacobian()
+ */
+inline Matrix<double,3,3> se3_left_jacobian_inverse( const Vector3d& omega )
+{
+    const double theta_sq = omega.magnitude_sq();
+    if( theta_sq < 1e-10 )
+    {
+        return skew_series( omega, -0.5, 1.0 / 12.0 + theta_sq / 720.0 );
+    }
+    const double theta = std::sqrt( theta_sq );
+    return skew_series( omega,
+                        -0.5,
+                        ( 1 - theta * std::sin( theta ) / ( 2 * ( 1 - std::cos( theta ) ) ) ) / theta_sq );
+}
+
+/**
+ * out = A * v
+ */
+inline Vector3d multiply( const Matrix<double,3,3>& A,
+                          const Vector3d&           v )
+{
+    Vector3d out;
+    for( size_t r = 0; r < 3; r++ )
+    {
+        out[r] = A( r, 0 ) * v[0] + A( r, 1 ) * v[1] + A( r, 2 ) * v[2];
+    }
+    return out;
+}
+
+} // End of detail namespace
+
+/**
+ * @class Local_Parameterization
+ *
+ * Describes a parameter vector made of blocks which live on manifolds, such as
+ * rotations stored as quaternions, so solvers can step in the minimal tangent space
+ * instead of the ambient one.  A quaternion has 4 ambient but 3 tangent parameters,
+ * and a step
+ *
+ *     x [+] delta = q * exp( delta )
+ *
+ * always stays a rotation, so the normal equations shrink and no renormalization or
+ * gauge freedom is needed.  SE(3) blocks compose a rigid transform with exp( delta )
+ * on the right, tangent ordered rotation then translation.
+ *
+ * Blocks are laid out in the order added.  Give one to a model with
+ * Least_Squares_Model_Base::set_parameterization().
+ */
+class Local_Parameterization
+{
+    public:
+
+        /**
+         * Append Euclidean parameters
+         */
+        Local_Parameterization& add_euclidean( size_t count )
+        {
+            if( !m_blocks.empty() && m_blocks.back().type == Manifold_Type::EUCLIDEAN )
+            {
+                m_blocks.back().ambient_size += count;
+                m_blocks.back().tangent_size += count;
+                m_ambient_size += count;
+                m_tangent_size += count;
+                return *this;
+            }
+            return add_block( Manifold_Type::EUCLIDEAN, count, count );
+        }
+
+        /**
+         * Append a rotation stored as a quaternion [w, x, y, z]
+         */
+        Local_Parameterization& add_so3()
+        {
+            return add_block( Manifold_Type::SO3, 4, 3 );
+        }
+
+        /**
+         * Append a rigid transform stored as a quaternion [w, x, y, z] followed by a
+         * translation [x, y, z]
+         */
+        Local_Parameterization& add_se3()
+        {
+            return add_block( Manifold_Type::SE3, 7, 6 );
+        }
+
+        /**
+         * Get the number of stored parameters
+         */
+        size_t ambient_size() const
+        {
+            return m_ambient_size;
+        }
+
+        /**
+         * Get the number of degrees of freedom
+         */
+        size_t tangent_size() const
+        {
+            return m_tangent_size;
+        }
+
+        /**
+         * out = x [+] ( scale * delta ).  out must already have x's size.
+         */
+        template <typename DomainT,
+                  typename DeltaT>
+        void plus( const DomainT& x,
+                   const DeltaT&  delta,
+                   double         scale,
+                   DomainT&       out ) const
+        {
+            for( const auto& block : m_blocks )
+            {
+                const size_t a = block.ambient_offset;
+                const size_t t = block.tangent_offset;
+                if( block.type == Manifold_Type::EUCLIDEAN )
+                {
+                    for( size_t i = 0; i < block.ambient_size; i++ )
+                    {
+                        out[a + i] = x[a + i] + scale * delta[t + i];
+                    }
+                    continue;
+                }
+
+                const Quaternion q( x[a], x[a + 1], x[a + 2], x[a + 3] );
+                const Vector3d omega( { scale * delta[t], scale * delta[t + 1], scale * delta[t + 2] } );
+                const auto rotated = q * quaternion_exp( omega );
+                for( size_t i = 0; i < 4; i++ )
+                {
+                    out[a + i] = rotated[i];
+                }
+
+                if( block.type == Manifold_Type::SE3 )
+                {
+                    const Vector3d rho( { scale * delta[t + 3], scale * delta[t + 4], scale * delta[t + 5] } );
+                    const auto step = detail::multiply( q.to_matrix(),
+                                                        detail::multiply( detail::se3_left_jacobian( omega ), rho ) );
+                    for( size_t i = 0; i < 3; i++ )
+                    {
+                        out[a + 4 + i] = x[a + 4 + i] + step[i];
+                    }
+                }
+            }
+        }
+
+        /**
+         * delta = a [-] b, the tangent step for which b [+] delta = a.  delta must
+         * already have tangent_size() elements.
+         */
+        template <typename DomainT,
+                  typename DeltaT>
+        void minus( const DomainT& a,
+                    const DomainT& b,
+                    DeltaT&        delta ) const
+        {
+            for( const auto& block : m_blocks )
+            {
+                const size_t o = block.ambient_offset;
+                const size_t t = block.tangent_offset;
+                if( block.type == Manifold_Type::EUCLIDEAN )
+                {
+                    for( size_t i = 0; i < block.ambient_size; i++ )
+                    {
+                        delta[t + i] = a[o + i] - b[o + i];
+                    }
+                    continue;
+                }
+
+                const Quaternion q_a( a[o], a[o + 1], a[o + 2], a[o + 3] );
+                const Quaternion q_b( b[o], b[o + 1], b[o + 2], b[o + 3] );
+                const auto omega = quaternion_log( q_b.inverse() * q_a );
+                for( size_t i = 0; i < 3; i++ )
+                {
+                    delta[t + i] = omega[i];
+                }
+
+                if( block.type == Manifold_Type::SE3 )
+                {
+                    // rho = V^-1 R_b^T ( t_a - t_b )
+                    const auto R_b = q_b.to_matrix();
+                    Vector3d local;
+                    for( size_t r = 0; r < 3; r++ )
+                    {
+                        for( size_t c = 0; c < 3; c++ )
+                        {
+                            local[r] += R_b( c, r ) * ( a[o + 4 + c] - b[o + 4 + c] );
+                        }
+                    }
+                    const auto rho = detail::multiply( detail::se3_left_jacobian_inverse( omega ), local );
+                    for( size_t i = 0; i < 3; i++ )
+                    {
+                        delta[t + 3 + i] = rho[i];
+                    }
+                }
+            }
+        }
+
+        /**
+         * Derivative of x [+] delta w.r.t. delta at delta = 0, ambient_size() by
+         * tangent_size().  Converts a Jacobian w.r.t. the stored parameters into one
+         * w.r.t. the tangent space.
+         */
+        template <typename DomainT>
+        void plus_jacobian( const DomainT&   x,
+                            MatrixN<double>& P ) const
+        {
+            if( P.rows() != m_ambient_size || P.cols() != m_tangent_size )
+            {
+                P.set_size( m_ambient_size, m_tangent_size );
+            }
+            std::fill( P.begin(), P.end(), 0 );
+
+            for( const auto& block : m_blocks )
+            {
+                const size_t a = block.ambient_offset;
+                const size_t t = block.tangent_offset;
+                if( block.type == Manifold_Type::EUCLIDEAN )
+                {
+                    for( size_t i = 0; i < block.ambient_size; i++ )
+                    {
+                        P( a + i, t + i ) = 1;
+                    }
+                    continue;
+                }
+
+                // d( q * [0, omega / 2] ) / d omega
+                const double w  = x[a];
+                const double qx = x[a + 1];
+                const double qy = x[a + 2];
+                const double qz = x[a + 3];
+                const double block_values[4][3] = { { -qx, -qy, -qz },
+                                                    {   w, -qz,  qy },
+                                                    {  qz,   w, -qx },
+                                                    { -qy,  qx,   w } };
+                for( size_t r = 0; r < 4; r++ )
+                {
+                    for( size_t c = 0; c < 3; c++ )
+                    {
+                        P( a + r, t + c ) = 0.5 * block_values[r][c];
+                    }
+                }
+
+                // Translation moves by R rho
+                if( block.type == Manifold_Type::SE3 )
+                {
+                    const auto R = Quaternion( w, qx, qy, qz ).to_matrix();
+                    for( size_t r = 0; r < 3; r++ )
+                    {
+                        for( size_t c = 0; c < 3; c++ )
+                        {
+                            P( a + 4 + r, t + 3 + c ) = R( r, c );
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+
+        /**
+         * One block of parameters
+         */
+        struct Block
+        {
+            /// @brief Kind of block
+            Manifold_Type type;
+
+            /// @brief Position and length in the stored parameters
+            size_t ambient_offset;
+            size_t ambient_size;
+
+            /// @brief Position and length in the tangent space
+            size_t tangent_offset;
+            size_t tangent_size;
+        };
+
+        /**
+         * Append a block
+         */
+        Local_Parameterization& add_block( Manifold_Type type,
+                                           size_t        ambient_size,
+                                           size_t        tangent_size )
+        {
+            m_blocks.push_back( Block { type, m_ambient_size, ambient_size, m_tangent_size, tangent_size } );
+            m_ambient_size += ambient_size;
+            m_tangent_size += tangent_size;
+            return *this;
+        }
+
+        /// @brief Blocks, in order
+        std::vector<Block> m_blocks;
+
+        /// @brief Total sizes
+        size_t m_ambient_size { 0 };
+        size_t m_tangent_size { 0 };
+
+}; // End of Local_Parameterization class
+
+} // End of tmns::math::optimize namespace
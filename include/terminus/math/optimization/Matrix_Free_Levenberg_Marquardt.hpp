@@ -0,0 +1,739 @@
+/**
+ * @file    Matrix_Free_Levenberg_Marquardt.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/linalg/Cholesky.hpp>
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/optimization/Least_Squares_Model_Base.hpp>
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+#include <terminus/math/optimization/LM_Step_Control.hpp>
+#include <terminus/math/optimization/LM_Observer.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * Preconditioner for the conjugate-gradient inner solve
+ */
+enum class CG_Preconditioner { NONE,         ///< Plain CGLS
+                               JACOBI,       ///< Diagonal of the damped J^T J
+                               BLOCK_JACOBI  ///< Diagonal blocks of the damped J^T J
+                             };
+
+/**
+ * Settings for matrix_free_levenberg_marquardt()
+ */
+struct Matrix_Free_LM_Options
+{
+    /// @brief Preconditioner for the inner solve
+    CG_Preconditioner preconditioner { CG_Preconditioner::JACOBI };
+
+    /// @brief Parameters per block with BLOCK_JACOBI
+    size_t block_size { 8 };
+
+    /// @brief Random probes used to estimate the preconditioner when the model has
+    ///        apply_jacobian_transpose(), rounded up to a multiple of the block size.
+    ///        0 always builds it from columns of J.
+    size_t num_probes { 16 };
+
+    /// @brief Limit on CGLS iterations per damped solve
+    size_t max_cg_iterations { 100 };
+
+    /// @brief Largest inexact Newton forcing term, the relative gradient reduction asked of CGLS
+    double forcing_max { 0.5 };
+
+    /// @brief Smallest forcing term
+    double forcing_min { 1e-10 };
+
+    /// @brief Scale of the Eisenstat-Walker forcing sequence
+    double forcing_gamma { 0.9 };
+
+    /// @brief Callback run after each outer iteration
+    LM_Observer observer;
+};
+
+namespace detail {
+
+/**
+ * Products with the Jacobian of a model at a fixed point, using the model's own
+ * apply_jacobian() / apply_jacobian_transpose() when it has them and directional
+ * finite differences otherwise.
+ */
+template <typename ImplT>
+class Jacobian_Operator
+{
+    public:
+
+        using domain_type = typename ImplT::domain_type;
+        using result_type = typename ImplT::result_type;
+
+        /**
+         * Constructor
+         */
+        Jacobian_Operator( const Least_Squares_Model_Base<ImplT>& model,
+                           size_t                                 num_params,
+                           size_t                                 num_residuals )
+          : m_model( model )
+        {
+            set_vector_size( m_x_step, num_params );
+            set_vector_size( m_unit, num_params );
+            set_vector_size( m_h_step, num_residuals );
+            set_vector_size( m_column, num_residuals );
+        }
+
+        /**
+         * Set the point to linearize about, and the model output h there
+         */
+        void linearize( const domain_type& x,
+                        const result_type& h )
+        {
+            m_x = &x;
+            m_h = &h;
+        }
+
+        /**
+         * Jv = J * v
+         */
+        void apply( const domain_type& v,
+                    result_type&       Jv )
+        {
+            const ImplT& model = m_model.impl();
+            if constexpr ( requires { model.apply_jacobian( *m_x, v, Jv ); } )
+            {
+                model.apply_jacobian( *m_x, v, Jv );
+            }
+            else
+            {
+                // Directional difference along v, with the step scaled to |x| / |v|
+                double v_norm = 0;
+                double x_norm = 0;
+                for( size_t i = 0; i < v.size(); i++ )
+                {
+                    v_norm += v[i] * v[i];
+                    x_norm += (*m_x)[i] * (*m_x)[i];
+                }
+                v_norm = std::sqrt( v_norm );
+                if( !( v_norm > 0 ) )
+                {
+                    for( size_t r = 0; r < Jv.size(); r++ )
+                    {
+                        Jv[r] = 0;
+                    }
+                    return;
+                }
+
+                const double epsilon = std::sqrt( std::numeric_limits<double>::epsilon() ) *
+                                       ( 1 + std::sqrt( x_norm ) ) / v_norm;
+                for( size_t i = 0; i < v.size(); i++ )
+                {
+                    m_x_step[i] = (*m_x)[i] + epsilon * v[i];
+                }
+                m_model.evaluate( m_x_step, m_h_step );
+                m_model.difference_into( m_h_step, *m_h, Jv );
+                for( size_t r = 0; r < Jv.size(); r++ )
+                {
+                    Jv[r] /= epsilon;
+                }
+            }
+        }
+
+        /**
+         * JTw = J^T * w.  Without apply_jacobian_transpose() on the model this costs one
+         * J * e_i product per parameter.
+         */
+        void apply_transpose( const result_type& w,
+                              domain_type&       JTw )
+        {
+            const ImplT& model = m_model.impl();
+            if constexpr ( requires { model.apply_jacobian_transpose( *m_x, w, JTw ); } )
+            {
+                model.apply_jacobian_transpose( *m_x, w, JTw );
+            }
+            else
+            {
+                for( size_t i = 0; i < JTw.size(); i++ )
+                {
+                    column( i );
+                    double value = 0;
+                    for( size_t r = 0; r < w.size(); r++ )
+                    {
+                        value += m_column[r] * w[r];
+                    }
+                    JTw[i] = value;
+                }
+            }
+        }
+
+        /**
+         * Compute column i of J, J * e_i
+         */
+        const result_type& column( size_t i )
+        {
+            for( size_t k = 0; k < m_unit.size(); k++ )
+            {
+                m_unit[k] = 0;
+            }
+            m_unit[i] = 1;
+            apply( m_unit, m_column );
+            return m_column;
+        }
+
+    private:
+
+        /// @brief Model to differentiate
+        const Least_Squares_Model_Base<ImplT>& m_model;
+
+        /// @brief Linearization point and model output there
+        const domain_type* m_x { nullptr };
+        const result_type* m_h { nullptr };
+
+        /// @brief Scratch buffers
+        domain_type m_x_step;
+        domain_type m_unit;
+        result_type m_h_step;
+        result_type m_column;
+
+}; // End of Jacobian_Operator class
+
+/**
+ * Jacobi or block-Jacobi preconditioner for the damped normal equations
+ * J^T J + diag( damping ), built from the diagonal blocks of J^T J.
+ */
+class Block_Jacobi_Preconditioner
+{
+    public:
+
+        /**
+         * Set up blocks of the given size over num_params parameters
+         */
+        Block_Jacobi_Preconditioner( size_t num_params,
+                                     size_t block_size )
+          : m_block_size( std::max<size_t>( 1, std::min( block_size, num_params ) ) )
+        {
+            for( size_t start = 0; start < num_params; start += m_block_size )
+            {
+                const size_t size = std::min( m_block_size, num_params - start );
+                m_gram.emplace_back( size, size );
+                m_factor.emplace_back( size, size );
+            }
+        }
+
+        /**
+         * Compute the undamped blocks of J^T J, one block of columns at a time
+         */
+        template <typename OperatorT>
+        void build( OperatorT& op )
+        {
+            for( size_t b = 0; b < m_gram.size(); b++ )
+            {
+                const size_t start = b * m_block_size;
+                const size_t size  = m_gram[b].rows();
+                if( m_columns.size() != size )
+                {
+                    m_columns.resize( size );
+                }
+                for( size_t k = 0; k < size; k++ )
+                {
+                    m_columns[k] = op.column( start + k );
+                }
+                for( size_t r = 0; r < size; r++ )
+                {
+                    for( size_t c = 0; c <= r; c++ )
+                    {
+                        double value = 0;
+                        for( size_t i = 0; i < m_columns[r].size(); i++ )
+                        {
+                            value += m_columns[r][i] * m_columns[c][i];
+                        }
+                        m_gram[b]( r, c ) = value;
+                        m_gram[b]( c, r ) = value;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Round a number of probes up to a whole number per block position
+         */
+        size_t probe_count( size_t num_probes ) const
+        {
+            return ( ( num_probes + m_block_size - 1 ) / m_block_size ) * m_block_size;
+        }
+
+        /**
+         * Estimate the blocks of J^T J from products J^T J z, costing one J v and one
+         * J^T w product per probe.  Each probe z has random signs at one position c of
+         * every block and zeros elsewhere, so ( J^T J z ) times the sign of a block is its
+         * column c plus coupling to other blocks, which averages out.  With blocks of one
+         * this is the Hutchinson diagonal estimator.  probe, product and Jz are scratch
+         * buffers.
+         */
+        template <typename OperatorT,
+                  typename DomainT,
+                  typename ResultT>
+        void estimate( OperatorT& op,
+                       size_t     num_probes,
+                       DomainT&   probe,
+                       DomainT&   product,
+                       ResultT&   Jz )
+        {
+            for( auto& block : m_gram )
+            {
+                for( size_t r = 0; r < block.rows(); r++ )
+                {
+                    for( size_t c = 0; c < block.cols(); c++ )
+                    {
+                        block( r, c ) = 0;
+                    }
+                }
+            }
+
+            const size_t count = probe_count( num_probes );
+            for( size_t k = 0; k < count; k++ )
+            {
+                const size_t c = k % m_block_size;
+                for( size_t i = 0; i < probe.size(); i++ )
+                {
+                    probe[i] = 0;
+                }
+                for( size_t start = c; start < probe.size(); start += m_block_size )
+                {
+                    probe[start] = ( m_random() & 1 ) ? 1.0 : -1.0;
+                }
+                op.apply( probe, Jz );
+                op.apply_transpose( Jz, product );
+
+                for( size_t b = 0; b < m_gram.size(); b++ )
+                {
+                    const size_t start = b * m_block_size;
+                    if( c < m_gram[b].cols() )
+                    {
+                        for( size_t r = 0; r < m_gram[b].rows(); r++ )
+                        {
+                            m_gram[b]( r, c ) += product[start + r] * probe[start + c];
+                        }
+                    }
+                }
+            }
+
+            // Average, symmetrize, and keep the diagonal non-negative
+            const double rounds = static_cast<double>( count / m_block_size );
+            for( auto& block : m_gram )
+            {
+                for( size_t r = 0; r < block.rows(); r++ )
+                {
+                    for( size_t c = 0; c < r; c++ )
+                    {
+                        const double value = ( block( r, c ) + block( c, r ) ) / ( 2 * rounds );
+                        block( r, c ) = value;
+                        block( c, r ) = value;
+                    }
+                    block( r, r ) = std::max( 0.0, block( r, r ) / rounds );
+                }
+            }
+        }
+
+        /**
+         * Replace the diagonal of J^T J, e.g. with one the model computed exactly
+         */
+        template <typename VectorT>
+        void set_diagonal( const VectorT& diagonal )
+        {
+            for( size_t i = 0; i < diagonal.size(); i++ )
+            {
+                m_gram[i / m_block_size]( i % m_block_size, i % m_block_size ) = diagonal[i];
+            }
+        }
+
+        /**
+         * Diagonal of J^T J
+         */
+        double diagonal( size_t i ) const
+        {
+            return m_gram[i / m_block_size]( i % m_block_size, i % m_block_size );
+        }
+
+        /**
+         * Get the number of parameters per block
+         */
+        size_t block_size() const
+        {
+            return m_block_size;
+        }
+
+        /**
+         * Factor the blocks with damping added to the diagonal
+         *
+         * @return False if a block is not positive-definite
+         */
+        template <typename VectorT>
+        bool factor( const VectorT& damping )
+        {
+            for( size_t b = 0; b < m_gram.size(); b++ )
+            {
+                const size_t start = b * m_block_size;
+                m_factor[b] = m_gram[b];
+                for( size_t k = 0; k < m_factor[b].rows(); k++ )
+                {
+                    m_factor[b]( k, k ) += damping[start + k];
+                }
+                if( !linalg::cholesky_decompose( m_factor[b] ) )
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Apply the inverse of the factored blocks to v in place
+         */
+        template <typename VectorT>
+        void solve( VectorT& v ) const
+        {
+            for( size_t b = 0; b < m_factor.size(); b++ )
+            {
+                const size_t start = b * m_block_size;
+                const MatrixN<double>& L = m_factor[b];
+                const size_t size = L.rows();
+
+                for( size_t i = 0; i < size; i++ )
+                {
+                    double value = v[start + i];
+                    for( size_t k = 0; k < i; k++ )
+                    {
+                        value -= L( i, k ) * v[start + k];
+                    }
+                    v[start + i] = value / L( i, i );
+                }
+                for( size_t ii = size; ii > 0; ii-- )
+                {
+                    const size_t i = ii - 1;
+                    double value = v[start + i];
+                    for( size_t k = i + 1; k < size; k++ )
+                    {
+                        value -= L( k, i ) * v[start + k];
+                    }
+                    v[start + i] = value / L( i, i );
+                }
+            }
+        }
+
+    private:
+
+        /// @brief Parameters per block
+        size_t m_block_size;
+
+        /// @brief Undamped diagonal blocks of J^T J
+        std::vector<MatrixN<double>> m_gram;
+
+        /// @brief Cholesky factors of the damped blocks
+        std::vector<MatrixN<double>> m_factor;
+
+        /// @brief Columns of J for the block being built
+        std::vector<VectorN<double>> m_columns;
+
+        /// @brief Source of probe signs, fixed seed so solves are repeatable
+        std::mt19937 m_random;
+
+}; // End of Block_Jacobi_Preconditioner class
+
+/**
+ * Fill the preconditioner at the point op is linearized about, as cheaply as the
+ * model allows:
+ *
+ * - Jacobi with the model's normal_diagonal() needs no products at all.
+ * - With apply_jacobian_transpose() and fewer than half as many probes as parameters,
+ *   the blocks are estimated from probes.
+ * - Otherwise they are built from one J v product per parameter.
+ *
+ * A diagonal from normal_diagonal() always replaces the built or estimated one.
+ * probe, product and Jz are scratch buffers.
+ */
+template <typename ImplT>
+void fill_preconditioner( const Least_Squares_Model_Base<ImplT>& least_squares_model,
+                          Jacobian_Operator<ImplT>&              op,
+                          Block_Jacobi_Preconditioner&           preconditioner,
+                          const typename ImplT::domain_type&     x,
+                          size_t                                 num_probes,
+                          typename ImplT::domain_type&           probe,
+                          typename ImplT::domain_type&           product,
+                          typename ImplT::result_type&           Jz )
+{
+    const ImplT& model = least_squares_model.impl();
+    constexpr bool has_diagonal  = requires { model.normal_diagonal( x, product ); };
+    constexpr bool has_transpose = requires { model.apply_jacobian_transpose( x, Jz, product ); };
+
+    if( !has_diagonal || preconditioner.block_size() > 1 )
+    {
+        if( has_transpose && num_probes > 0 && 2 * preconditioner.probe_count( num_probes ) < x.size() )
+        {
+            preconditioner.estimate( op, num_probes, probe, product, Jz );
+        }
+        else
+        {
+            preconditioner.build( op );
+        }
+    }
+    if constexpr ( has_diagonal )
+    {
+        model.normal_diagonal( x, product );
+        preconditioner.set_diagonal( product );
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Levenberg-Marquardt for problems too large to form J^T J.
+ *
+ * Each damped step solves
+ *
+ *     ( J^T J + lambda * ( diag( J^T J ) + I / 10 ) ) p = J^T e
+ *
+ * with preconditioned CGLS, using only products with J and J^T.  With an exact
+ * diagonal the damping matches levenberg_marquardt(), so with a tight forcing term
+ * both take the same steps.  With CG_Preconditioner::NONE the damping is lambda * I
+ * instead, and nothing is computed beyond the CGLS products.
+ *
+ * The model is a Least_Squares_Model_Base.  For large problems it should also define
+ *
+ * - `void apply_jacobian( domain_type const& x, domain_type const& v, result_type& Jv ) const;`
+ * - `void apply_jacobian_transpose( domain_type const& x, result_type const& w, domain_type& JTw ) const;`
+ * - `void normal_diagonal( domain_type const& x, domain_type& d ) const;`, the diagonal
+ *   of J^T J, i.e. the squared column norms of J.
+ *
+ * Without apply_jacobian(), J v is found by a directional finite difference, costing one
+ * model evaluation.  Without apply_jacobian_transpose(), J^T w costs one J v product per
+ * parameter, so supply it whenever there are many parameters.
+ *
+ * The Jacobi preconditioners are refreshed every outer iteration.  JACOBI with
+ * normal_diagonal() needs no products.  Otherwise, given apply_jacobian_transpose(),
+ * the diagonal (blocks) of J^T J are estimated from options.num_probes J^T J z
+ * products, and the damping uses the estimate unless normal_diagonal() supplies the
+ * exact diagonal.  Without apply_jacobian_transpose(), or when the probes would cost
+ * more, they are built from one J v product per parameter, the cost of one J^T w.
+ *
+ * CGLS stops once the normal-equation residual falls by the Eisenstat-Walker forcing
+ * term, so early iterations are solved loosely and later ones accurately.  The
+ * observer, if set, reports the CGLS iterations as linear_iterations.
+ */
+template <typename ImplT>
+ImageResult<typename ImplT::domain_type> matrix_free_levenberg_marquardt( const Least_Squares_Model_Base<ImplT>& least_squares_model,
+                                                                          const typename ImplT::domain_type&     seed,
+                                                                          const typename ImplT::result_type&     observation,
+                                                                          LM_STATUS_CODE&                        status,
+                                                                          const Matrix_Free_LM_Options&          options        = Matrix_Free_LM_Options(),
+                                                                          double                                 abs_tolerance  = MATH_LM_ABS_TOL,
+                                                                          double                                 rel_tolerance  = MATH_LM_REL_TOL,
+                                                                          double                                 max_iterations = MATH_LM_MAX_ITER )
+{
+    using domain_type = typename ImplT::domain_type;
+    using result_type = typename ImplT::result_type;
+
+    status = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
+
+    double Rinv = 10;
+
+    const size_t num_params    = seed.size();
+    const size_t num_residuals = observation.size();
+
+    // Parameter-sized buffers
+    domain_type x = seed, x_try = seed, p, gradient, z, direction, damping, JTw;
+    for( auto* v : { &p, &gradient, &z, &direction, &damping, &JTw } )
+    {
+        detail::set_vector_size( *v, num_params );
+    }
+
+    // Residual-sized buffers
+    result_type h, error, h_try, error_try, residual, Jd;
+    for( auto* v : { &h, &error, &h_try, &error_try, &residual, &Jd } )
+    {
+        detail::set_vector_size( *v, num_residuals );
+    }
+
+    detail::Jacobian_Operator<ImplT> op( least_squares_model, num_params, num_residuals );
+    const bool precondition = options.preconditioner != CG_Preconditioner::NONE;
+    detail::Block_Jacobi_Preconditioner preconditioner( num_params,
+                                                        options.preconditioner == CG_Preconditioner::BLOCK_JACOBI ?
+                                                        options.block_size : 1 );
+
+    const auto& observer = options.observer;
+    detail::LM_Phase_Timer timer( static_cast<bool>( observer ) );
+    LM_Iteration_Info info;
+
+    auto dot = []( const auto& a, const auto& b )
+    {
+        double value = 0;
+        for( size_t i = 0; i < a.size(); i++ )
+        {
+            value += a[i] * b[i];
+        }
+        return value;
+    };
+
+    least_squares_model.evaluate( x, h );
+    least_squares_model.difference_into( observation, h, error );
+    detail::LM_Step_Control control( error.magnitude(), abs_tolerance, rel_tolerance, max_iterations, "Matrix-free LM" );
+    double norm_previous = control.norm_start();
+
+    detail::lm_debug( "Matrix-free LM: solving for ", num_params, " parameters from ", num_residuals, " observations" );
+
+    // Solution may already be good enough
+    bool done = control.converged_at_start( status );
+    while( !done )
+    {
+        control.start_iteration();
+        info = LM_Iteration_Info();
+        info.iteration = control.outer_iterations();
+
+        // Linearize, and take the diagonal (blocks) of J^T J for damping and preconditioning
+        timer.start();
+        op.linearize( x, h );
+        if( precondition )
+        {
+            detail::fill_preconditioner( least_squares_model, op, preconditioner, x, options.num_probes, z, JTw, Jd );
+        }
+
+        // Normal-equation right-hand side, J^T e
+        op.apply_transpose( error, JTw );
+        const double rhs_norm = JTw.magnitude();
+        timer.stop( info.jacobian_time );
+
+        // Eisenstat-Walker forcing term, loosest far from the solution
+        double forcing = options.forcing_max;
+        if( info.iteration > 1 && norm_previous > 0 )
+        {
+            const double ratio = control.norm_start() / norm_previous;
+            forcing = std::clamp( options.forcing_gamma * ratio * ratio, options.forcing_min, options.forcing_max );
+        }
+
+        while( control.searching() )
+        {
+            const double lambda = control.lambda();
+            timer.start();
+            for( size_t i = 0; i < num_params; i++ )
+            {
+                damping[i] = precondition ? lambda * ( preconditioner.diagonal( i ) + 1.0 / Rinv ) : lambda;
+            }
+            const bool use_preconditioner = precondition && preconditioner.factor( damping );
+
+            // Preconditioned CGLS on [ J ; D^1/2 ] p = [ e ; 0 ]
+            for( size_t i = 0; i < num_params; i++ )
+            {
+                p[i]        = 0;
+                gradient[i] = JTw[i];
+                z[i]        = JTw[i];
+            }
+            residual = error;
+            if( use_preconditioner )
+            {
+                preconditioner.solve( z );
+            }
+            direction = z;
+            double gamma = dot( gradient, z );
+
+            size_t cg_iter = 0;
+            while( cg_iter < options.max_cg_iterations &&
+                   gradient.magnitude() > forcing * rhs_norm &&
+                   gamma > 0 )
+            {
+                cg_iter++;
+                op.apply( direction, Jd );
+                double curvature = dot( Jd, Jd );
+                for( size_t i = 0; i < num_params; i++ )
+                {
+                    curvature += damping[i] * direction[i] * direction[i];
+                }
+                if( !( curvature > 0 ) )
+                {
+                    break;
+                }
+
+                const double alpha = gamma / curvature;
+                for( size_t i = 0; i < num_params; i++ )
+                {
+                    p[i] += alpha * direction[i];
+                }
+                for( size_t r = 0; r < num_residuals; r++ )
+                {
+                    residual[r] -= alpha * Jd[r];
+                }
+
+                // Normal-equation residual, J^T ( e - J p ) - D p
+                op.apply_transpose( residual, gradient );
+                for( size_t i = 0; i < num_params; i++ )
+                {
+                    gradient[i] -= damping[i] * p[i];
+                }
+
+                z = gradient;
+                if( use_preconditioner )
+                {
+                    preconditioner.solve( z );
+                }
+                const double gamma_next = dot( gradient, z );
+                const double beta = gamma_next / gamma;
+                gamma = gamma_next;
+                for( size_t i = 0; i < num_params; i++ )
+                {
+                    direction[i] = z[i] + beta * direction[i];
+                }
+            }
+            info.linear_iterations += static_cast<int>( cg_iter );
+            timer.stop( info.solve_time );
+
+            // update parameter vector
+            timer.start();
+            for( size_t i = 0; i < num_params; i++ )
+            {
+                x_try[i] = x[i] + p[i];
+            }
+            least_squares_model.evaluate( x_try, h_try );
+            least_squares_model.difference_into( observation, h_try, error_try );
+            const double norm_try = error_try.magnitude();
+            timer.stop( info.model_time );
+
+            detail::lm_trace( "\tMatrix-free LM: inner iteration ", control.inner_iterations(), " took ", cg_iter,
+                              " CGLS iterations, norm is ", norm_try );
+
+            info.lambda   = lambda;
+            info.norm_try = norm_try;
+            control.record_trial( norm_try );
+        }
+        done = control.check_convergence( status );
+
+        // Take trial parameters as new parameters
+        if( control.accepted() )
+        {
+            x     = x_try;
+            h     = h_try;
+            error = error_try;
+        }
+
+        if( observer )
+        {
+            info.inner_iterations = control.inner_iterations();
+            info.norm_start       = control.norm_start();
+            info.accepted         = control.accepted();
+            observer( info );
+        }
+
+        norm_previous = control.norm_start();
+        control.finish_iteration();
+    }
+    return x;
+} // End matrix_free_levenberg_marquardt
+
+} // End of tmns::math::optimize namespace
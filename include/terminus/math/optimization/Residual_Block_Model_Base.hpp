@@ -0,0 +1,159 @@
+/**
+ * @file    Residual_Block_Model_Base.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/optimization/Least_Squares_Model_Base.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+namespace tmns::math::optimize {
+
+/**
+ * Scratch space for linearizing one residual block
+ */
+template <typename DomainT>
+struct Residual_Block_Scratch
+{
+    /// @brief Perturbed parameters
+    DomainT x_step;
+
+    /// @brief Residuals at the perturbed parameters
+    VectorN<double> r_step;
+    VectorN<double> r_back;
+};
+
+/**
+ * @class Residual_Block_Model_Base
+ *
+ * Base for tall least squares problems whose residuals are produced in blocks of
+ * rows, solved by streaming_levenberg_marquardt() without ever holding the whole
+ * Jacobian.  Blocks are evaluated from several threads at once, so the methods
+ * below must be thread-safe.
+ *
+ * Your sub-class must define a domain_type (VectorN<double> or Vector_<double,N>) and:
+ *
+ * - `size_t num_blocks() const;`
+ * - `size_t block_rows( size_t block ) const;`
+ * - `void residual_block( size_t block, domain_type const& x, VectorN<double>& r ) const;`
+ *   giving the residuals (predicted minus observed) of a block.  r arrives sized to
+ *   block_rows( block ).
+ *
+ * Optionally, define
+ *
+ * - `void jacobian_block( size_t block, domain_type const& x, MatrixN<double>& J ) const;`
+ *
+ * giving dr/dx for the block, block_rows( block ) by x.size().  Otherwise it is
+ * computed numerically, as configured by set_jacobian_options().
+ */
+template <typename ImplT>
+class Residual_Block_Model_Base
+{
+    public:
+
+        /**
+         * Access the underlying type
+         */
+        ImplT&  impl()
+        {
+            return static_cast<ImplT&>( *this );
+        }
+
+        /**
+         * Access the underlying type
+         */
+        ImplT const& impl() const
+        {
+            return static_cast<ImplT const&>( *this );
+        }
+
+        /**
+         * Numerical Jacobian of a block, given its residuals r at x.  Hidden by any
+         * jacobian_block() in your sub-class.
+         */
+        template <typename DomainT>
+        void jacobian_block( size_t                           block,
+                             const DomainT&                   x,
+                             const VectorN<double>&           r,
+                             MatrixN<double>&                 J,
+                             Residual_Block_Scratch<DomainT>& scratch ) const
+        {
+            const size_t rows = r.size();
+            detail::set_matrix_size( J, rows, x.size() );
+            detail::set_vector_size( scratch.r_step, rows );
+            detail::set_vector_size( scratch.r_back, rows );
+            scratch.x_step = x;
+
+            for( size_t i = 0; i < x.size(); i++ )
+            {
+                detail::difference_parameter( m_jacobian_options, scratch.x_step, i, r,
+                                              scratch.r_step, scratch.r_back,
+                                              [&]( const DomainT& x_step, VectorN<double>& out )
+                                              {
+                                                  impl().residual_block( block, x_step, out );
+                                              },
+                                              [&]( const VectorN<double>& forward,
+                                                   const VectorN<double>& base,
+                                                   double                 epsilon )
+                                              {
+                                                  for( size_t row = 0; row < rows; row++ )
+                                                  {
+                                                      J( row, i ) = ( forward[row] - base[row] ) / epsilon;
+                                                  }
+                                              } );
+            }
+        }
+
+        /**
+         * Evaluate the residuals of a block and their Jacobian, using your
+         * jacobian_block() if defined, else the numerical one.
+         */
+        template <typename DomainT>
+        void linearize_block( size_t                           block,
+                              const DomainT&                   x,
+                              VectorN<double>&                 r,
+                              MatrixN<double>&                 J,
+                              Residual_Block_Scratch<DomainT>& scratch ) const
+        {
+            detail::set_vector_size( r, impl().block_rows( block ) );
+            impl().residual_block( block, x, r );
+            if constexpr ( requires { impl().jacobian_block( block, x, J ); } )
+            {
+                detail::set_matrix_size( J, r.size(), x.size() );
+                impl().jacobian_block( block, x, J );
+            }
+            else
+            {
+                jacobian_block( block, x, r, J, scratch );
+            }
+        }
+
+        /**
+         * Get the numerical Jacobian configuration
+         */
+        const Numeric_Jacobian_Options& jacobian_options() const
+        {
+            return m_jacobian_options;
+        }
+
+        /**
+         * Set the difference formula and step size used by jacobian_block() for
+         * blocks without an analytic one.  Each block is differenced by the thread
+         * linearizing it, so the parallel flag and pool have no effect here.
+         */
+        void set_jacobian_options( const Numeric_Jacobian_Options& options )
+        {
+            m_jacobian_options = options;
+        }
+
+    private:
+
+        /// @brief Numerical Jacobian configuration
+        Numeric_Jacobian_Options m_jacobian_options;
+
+}; // End of Residual_Block_Model_Base class
+
+} // End of tmns::math::optimize namespace
@@ -0,0 +1,488 @@
+/**
+ * @file    Schur_Levenberg_Marquardt.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/linalg/Cholesky.hpp>
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+#include <terminus/math/optimization/LM_Step_Control.hpp>
+#include <terminus/math/optimization/Two_Block_Model_Base.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <cmath>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * Outcome of a schur_levenberg_marquardt() solve
+ */
+struct Schur_LM_Summary
+{
+    /// @brief Convergence status
+    LM_STATUS_CODE status { LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE };
+
+    /// @brief Number of outer iterations taken
+    int iterations { 0 };
+
+    /// @brief 2-norm of all residuals at the start
+    double initial_norm { 0 };
+
+    /// @brief 2-norm of all residuals at the solution
+    double final_norm { 0 };
+};
+
+namespace detail {
+
+/// @brief Observations, cameras or points handled per parallel chunk
+static constexpr size_t SCHUR_GRAIN = 64;
+
+/**
+ * Observation indices grouped by camera or by point, stored contiguously
+ */
+class Observation_Index
+{
+    public:
+
+        /**
+         * Group observations 0..keys.size()-1 by keys[obs], which must be below num_groups
+         */
+        Observation_Index( size_t                     num_groups,
+                           const std::vector<size_t>& keys )
+            : m_offsets( num_groups + 1, 0 ),
+              m_observations( keys.size() )
+        {
+            for( auto key : keys )
+            {
+                m_offsets[key + 1]++;
+            }
+            for( size_t i = 0; i < num_groups; i++ )
+            {
+                m_offsets[i + 1] += m_offsets[i];
+            }
+            std::vector<size_t> next( m_offsets.begin(), m_offsets.end() - 1 );
+            for( size_t obs = 0; obs < keys.size(); obs++ )
+            {
+                m_observations[next[keys[obs]]++] = obs;
+            }
+        }
+
+        /**
+         * Get the observations of a group
+         */
+        std::span<const size_t> operator[]( size_t group ) const
+        {
+            return std::span<const size_t>( m_observations.data() + m_offsets[group],
+                                            m_offsets[group + 1] - m_offsets[group] );
+        }
+
+    private:
+
+        /// @brief Start of each group in m_observations
+        std::vector<size_t> m_offsets;
+
+        /// @brief Observation indices, ordered by group
+        std::vector<size_t> m_observations;
+
+}; // End of Observation_Index class
+
+/**
+ * out += sign * A^T * B
+ */
+template <typename AMatrixT,
+          typename BMatrixT,
+          typename OutMatrixT>
+void add_At_B( const AMatrixT& A,
+               const BMatrixT& B,
+               OutMatrixT&     out,
+               double          sign = 1 )
+{
+    for( size_t r = 0; r < A.cols(); r++ )
+    {
+        for( size_t c = 0; c < B.cols(); c++ )
+        {
+            double value = 0;
+            for( size_t k = 0; k < A.rows(); k++ )
+            {
+                value += A( k, r ) * B( k, c );
+            }
+            out( r, c ) += sign * value;
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Levenberg-Marquardt for two-block problems such as bundle adjustment, using the
+ * Schur complement to eliminate the points.
+ *
+ * Each iteration linearizes all observations in parallel, then builds the camera
+ * blocks U, point blocks V and cross terms W of the normal equations.  Since V is
+ * block-diagonal it is inverted point by point, leaving the reduced camera system
+ *
+ *     ( U - W V^-1 W^T ) dc = g_c - W V^-1 g_p
+ *
+ * which is solved by Cholesky, after which each point update is recovered by back
+ * substitution.  Memory and time grow linearly with the number of points; the
+ * reduced camera system is stored densely, so it suits problems with up to a few
+ * thousand cameras.
+ *
+ * Cameras and points are updated in place.  Damping and convergence tests follow
+ * levenberg_marquardt().  Throws std::runtime_error if an observation references a
+ * camera or point outside the given spans.
+ */
+template <typename ImplT,
+          size_t   CameraN,
+          size_t   PointN,
+          size_t   ResidualN>
+Schur_LM_Summary schur_levenberg_marquardt( const Two_Block_Model_Base<ImplT,CameraN,PointN,ResidualN>& least_squares_model,
+                                            std::span<Vector_<double,CameraN>>                          cameras,
+                                            std::span<Vector_<double,PointN>>                           points,
+                                            double                                                      abs_tolerance  = MATH_LM_ABS_TOL,
+                                            double                                                      rel_tolerance  = MATH_LM_REL_TOL,
+                                            double                                                      max_iterations = MATH_LM_MAX_ITER,
+                                            parallel::Thread_Pool&                                      pool           = parallel::Thread_Pool::global() )
+{
+    using base_type     = Two_Block_Model_Base<ImplT,CameraN,PointN,ResidualN>;
+    using camera_type   = typename base_type::camera_type;
+    using point_type    = typename base_type::point_type;
+    using residual_type = typename base_type::residual_type;
+    using cross_type    = Matrix<double,CameraN,PointN>;
+
+    const ImplT& model = least_squares_model.impl();
+    const size_t num_obs     = model.num_observations();
+    const size_t num_cameras = cameras.size();
+    const size_t num_points  = points.size();
+    const size_t grain       = detail::SCHUR_GRAIN;
+
+    // Group the observations by camera and by point
+    std::vector<size_t> obs_camera( num_obs );
+    std::vector<size_t> obs_point( num_obs );
+    for( size_t k = 0; k < num_obs; k++ )
+    {
+        obs_camera[k] = model.camera_index( k );
+        obs_point[k]  = model.point_index( k );
+        if( obs_camera[k] >= num_cameras || obs_point[k] >= num_points )
+        {
+            std::stringstream sout;
+            sout << "schur_levenberg_marquardt: observation " << k << " references camera "
+                 << obs_camera[k] << " of " << num_cameras << " and point " << obs_point[k]
+                 << " of " << num_points;
+            throw std::runtime_error( sout.str() );
+        }
+    }
+    const detail::Observation_Index by_camera( num_cameras, obs_camera );
+    const detail::Observation_Index by_point( num_points, obs_point );
+
+    // Linearization of each observation
+    std::vector<residual_type>                                residuals( num_obs );
+    std::vector<typename base_type::camera_jacobian_type>     J_cameras( num_obs );
+    std::vector<typename base_type::point_jacobian_type>      J_points( num_obs );
+    std::vector<cross_type>                                   W( num_obs );
+    std::vector<double>                                       sq_norms( num_obs );
+
+    // Normal equation blocks
+    std::vector<Matrix<double,CameraN,CameraN>> U( num_cameras );
+    std::vector<camera_type>                    g_camera( num_cameras );
+    std::vector<Matrix<double,PointN,PointN>>   V( num_points );
+    std::vector<Matrix<double,PointN,PointN>>   V_inv( num_points );
+    std::vector<point_type>                     g_point( num_points );
+
+    // Reduced camera system
+    MatrixN<double> S( num_cameras * CameraN, num_cameras * CameraN );
+    VectorN<double> delta_camera( num_cameras * CameraN );
+
+    std::vector<camera_type> camera_try( cameras.begin(), cameras.end() );
+    std::vector<point_type>  point_try( points.begin(), points.end() );
+
+    // 2-norm of all residuals, summed in a fixed order
+    auto evaluate_norm = [&]( std::span<const camera_type> cams,
+                              std::span<const point_type>  pts )
+    {
+        parallel::parallel_for( 0, num_obs, grain, [&]( size_t begin, size_t end )
+        {
+            residual_type r;
+            for( size_t k = begin; k < end; k++ )
+            {
+                model.residual( k, cams[obs_camera[k]], pts[obs_point[k]], r );
+                sq_norms[k] = r.magnitude_sq();
+            }
+        }, pool );
+
+        double total = 0;
+        for( auto value : sq_norms )
+        {
+            total += value;
+        }
+        return std::sqrt( total );
+    };
+
+    Schur_LM_Summary summary;
+    detail::LM_Step_Control control( evaluate_norm( cameras, points ), abs_tolerance, rel_tolerance, max_iterations, "Schur LM" );
+    summary.initial_norm = control.norm_start();
+    summary.final_norm   = control.norm_start();
+
+    detail::lm_debug( "Schur LM: ", num_cameras, " cameras, ", num_points, " points, ",
+                      num_obs, " observations, starting norm ", control.norm_start() );
+
+    // Solution may already be good enough
+    bool done = control.converged_at_start( summary.status );
+    while( !done )
+    {
+        control.start_iteration();
+
+        // Linearize every observation
+        parallel::parallel_for( 0, num_obs, grain, [&]( size_t begin, size_t end )
+        {
+            for( size_t k = begin; k < end; k++ )
+            {
+                least_squares_model.linearize( k,
+                                               cameras[obs_camera[k]],
+                                               points[obs_point[k]],
+                                               residuals[k],
+                                               J_cameras[k],
+                                               J_points[k] );
+                W[k] = cross_type();
+                detail::add_At_B( J_cameras[k], J_points[k], W[k] );
+            }
+        }, pool );
+
+        // Camera blocks and gradient, g = -J^T r
+        parallel::parallel_for( 0, num_cameras, grain, [&]( size_t begin, size_t end )
+        {
+            for( size_t i = begin; i < end; i++ )
+            {
+                U[i]        = Matrix<double,CameraN,CameraN>();
+                g_camera[i] = camera_type();
+                for( auto k : by_camera[i] )
+                {
+                    detail::add_At_B( J_cameras[k], J_cameras[k], U[i] );
+                    for( size_t c = 0; c < CameraN; c++ )
+                    {
+                        for( size_t r = 0; r < ResidualN; r++ )
+                        {
+                            g_camera[i][c] -= J_cameras[k]( r, c ) * residuals[k][r];
+                        }
+                    }
+                }
+            }
+        }, pool );
+
+        // Point blocks and gradient
+        parallel::parallel_for( 0, num_points, grain, [&]( size_t begin, size_t end )
+        {
+            for( size_t j = begin; j < end; j++ )
+            {
+                V[j]       = Matrix<double,PointN,PointN>();
+                g_point[j] = point_type();
+                for( auto k : by_point[j] )
+                {
+                    detail::add_At_B( J_points[k], J_points[k], V[j] );
+                    for( size_t c = 0; c < PointN; c++ )
+                    {
+                        for( size_t r = 0; r < ResidualN; r++ )
+                        {
+                            g_point[j][c] -= J_points[k]( r, c ) * residuals[k][r];
+                        }
+                    }
+                }
+            }
+        }, pool );
+
+        while( control.searching() )
+        {
+            const double lambda = control.lambda();
+
+            // Invert the damped point blocks
+            std::atomic<bool> points_factored { true };
+            parallel::parallel_for( 0, num_points, grain, [&]( size_t begin, size_t end )
+            {
+                for( size_t j = begin; j < end; j++ )
+                {
+                    Matrix<double,PointN,PointN> factor = V[j];
+                    for( size_t d = 0; d < PointN; d++ )
+                    {
+                        factor( d, d ) += factor( d, d ) * lambda + lambda;
+                    }
+                    if( !linalg::cholesky_decompose( factor ) )
+                    {
+                        points_factored.store( false, std::memory_order_relaxed );
+                        continue;
+                    }
+                    for( size_t c = 0; c < PointN; c++ )
+                    {
+                        point_type column;
+                        column[c] = 1;
+                        linalg::cholesky_solve( factor, column );
+                        for( size_t r = 0; r < PointN; r++ )
+                        {
+                            V_inv[j]( r, c ) = column[r];
+                        }
+                    }
+                }
+            }, pool );
+
+            if( !points_factored.load( std::memory_order_relaxed ) )
+            {
+                detail::lm_debug( "Schur LM: point block not positive-definite, lambda = ", lambda );
+                control.record_failed_solve();
+                continue;
+            }
+
+            // Build the lower triangle of the reduced camera system, one block row per camera
+            parallel::parallel_for( 0, num_cameras, grain, [&]( size_t begin, size_t end )
+            {
+                for( size_t i = begin; i < end; i++ )
+                {
+                    const size_t row0 = i * CameraN;
+                    for( size_t r = 0; r < CameraN; r++ )
+                    {
+                        for( size_t c = 0; c <= row0 + r; c++ )
+                        {
+                            S( row0 + r, c ) = 0;
+                        }
+                        S( row0 + r, row0 + r ) = U[i]( r, r ) + U[i]( r, r ) * lambda + lambda;
+                        for( size_t c = 0; c < r; c++ )
+                        {
+                            S( row0 + r, row0 + c ) = U[i]( r, c );
+                        }
+                        delta_camera[row0 + r] = g_camera[i][r];
+                    }
+
+                    for( auto k : by_camera[i] )
+                    {
+                        const size_t j = obs_point[k];
+
+                        // T = W_k V_j^-1
+                        cross_type T;
+                        for( size_t r = 0; r < CameraN; r++ )
+                        {
+                            for( size_t c = 0; c < PointN; c++ )
+                            {
+                                double value = 0;
+                                for( size_t m = 0; m < PointN; m++ )
+                                {
+                                    value += W[k]( r, m ) * V_inv[j]( m, c );
+                                }
+                                T( r, c ) = value;
+                            }
+                        }
+
+                        // Right-hand side, g_c - W V^-1 g_p
+                        for( size_t r = 0; r < CameraN; r++ )
+                        {
+                            for( size_t c = 0; c < PointN; c++ )
+                            {
+                                delta_camera[row0 + r] -= T( r, c ) * g_point[j][c];
+                            }
+                        }
+
+                        // Coupling with every camera which also sees point j
+                        for( auto l : by_point[j] )
+                        {
+                            const size_t i2 = obs_camera[l];
+                            if( i2 > i )
+                            {
+                                continue;
+                            }
+                            const size_t col0 = i2 * CameraN;
+                            for( size_t r = 0; r < CameraN; r++ )
+                            {
+                                for( size_t c = 0; c < CameraN; c++ )
+                                {
+                                    if( i2 == i && c > r )
+                                    {
+                                        break;
+                                    }
+                                    double value = 0;
+                                    for( size_t m = 0; m < PointN; m++ )
+                                    {
+                                        value += T( r, m ) * W[l]( c, m );
+                                    }
+                                    S( row0 + r, col0 + c ) -= value;
+                                }
+                            }
+                        }
+                    }
+                }
+            }, pool );
+
+            if( !linalg::cholesky_decompose( S ) )
+            {
+                detail::lm_debug( "Schur LM: reduced camera system not positive-definite, lambda = ", lambda );
+                control.record_failed_solve();
+            }
+            else
+            {
+                linalg::cholesky_solve( S, delta_camera );
+
+                for( size_t i = 0; i < num_cameras; i++ )
+                {
+                    for( size_t c = 0; c < CameraN; c++ )
+                    {
+                        camera_try[i][c] = cameras[i][c] + delta_camera[i * CameraN + c];
+                    }
+                }
+
+                // Back-substitute for the points, dp = V^-1 ( g_p - W^T dc )
+                parallel::parallel_for( 0, num_points, grain, [&]( size_t begin, size_t end )
+                {
+                    for( size_t j = begin; j < end; j++ )
+                    {
+                        point_type rhs = g_point[j];
+                        for( auto l : by_point[j] )
+                        {
+                            const size_t col0 = obs_camera[l] * CameraN;
+                            for( size_t m = 0; m < PointN; m++ )
+                            {
+                                for( size_t c = 0; c < CameraN; c++ )
+                                {
+                                    rhs[m] -= W[l]( c, m ) * delta_camera[col0 + c];
+                                }
+                            }
+                        }
+                        for( size_t r = 0; r < PointN; r++ )
+                        {
+                            double value = 0;
+                            for( size_t c = 0; c < PointN; c++ )
+                            {
+                                value += V_inv[j]( r, c ) * rhs[c];
+                            }
+                            point_try[j][r] = points[j][r] + value;
+                        }
+                    }
+                }, pool );
+
+                const double norm_try = evaluate_norm( camera_try, point_try );
+                detail::lm_trace( "\tSchur LM: inner iteration ", control.inner_iterations(), " norm is ", norm_try );
+                control.record_trial( norm_try );
+            }
+        }
+        done = control.check_convergence( summary.status );
+
+        // Take trial parameters as new parameters
+        if( control.accepted() )
+        {
+            std::copy( camera_try.begin(), camera_try.end(), cameras.begin() );
+            std::copy( point_try.begin(), point_try.end(), points.begin() );
+        }
+        control.finish_iteration();
+    }
+
+    summary.iterations = control.outer_iterations();
+    summary.final_norm = control.norm_start();
+    return summary;
+} // End schur_levenberg_marquardt
+
+} // End of tmns::math::optimize namespace
@@ -0,0 +1,257 @@
+/**
+ * @file    Streaming_Levenberg_Marquardt.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/linalg/Cholesky.hpp>
+#include <terminus/math/matrix/MatrixN.hpp>
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+#include <terminus/math/optimization/LM_Step_Control.hpp>
+#include <terminus/math/optimization/Residual_Block_Model_Base.hpp>
+#include <terminus/math/parallel/Parallel_For.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * Outcome of a streaming_levenberg_marquardt() solve
+ */
+struct Streaming_LM_Summary
+{
+    /// @brief Convergence status
+    LM_STATUS_CODE status { LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE };
+
+    /// @brief Number of outer iterations taken
+    int iterations { 0 };
+
+    /// @brief 2-norm of all residuals at the start
+    double initial_norm { 0 };
+
+    /// @brief 2-norm of all residuals at the solution
+    double final_norm { 0 };
+};
+
+namespace detail {
+
+/// @brief Most partial sums kept at once.  Blocks are split into at most this many
+///        chunks, so memory is bounded by it rather than by the number of threads.
+static constexpr size_t STREAMING_CHUNKS = 64;
+
+/**
+ * One chunk's share of the normal equations, plus scratch for linearizing its blocks
+ */
+template <typename DomainT>
+struct Normal_Equations_Partial
+{
+    /// @brief Lower triangle of J^T J over the chunk's blocks
+    MatrixN<double> JtJ;
+
+    /// @brief J^T r over the chunk's blocks
+    VectorN<double> Jtr;
+
+    /// @brief Sum of squared residuals over the chunk's blocks
+    double sq_norm { 0 };
+
+    /// @brief Residuals and Jacobian of the current block
+    VectorN<double> r;
+    MatrixN<double> J;
+
+    /// @brief Numerical Jacobian scratch
+    Residual_Block_Scratch<DomainT> scratch;
+};
+
+/**
+ * Lower triangle of out += J^T J
+ */
+inline void add_lower_At_A( const MatrixN<double>& J,
+                            MatrixN<double>&       out )
+{
+    for( size_t k = 0; k < J.rows(); k++ )
+    {
+        for( size_t r = 0; r < J.cols(); r++ )
+        {
+            const double value = J( k, r );
+            if( value == 0 )
+            {
+                continue;
+            }
+            for( size_t c = 0; c <= r; c++ )
+            {
+                out( r, c ) += value * J( k, c );
+            }
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Levenberg-Marquardt for tall problems, with far more residuals than parameters,
+ * whose residuals come in blocks of rows from a Residual_Block_Model_Base.
+ *
+ * Rather than building the whole m by n Jacobian, each iteration linearizes one block
+ * at a time and folds it into J^T J and J^T r before moving on, so memory grows with
+ * n^2 instead of m n.  Blocks are linearized in parallel, each chunk of blocks summing
+ * into its own partial normal equations.  The partials are merged in chunk order and
+ * the chunks depend only on the number of blocks, so results are identical for any
+ * number of threads.
+ *
+ * The parameters are updated in place.  Damping and convergence tests follow
+ * schur_levenberg_marquardt().
+ */
+template <typename ImplT,
+          typename DomainT>
+Streaming_LM_Summary streaming_levenberg_marquardt( const Residual_Block_Model_Base<ImplT>& least_squares_model,
+                                                    DomainT&                                x,
+                                                    double                                  abs_tolerance  = MATH_LM_ABS_TOL,
+                                                    double                                  rel_tolerance  = MATH_LM_REL_TOL,
+                                                    double                                  max_iterations = MATH_LM_MAX_ITER,
+                                                    parallel::Thread_Pool&                  pool           = parallel::Thread_Pool::global() )
+{
+    const ImplT& model = least_squares_model.impl();
+    const size_t num_blocks = model.num_blocks();
+    const size_t num_params = x.size();
+    const size_t grain      = std::max<size_t>( 1, ( num_blocks + detail::STREAMING_CHUNKS - 1 ) / detail::STREAMING_CHUNKS );
+    const size_t num_chunks = parallel::chunk_count( 0, num_blocks, grain );
+
+    std::vector<detail::Normal_Equations_Partial<DomainT>> partials( num_chunks );
+    for( auto& partial : partials )
+    {
+        partial.JtJ = MatrixN<double>( num_params, num_params );
+        partial.Jtr = VectorN<double>( num_params );
+    }
+
+    // Damped normal equations and step
+    MatrixN<double> JtJ( num_params, num_params );
+    VectorN<double> g( num_params );
+    MatrixN<double> factor( num_params, num_params );
+    VectorN<double> delta( num_params );
+    DomainT x_try = x;
+
+    // 2-norm of all residuals, summed in chunk order
+    auto evaluate_norm = [&]( const DomainT& params )
+    {
+        parallel::parallel_for_chunks( 0, num_blocks, grain, [&]( size_t chunk, size_t begin, size_t end )
+        {
+            auto& partial = partials[chunk];
+            partial.sq_norm = 0;
+            for( size_t block = begin; block < end; block++ )
+            {
+                detail::set_vector_size( partial.r, model.block_rows( block ) );
+                model.residual_block( block, params, partial.r );
+                partial.sq_norm += partial.r.magnitude_sq();
+            }
+        }, pool );
+
+        double total = 0;
+        for( const auto& partial : partials )
+        {
+            total += partial.sq_norm;
+        }
+        return std::sqrt( total );
+    };
+
+    Streaming_LM_Summary summary;
+    detail::LM_Step_Control control( evaluate_norm( x ), abs_tolerance, rel_tolerance, max_iterations, "Streaming LM" );
+    summary.initial_norm = control.norm_start();
+    summary.final_norm   = control.norm_start();
+
+    detail::lm_debug( "Streaming LM: ", num_blocks, " blocks, ", num_params,
+                      " parameters, starting norm ", control.norm_start() );
+
+    // Solution may already be good enough
+    bool done = control.converged_at_start( summary.status );
+    while( !done )
+    {
+        control.start_iteration();
+
+        // Fold each block into its chunk's partial normal equations
+        parallel::parallel_for_chunks( 0, num_blocks, grain, [&]( size_t chunk, size_t begin, size_t end )
+        {
+            auto& partial = partials[chunk];
+            std::fill( partial.JtJ.begin(), partial.JtJ.end(), 0 );
+            partial.Jtr.fill( 0 );
+            for( size_t block = begin; block < end; block++ )
+            {
+                least_squares_model.linearize_block( block, x, partial.r, partial.J, partial.scratch );
+                detail::add_lower_At_A( partial.J, partial.JtJ );
+                for( size_t k = 0; k < partial.J.rows(); k++ )
+                {
+                    for( size_t c = 0; c < num_params; c++ )
+                    {
+                        partial.Jtr[c] += partial.J( k, c ) * partial.r[k];
+                    }
+                }
+            }
+        }, pool );
+
+        // Merge in chunk order, g = -J^T r
+        std::fill( JtJ.begin(), JtJ.end(), 0 );
+        g.fill( 0 );
+        for( const auto& partial : partials )
+        {
+            for( size_t r = 0; r < num_params; r++ )
+            {
+                for( size_t c = 0; c <= r; c++ )
+                {
+                    JtJ( r, c ) += partial.JtJ( r, c );
+                }
+                g[r] -= partial.Jtr[r];
+            }
+        }
+
+        while( control.searching() )
+        {
+            const double lambda = control.lambda();
+            for( size_t r = 0; r < num_params; r++ )
+            {
+                for( size_t c = 0; c < r; c++ )
+                {
+                    factor( r, c ) = JtJ( r, c );
+                }
+                factor( r, r ) = JtJ( r, r ) + JtJ( r, r ) * lambda + lambda;
+            }
+
+            if( !linalg::cholesky_decompose( factor ) )
+            {
+                detail::lm_debug( "Streaming LM: normal equations not positive-definite, lambda = ", lambda );
+                control.record_failed_solve();
+            }
+            else
+            {
+                delta = g;
+                linalg::cholesky_solve( factor, delta );
+                for( size_t i = 0; i < num_params; i++ )
+                {
+                    x_try[i] = x[i] + delta[i];
+                }
+
+                const double norm_try = evaluate_norm( x_try );
+                detail::lm_trace( "\tStreaming LM: inner iteration ", control.inner_iterations(), " norm is ", norm_try );
+                control.record_trial( norm_try );
+            }
+        }
+        done = control.check_convergence( summary.status );
+
+        // Take trial parameters as new parameters
+        if( control.accepted() )
+        {
+            x = x_try;
+        }
+        control.finish_iteration();
+    }
+
+    summary.iterations = control.outer_iterations();
+    summary.final_norm = control.norm_start();
+    return summary;
+} // End streaming_levenberg_marquardt
+
+} // End of tmns::math::optimize namespace
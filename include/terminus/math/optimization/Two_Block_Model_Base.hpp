@@ -0,0 +1,190 @@
+/**
+ * @file    Two_Block_Model_Base.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/Matrix.hpp>
+#include <terminus/math/optimization/Least_Squares_Model_Base.hpp>
+#include <terminus/math/vector/Vector.hpp>
+
+namespace tmns::math::optimize {
+
+/**
+ * @class Two_Block_Model_Base
+ *
+ * Base for least squares problems whose parameters split into two blocks, where
+ * every residual depends on exactly one member of each, such as bundle adjustment
+ * with its cameras and points.  Solved by schur_levenberg_marquardt(), which uses the
+ * structure to avoid ever forming the full normal equations.
+ *
+ * Your sub-class must provide:
+ *
+ * - `size_t num_observations() const;`
+ * - `size_t camera_index( size_t obs ) const;` and `size_t point_index( size_t obs ) const;`
+ *   giving which camera and point observation obs links.
+ * - `void residual( size_t obs, camera_type const& camera, point_type const& point, residual_type& r ) const;`
+ *   giving the residual (predicted minus observed) for an observation.
+ *
+ * Optionally, define
+ *
+ * - `void jacobian( size_t obs, camera_type const& camera, point_type const& point,
+ *                   camera_jacobian_type& J_camera, point_jacobian_type& J_point ) const;`
+ *
+ * with the derivatives of the residual w.r.t. the camera and point.  Otherwise they
+ * are computed numerically, as configured by set_jacobian_options().
+ *
+ * Methods are called from several threads at once, so must be thread-safe.
+ */
+template <typename ImplT,
+          size_t   CameraN,
+          size_t   PointN,
+          size_t   ResidualN>
+class Two_Block_Model_Base
+{
+    public:
+
+        /// @brief Parameters of one camera
+        using camera_type = Vector_<double,CameraN>;
+
+        /// @brief Parameters of one point
+        using point_type = Vector_<double,PointN>;
+
+        /// @brief Residual of one observation
+        using residual_type = Vector_<double,ResidualN>;
+
+        /// @brief Residual derivative w.r.t. the camera
+        using camera_jacobian_type = Matrix<double,ResidualN,CameraN>;
+
+        /// @brief Residual derivative w.r.t. the point
+        using point_jacobian_type = Matrix<double,ResidualN,PointN>;
+
+        /// @brief Number of camera parameters
+        static constexpr size_t CAMERA_PARAMS = CameraN;
+
+        /// @brief Number of point parameters
+        static constexpr size_t POINT_PARAMS = PointN;
+
+        /// @brief Number of residuals per observation
+        static constexpr size_t RESIDUALS = ResidualN;
+
+        /**
+         * Access the underlying type
+         */
+        ImplT&  impl()
+        {
+            return static_cast<ImplT&>( *this );
+        }
+
+        /**
+         * Access the underlying type
+         */
+        ImplT const& impl() const
+        {
+            return static_cast<ImplT const&>( *this );
+        }
+
+        /**
+         * Numerical derivatives of the residual of observation obs, given the residual r
+         * at the current camera and point.  Hidden by any jacobian() in your sub-class.
+         */
+        void jacobian( size_t                obs,
+                       const camera_type&    camera,
+                       const point_type&     point,
+                       const residual_type&  r,
+                       camera_jacobian_type& J_camera,
+                       point_jacobian_type&  J_point ) const
+        {
+            numeric_block( camera, r,
+                           [&]( const camera_type& camera_step, residual_type& out )
+                           {
+                               impl().residual( obs, camera_step, point, out );
+                           },
+                           J_camera );
+            numeric_block( point, r,
+                           [&]( const point_type& point_step, residual_type& out )
+                           {
+                               impl().residual( obs, camera, point_step, out );
+                           },
+                           J_point );
+        }
+
+        /**
+         * Evaluate the residual and its derivatives for an observation, using your
+         * jacobian() if defined, else the numerical one.
+         */
+        void linearize( size_t                obs,
+                        const camera_type&    camera,
+                        const point_type&     point,
+                        residual_type&        r,
+                        camera_jacobian_type& J_camera,
+                        point_jacobian_type&  J_point ) const
+        {
+            impl().residual( obs, camera, point, r );
+            if constexpr ( requires { impl().jacobian( obs, camera, point, J_camera, J_point ); } )
+            {
+                impl().jacobian( obs, camera, point, J_camera, J_point );
+            }
+            else
+            {
+                jacobian( obs, camera, point, r, J_camera, J_point );
+            }
+        }
+
+        /**
+         * Get the numerical Jacobian configuration
+         */
+        const Numeric_Jacobian_Options& jacobian_options() const
+        {
+            return m_jacobian_options;
+        }
+
+        /**
+         * Set the difference formula and step size of the numerical camera and point
+         * derivatives.  Only difference and step apply to a single observation's
+         * few parameters; parallel, pool and sparsity are not consulted.
+         */
+        void set_jacobian_options( const Numeric_Jacobian_Options& options )
+        {
+            m_jacobian_options = options;
+        }
+
+    private:
+
+        /**
+         * Differentiate the residual numerically w.r.t. each element of params,
+         * where eval( params, r ) evaluates the residual.
+         */
+        template <typename ParamsT,
+                  typename EvalT,
+                  typename JacobianT>
+        void numeric_block( ParamsT              params,
+                            const residual_type& r,
+                            EvalT&&              eval,
+                            JacobianT&           J ) const
+        {
+            residual_type r_forward;
+            residual_type r_back;
+            for( size_t i = 0; i < params.size(); i++ )
+            {
+                detail::difference_parameter( m_jacobian_options, params, i, r, r_forward, r_back, eval,
+                                              [&]( const residual_type& forward,
+                                                   const residual_type& base,
+                                                   double               epsilon )
+                                              {
+                                                  for( size_t row = 0; row < ResidualN; row++ )
+                                                  {
+                                                      J( row, i ) = ( forward[row] - base[row] ) / epsilon;
+                                                  }
+                                              } );
+            }
+        }
+
+        /// @brief Numerical Jacobian configuration
+        Numeric_Jacobian_Options m_jacobian_options;
+
+}; // End of Two_Block_Model_Base class
+
+} // End of tmns::math::optimize namespace
@@ -0,0 +1,259 @@
+/**
+ * @file    Parallel_For.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include "Thread_Pool.hpp"
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <initializer_list>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace tmns::math::parallel {
+
+/**
+ * Number of chunks parallel_for_chunks() splits [begin,end) into.
+ */
+inline size_t chunk_count( size_t begin,
+                           size_t end,
+                           size_t grain )
+{
+    grain = std::max<size_t>( grain, 1 );
+    return ( end > begin ) ? ( ( end - begin + grain - 1 ) / grain ) : 0;
+}
+
+namespace detail {
+
+/**
+ * Run worker on the calling thread and on enough pool threads to cover the
+ * remaining chunks, then rethrow the first exception.  An exception on the
+ * calling thread stops further chunks from being claimed.
+ */
+template <typename WorkerT>
+void run_workers( WorkerT&             worker,
+                  std::atomic<size_t>& next_chunk,
+                  size_t               num_chunks,
+                  Thread_Pool&         pool )
+{
+    const size_t num_helpers = std::min( pool.size(), num_chunks - 1 );
+    std::vector<std::future<void>> helpers;
+    helpers.reserve( num_helpers );
+    for( size_t i = 0; i < num_helpers; i++ )
+    {
+        helpers.push_back( pool.submit( worker ) );
+    }
+
+    std::exception_ptr error;
+    try
+    {
+        worker();
+    }
+    catch( ... )
+    {
+        error = std::current_exception();
+        next_chunk = num_chunks;
+    }
+    for( auto& helper : helpers )
+    {
+        try
+        {
+            helper.get();
+        }
+        catch( ... )
+        {
+            if( !error )
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+    if( error )
+    {
+        std::rethrow_exception( error );
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Split [begin,end) into chunks of `grain` elements and call
+ * func( chunk_index, chunk_begin, chunk_end ) for each, spreading the chunks
+ * over the pool.  The calling thread also takes chunks.
+ *
+ * Chunk boundaries depend only on the range and grain, never on the number of
+ * threads, so per-chunk partial results merged in chunk order are reproducible
+ * regardless of pool size.  Nested calls from inside a pool worker run serially.
+ * The first exception thrown by func is rethrown once all chunks finish.
+ */
+template <typename FuncT>
+void parallel_for_chunks( size_t       begin,
+                          size_t       end,
+                          size_t       grain,
+                          FuncT&&      func,
+                          Thread_Pool& pool = Thread_Pool::global() )
+{
+    grain = std::max<size_t>( grain, 1 );
+    const size_t num_chunks = chunk_count( begin, end, grain );
+    if( num_chunks == 0 )
+    {
+        return;
+    }
+
+    // Run inline if there is nothing to share
+    if( num_chunks == 1 || pool.size() <= 1 || Thread_Pool::in_worker() )
+    {
+        for( size_t chunk = 0; chunk < num_chunks; chunk++ )
+        {
+            size_t chunk_begin = begin + chunk * grain;
+            func( chunk, chunk_begin, std::min( chunk_begin + grain, end ) );
+        }
+        return;
+    }
+
+    // Workers pull chunk indices until the range is exhausted
+    std::atomic<size_t> next_chunk { 0 };
+    auto worker = [&]()
+    {
+        size_t chunk;
+        while( ( chunk = next_chunk.fetch_add( 1 ) ) < num_chunks )
+        {
+            size_t chunk_begin = begin + chunk * grain;
+            func( chunk, chunk_begin, std::min( chunk_begin + grain, end ) );
+        }
+    };
+    detail::run_workers( worker, next_chunk, num_chunks, pool );
+}
+
+/**
+ * Call func( chunk_begin, chunk_end ) over [begin,end) split into chunks of
+ * `grain` elements, in parallel.  See parallel_for_chunks().
+ */
+template <typename FuncT>
+void parallel_for( size_t       begin,
+                   size_t       end,
+                   size_t       grain,
+                   FuncT&&      func,
+                   Thread_Pool& pool = Thread_Pool::global() )
+{
+    parallel_for_chunks( begin,
+                         end,
+                         grain,
+                         [&]( size_t, size_t chunk_begin, size_t chunk_end )
+                         {
+                             func( chunk_begin, chunk_end );
+                         },
+                         pool );
+}
+
+/**
+ * As parallel_for(), but each participating thread first creates its own state
+ * with make_state() and then calls func( state, chunk_begin, chunk_end ) for
+ * every chunk it claims.  Use this for per-thread scratch buffers which are too
+ * expensive to rebuild for every chunk.  Threads claim chunks dynamically, so
+ * which state handles which chunk varies from run to run.
+ */
+template <typename StateFactoryT,
+          typename FuncT>
+void parallel_for_with_state( size_t          begin,
+                              size_t          end,
+                              size_t          grain,
+                              StateFactoryT&& make_state,
+                              FuncT&&         func,
+                              Thread_Pool&    pool = Thread_Pool::global() )
+{
+    grain = std::max<size_t>( grain, 1 );
+    const size_t num_chunks = chunk_count( begin, end, grain );
+    if( num_chunks == 0 )
+    {
+        return;
+    }
+
+    // Run inline if there is nothing to share
+    if( num_chunks == 1 || pool.size() <= 1 || Thread_Pool::in_worker() )
+    {
+        auto state = make_state();
+        for( size_t chunk_begin = begin; chunk_begin < end; chunk_begin += grain )
+        {
+            func( state, chunk_begin, std::min( chunk_begin + grain, end ) );
+        }
+        return;
+    }
+
+    std::atomic<size_t> next_chunk { 0 };
+    auto worker = [&]()
+    {
+        auto state = make_state();
+        size_t chunk;
+        while( ( chunk = next_chunk.fetch_add( 1 ) ) < num_chunks )
+        {
+            size_t chunk_begin = begin + chunk * grain;
+            func( state, chunk_begin, std::min( chunk_begin + grain, end ) );
+        }
+    };
+    detail::run_workers( worker, next_chunk, num_chunks, pool );
+}
+
+/**
+ * Call func( state, first, used ) for each group of WidthN consecutive items of
+ * [0,count), where used is WidthN but for a short last group.  For kernels which
+ * work on WidthN items side by side, such as the batched solvers; state comes from
+ * make_state() once per participating thread, as in parallel_for_with_state(), and
+ * grain counts groups.
+ */
+template <size_t   WidthN,
+          typename StateFactoryT,
+          typename FuncT>
+void parallel_for_groups( size_t          count,
+                          size_t          grain,
+                          StateFactoryT&& make_state,
+                          FuncT&&         func,
+                          Thread_Pool&    pool = Thread_Pool::global() )
+{
+    const size_t num_groups = ( count + WidthN - 1 ) / WidthN;
+    parallel_for_with_state( 0,
+                             num_groups,
+                             grain,
+                             make_state,
+                             [&]( auto& state, size_t begin, size_t end )
+                             {
+                                 for( size_t group = begin; group < end; group++ )
+                                 {
+                                     const size_t first = group * WidthN;
+                                     func( state, first, std::min( WidthN, count - first ) );
+                                 }
+                             },
+                             pool );
+}
+
+/**
+ * Throw std::runtime_error unless every one of sizes equals count, e.g. for the
+ * input and output spans of a batch operation.  name begins the message.
+ */
+inline void check_batch_sizes( const char*                   name,
+                               size_t                        count,
+                               std::initializer_list<size_t> sizes )
+{
+    if( std::all_of( sizes.begin(), sizes.end(), [count]( size_t size ){ return size == count; } ) )
+    {
+        return;
+    }
+
+    std::stringstream sout;
+    sout << name << ": mismatched batch sizes.  Expected " << count << ", got:";
+    for( const size_t size : sizes )
+    {
+        sout << " " << size;
+    }
+    throw std::runtime_error( sout.str() );
+}
+
+} // End of tmns::math::parallel namespace
@@ -0,0 +1,105 @@
+/**
+ * @file    Thread_Pool.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// C++ Libraries
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace tmns::math::parallel {
+
+/**
+ * @class Thread_Pool
+ *
+ * Fixed-size pool of worker threads consuming a shared FIFO of tasks.  Bulk
+ * operations in the math library use the process-wide instance returned by
+ * global(), usually through parallel_for() rather than directly.
+ */
+class Thread_Pool
+{
+    public:
+
+        /**
+         * Create a pool with the requested number of workers.  Zero selects
+         * std::thread::hardware_concurrency().
+         */
+        explicit Thread_Pool( size_t num_threads = 0 );
+
+        /**
+         * Destructor.  Finishes queued tasks, then joins all workers.
+         */
+        ~Thread_Pool();
+
+        Thread_Pool( const Thread_Pool& ) = delete;
+        Thread_Pool& operator = ( const Thread_Pool& ) = delete;
+
+        /**
+         * Get the number of worker threads
+         */
+        size_t size() const;
+
+        /**
+         * Queue a task for execution.  The returned future carries the result
+         * or any exception thrown by the task.
+         */
+        template <typename FuncT>
+        std::future<std::invoke_result_t<FuncT>> submit( FuncT&& func )
+        {
+            using result_t = std::invoke_result_t<FuncT>;
+            auto task = std::make_shared<std::packaged_task<result_t()>>( std::forward<FuncT>( func ) );
+            auto result = task->get_future();
+            enqueue( [task](){ (*task)(); } );
+            return result;
+        }
+
+        /**
+         * Check if the calling thread is a worker of any Thread_Pool.  Used to
+         * run nested parallel regions inline rather than deadlocking the pool.
+         */
+        static bool in_worker();
+
+        /**
+         * Get the process-wide pool
+         */
+        static Thread_Pool& global();
+
+    private:
+
+        /**
+         * Push a type-erased task onto the queue
+         */
+        void enqueue( std::function<void()> task );
+
+        /**
+         * Worker thread main loop
+         */
+        void worker_loop();
+
+        /// @brief Worker Threads
+        std::vector<std::thread> m_workers;
+
+        /// @brief Pending Tasks
+        std::deque<std::function<void()>> m_tasks;
+
+        /// @brief Queue Lock
+        std::mutex m_mutex;
+
+        /// @brief Signals new tasks or shutdown
+        std::condition_variable m_condition;
+
+        /// @brief Shutdown flag
+        bool m_stop { false };
+
+}; // End of Thread_Pool class
+
+} // End of tmns::math::parallel namespace
@@ -0,0 +1,563 @@
+/**
+ * @file    Jet.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include "Fundamental_Types.hpp"
+
+// C++ Libraries
+#include <array>
+#include <cmath>
+#include <ostream>
+#include <type_traits>
+
+namespace tmns::math {
+
+/**
+ * @class Jet
+ *
+ * Dual number for forward-mode automatic differentiation.  A Jet carries a value
+ * along with its partial derivatives with respect to N independent variables, and
+ * every arithmetic operation and math function propagates both using the chain rule.
+ *
+ * Code written against a generic scalar type (e.g. `template <typename T> ... sin( x ) ...`)
+ * evaluated with Jets returns the exact derivatives of its outputs in the same pass.
+ * Call math functions unqualified (`sin( x )`, not `std::sin( x )`) so the Jet overloads
+ * are found through argument-dependent lookup; add `using std::sin;` for plain doubles.
+ *
+ * Jets are registered as scalars, so they work as the value type of Vector_, VectorN,
+ * Matrix and MatrixN, and promote with double in mixed expressions.
+ */
+template <typename ValueT,
+          int      N>
+class Jet
+{
+    public:
+
+        static_assert( N > 0, "Jet must have at least one derivative" );
+
+        /// @brief Scalar Type
+        using value_type = ValueT;
+
+        /// @brief Derivative Storage Type
+        using derivative_type = std::array<ValueT,N>;
+
+        /**
+         * Default Constructor.  Zero value and derivatives.
+         */
+        Jet() = default;
+
+        /**
+         * Create a constant.  Implicit so literals and doubles mix with Jets.
+         */
+        Jet( ValueT value )
+            : m_value( value )
+        {
+        }
+
+        /**
+         * Create the independent variable with the given index
+         *
+         * @param value Value of the variable
+         * @param index Which derivative is seeded with 1
+         */
+        Jet( ValueT value,
+             int    index )
+            : m_value( value )
+        {
+            m_derivatives[index] = 1;
+        }
+
+        /**
+         * Create a Jet from its value and derivatives
+         */
+        Jet( ValueT                 value,
+             const derivative_type& derivatives )
+            : m_value( value ),
+              m_derivatives( derivatives )
+        {
+        }
+
+        /**
+         * Get the number of derivatives carried
+         */
+        static constexpr int size()
+        {
+            return N;
+        }
+
+        /**
+         * Get the value
+         */
+        ValueT value() const
+        {
+            return m_value;
+        }
+
+        /**
+         * Get the value
+         */
+        ValueT& value()
+        {
+            return m_value;
+        }
+
+        /**
+         * Get the partial derivative w.r.t. variable idx
+         */
+        ValueT derivative( int idx ) const
+        {
+            return m_derivatives[idx];
+        }
+
+        /**
+         * Get the partial derivative w.r.t. variable idx
+         */
+        ValueT& derivative( int idx )
+        {
+            return m_derivatives[idx];
+        }
+
+        /**
+         * Get all partial derivatives
+         */
+        const derivative_type& derivatives() const
+        {
+            return m_derivatives;
+        }
+
+        /**
+         * Get all partial derivatives
+         */
+        derivative_type& derivatives()
+        {
+            return m_derivatives;
+        }
+
+        /**
+         * Build a Jet from a value and derivatives scaled by a factor.
+         * This is the chain rule for a unary function, where scale is f'(value).
+         */
+        Jet chain( ValueT value,
+                   ValueT scale ) const
+        {
+            Jet result( value );
+            for( int i = 0; i < N; i++ )
+            {
+                result.m_derivatives[i] = scale * m_derivatives[i];
+            }
+            return result;
+        }
+
+        /**
+         * Build a Jet from a value and a linear combination of two Jets' derivatives.
+         * This is the chain rule for a binary function.
+         */
+        static Jet chain( ValueT     value,
+                          ValueT     scale_a,
+                          const Jet& a,
+                          ValueT     scale_b,
+                          const Jet& b )
+        {
+            Jet result( value );
+            for( int i = 0; i < N; i++ )
+            {
+                result.m_derivatives[i] = scale_a * a.m_derivatives[i] + scale_b * b.m_derivatives[i];
+            }
+            return result;
+        }
+
+        /**
+         * Addition Assignment
+         */
+        Jet& operator += ( const Jet& rhs )
+        {
+            m_value += rhs.m_value;
+            for( int i = 0; i < N; i++ )
+            {
+                m_derivatives[i] += rhs.m_derivatives[i];
+            }
+            return (*this);
+        }
+
+        /**
+         * Addition Assignment with a constant
+         */
+        Jet& operator += ( ValueT rhs )
+        {
+            m_value += rhs;
+            return (*this);
+        }
+
+        /**
+         * Subtraction Assignment
+         */
+        Jet& operator -= ( const Jet& rhs )
+        {
+            m_value -= rhs.m_value;
+            for( int i = 0; i < N; i++ )
+            {
+                m_derivatives[i] -= rhs.m_derivatives[i];
+            }
+            return (*this);
+        }
+
+        /**
+         * Subtraction Assignment with a constant
+         */
+        Jet& operator -= ( ValueT rhs )
+        {
+            m_value -= rhs;
+            return (*this);
+        }
+
+        /**
+         * Multiplication Assignment
+         */
+        Jet& operator *= ( const Jet& rhs )
+        {
+            (*this) = (*this) * rhs;
+            return (*this);
+        }
+
+        /**
+         * Multiplication Assignment with a constant
+         */
+        Jet& operator *= ( ValueT rhs )
+        {
+            m_value *= rhs;
+            for( int i = 0; i < N; i++ )
+            {
+                m_derivatives[i] *= rhs;
+            }
+            return (*this);
+        }
+
+        /**
+         * Division Assignment
+         */
+        Jet& operator /= ( const Jet& rhs )
+        {
+            (*this) = (*this) / rhs;
+            return (*this);
+        }
+
+        /**
+         * Division Assignment with a constant
+         */
+        Jet& operator /= ( ValueT rhs )
+        {
+            return (*this) *= ( ValueT( 1 ) / rhs );
+        }
+
+        /**
+         * Negation
+         */
+        friend Jet operator - ( const Jet& a )
+        {
+            return a.chain( -a.m_value, -1 );
+        }
+
+        /**
+         * Unary Plus
+         */
+        friend Jet operator + ( const Jet& a )
+        {
+            return a;
+        }
+
+        friend Jet operator + ( Jet a, const Jet& b )    { return a += b; }
+        friend Jet operator + ( Jet a, ValueT b )        { return a += b; }
+        friend Jet operator + ( ValueT a, Jet b )        { return b += a; }
+
+        friend Jet operator - ( Jet a, const Jet& b )    { return a -= b; }
+        friend Jet operator - ( Jet a, ValueT b )        { return a -= b; }
+        friend Jet operator - ( ValueT a, const Jet& b ) { return b.chain( a - b.m_value, -1 ); }
+
+        friend Jet operator * ( Jet a, ValueT b )        { return a *= b; }
+        friend Jet operator * ( ValueT a, Jet b )        { return b *= a; }
+
+        friend Jet operator / ( Jet a, ValueT b )        { return a /= b; }
+
+        /**
+         * Product Rule
+         */
+        friend Jet operator * ( const Jet& a, const Jet& b )
+        {
+            return chain( a.m_value * b.m_value, b.m_value, a, a.m_value, b );
+        }
+
+        /**
+         * Quotient Rule
+         */
+        friend Jet operator / ( const Jet& a, const Jet& b )
+        {
+            const ValueT inv   = ValueT( 1 ) / b.m_value;
+            const ValueT value = a.m_value * inv;
+            return chain( value, inv, a, -value * inv, b );
+        }
+
+        /**
+         * Constant divided by a Jet
+         */
+        friend Jet operator / ( ValueT a, const Jet& b )
+        {
+            const ValueT value = a / b.m_value;
+            return b.chain( value, -value / b.m_value );
+        }
+
+        // Comparisons only consider the value, so branches in models behave as with doubles
+        friend bool operator == ( const Jet& a, const Jet& b ) { return a.m_value == b.m_value; }
+        friend bool operator != ( const Jet& a, const Jet& b ) { return a.m_value != b.m_value; }
+        friend bool operator <  ( const Jet& a, const Jet& b ) { return a.m_value <  b.m_value; }
+        friend bool operator <= ( const Jet& a, const Jet& b ) { return a.m_value <= b.m_value; }
+        friend bool operator >  ( const Jet& a, const Jet& b ) { return a.m_value >  b.m_value; }
+        friend bool operator >= ( const Jet& a, const Jet& b ) { return a.m_value >= b.m_value; }
+
+        /**
+         * Print the value and derivatives
+         */
+        friend std::ostream& operator << ( std::ostream& ostr,
+                                           const Jet&    jet )
+        {
+            ostr << "[" << jet.m_value << "; ";
+            for( int i = 0; i < N; i++ )
+            {
+                ostr << ( i == 0 ? "" : ", " ) << jet.m_derivatives[i];
+            }
+            return ostr << "]";
+        }
+
+    private:
+
+        /// @brief Function Value
+        ValueT m_value { 0 };
+
+        /// @brief Partial Derivatives
+        derivative_type m_derivatives {};
+
+}; // End of Jet class
+
+/**
+ * Jets are scalars as far as the vector and matrix expressions are concerned
+ */
+template <typename ValueT, int N> struct Is_Scalar<Jet<ValueT,N>> : public std::true_type {};
+
+template <typename ValueT, int N> struct Accumulator_Type<Jet<ValueT,N>> { typedef Jet<ValueT,N> type; };
+
+/**
+ * Get the value of a scalar, stripping derivatives off a Jet
+ */
+template <typename ValueT>
+ValueT scalar_value( const ValueT& value )
+{
+    return value;
+}
+
+template <typename ValueT,
+          int      N>
+ValueT scalar_value( const Jet<ValueT,N>& value )
+{
+    return value.value();
+}
+
+/****************************************/
+/*      Standard Math Functions         */
+/****************************************/
+
+template <typename T, int N>
+Jet<T,N> abs( const Jet<T,N>& x )
+{
+    return x.value() < 0 ? -x : x;
+}
+
+template <typename T, int N>
+Jet<T,N> fabs( const Jet<T,N>& x )
+{
+    return abs( x );
+}
+
+template <typename T, int N>
+Jet<T,N> sqrt( const Jet<T,N>& x )
+{
+    const T value = std::sqrt( x.value() );
+    return x.chain( value, T( 0.5 ) / value );
+}
+
+template <typename T, int N>
+Jet<T,N> cbrt( const Jet<T,N>& x )
+{
+    const T value = std::cbrt( x.value() );
+    return x.chain( value, T( 1 ) / ( 3 * value * value ) );
+}
+
+template <typename T, int N>
+Jet<T,N> exp( const Jet<T,N>& x )
+{
+    const T value = std::exp( x.value() );
+    return x.chain( value, value );
+}
+
+template <typename T, int N>
+Jet<T,N> log( const Jet<T,N>& x )
+{
+    return x.chain( std::log( x.value() ), T( 1 ) / x.value() );
+}
+
+template <typename T, int N>
+Jet<T,N> log10( const Jet<T,N>& x )
+{
+    return x.chain( std::log10( x.value() ), T( 1 ) / ( x.value() * std::log( T( 10 ) ) ) );
+}
+
+template <typename T, int N>
+Jet<T,N> sin( const Jet<T,N>& x )
+{
+    return x.chain( std::sin( x.value() ), std::cos( x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> cos( const Jet<T,N>& x )
+{
+    return x.chain( std::cos( x.value() ), -std::sin( x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> tan( const Jet<T,N>& x )
+{
+    const T value = std::tan( x.value() );
+    return x.chain( value, 1 + value * value );
+}
+
+template <typename T, int N>
+Jet<T,N> asin( const Jet<T,N>& x )
+{
+    return x.chain( std::asin( x.value() ), T( 1 ) / std::sqrt( 1 - x.value() * x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> acos( const Jet<T,N>& x )
+{
+    return x.chain( std::acos( x.value() ), T( -1 ) / std::sqrt( 1 - x.value() * x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> atan( const Jet<T,N>& x )
+{
+    return x.chain( std::atan( x.value() ), T( 1 ) / ( 1 + x.value() * x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> sinh( const Jet<T,N>& x )
+{
+    return x.chain( std::sinh( x.value() ), std::cosh( x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> cosh( const Jet<T,N>& x )
+{
+    return x.chain( std::cosh( x.value() ), std::sinh( x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> tanh( const Jet<T,N>& x )
+{
+    const T value = std::tanh( x.value() );
+    return x.chain( value, 1 - value * value );
+}
+
+/**
+ * Floor and ceiling are piecewise constant, so the derivative is zero
+ */
+template <typename T, int N>
+Jet<T,N> floor( const Jet<T,N>& x )
+{
+    return Jet<T,N>( std::floor( x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> ceil( const Jet<T,N>& x )
+{
+    return Jet<T,N>( std::ceil( x.value() ) );
+}
+
+template <typename T, int N>
+Jet<T,N> atan2( const Jet<T,N>& y,
+                const Jet<T,N>& x )
+{
+    const T inv = T( 1 ) / ( x.value() * x.value() + y.value() * y.value() );
+    return Jet<T,N>::chain( std::atan2( y.value(), x.value() ), -y.value() * inv, x, x.value() * inv, y );
+}
+
+/**
+ * Mixed Jet/scalar overloads take the scalar as std::type_identity_t<T>, so it is not
+ * deduced and converts from int or float, e.g. pow( x, 2 ).
+ */
+template <typename T, int N>
+Jet<T,N> atan2( const Jet<T,N>&         y,
+                std::type_identity_t<T> x )
+{
+    return atan2( y, Jet<T,N>( x ) );
+}
+
+template <typename T, int N>
+Jet<T,N> atan2( std::type_identity_t<T> y,
+                const Jet<T,N>&         x )
+{
+    return atan2( Jet<T,N>( y ), x );
+}
+
+template <typename T, int N>
+Jet<T,N> hypot( const Jet<T,N>& x,
+                const Jet<T,N>& y )
+{
+    const T value = std::hypot( x.value(), y.value() );
+    return Jet<T,N>::chain( value, x.value() / value, x, y.value() / value, y );
+}
+
+template <typename T, int N>
+Jet<T,N> pow( const Jet<T,N>&         x,
+              std::type_identity_t<T> p )
+{
+    return x.chain( std::pow( x.value(), p ), p * std::pow( x.value(), p - 1 ) );
+}
+
+template <typename T, int N>
+Jet<T,N> pow( std::type_identity_t<T> b,
+              const Jet<T,N>&         x )
+{
+    const T value = std::pow( b, x.value() );
+    return x.chain( value, value * std::log( b ) );
+}
+
+template <typename T, int N>
+Jet<T,N> pow( const Jet<T,N>& x,
+              const Jet<T,N>& p )
+{
+    const T value = std::pow( x.value(), p.value() );
+    return Jet<T,N>::chain( value,
+                            p.value() * std::pow( x.value(), p.value() - 1 ), x,
+                            value * std::log( x.value() ), p );
+}
+
+template <typename T, int N>
+bool isfinite( const Jet<T,N>& x )
+{
+    if( !std::isfinite( x.value() ) )
+    {
+        return false;
+    }
+    for( int i = 0; i < N; i++ )
+    {
+        if( !std::isfinite( x.derivative( i ) ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // End of tmns::math namespace
@@ -6,7 +6,10 @@
 #pragma once
 
 // C++ Libraries
+#include <cmath>
+#include <limits>
 #include <queue>
+#include <utility>
 
 // Terminus Libraries
 #include <terminus/log/utility.hpp>
@@ -285,10 +288,14 @@ struct Default_Abs_Behavior
 template <>
 struct Default_Abs_Behavior<false>
 {
+    /**
+     * Unqualified so non-builtin scalars such as Jet find their own overload
+     */
     template <typename ValueT>
-    static double apply( ValueT val )
+    static auto apply( ValueT val )
     {
-        return std::fabs( val );
+        using std::fabs;
+        return fabs( val );
     }
 };
 
@@ -304,9 +311,7 @@ struct Arg_Abs_Functor
               typename ValueT>
     struct result<FunctorT(ValueT)>
     {
-        using type = typename std::conditional_t<std::numeric_limits<ValueT>::is_integer,
-                                                int,
-                                                double>;
+        using type = decltype( Default_Abs_Behavior<std::numeric_limits<ValueT>::is_integer>::apply( std::declval<ValueT>() ) );
     };
 
     template <typename FunctorT>
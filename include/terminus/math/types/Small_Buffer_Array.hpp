@@ -0,0 +1,429 @@
+/**
+ * @file    Small_Buffer_Array.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace tmns::math {
+
+/**
+ * @class Small_Buffer_Array
+ *
+ * Resizable, contiguous array which stores up to InlineN elements inside the
+ * object itself and only spills to the heap once that capacity is exceeded.
+ *
+ * This is the storage policy behind the dynamically-sized VectorN and MatrixN
+ * types.  Most of our dynamic vectors and matrices are tiny (parameter vectors,
+ * residuals, small Jacobians), so keeping them off the heap removes the bulk of
+ * the allocations in solvers such as Levenberg-Marquardt.
+ *
+ * The interface is the subset of std::vector used by the math library.  Iterators
+ * are raw pointers and are invalidated by any operation which changes capacity.
+ */
+template <typename ValueT,
+          size_t   InlineN>
+class Small_Buffer_Array
+{
+    public:
+
+        /// @brief Value Type
+        using value_type = ValueT;
+
+        /// @brief Size Type
+        using size_type = size_t;
+
+        /// @brief Reference Type
+        using reference = ValueT&;
+
+        /// @brief Const Reference Type
+        using const_reference = const ValueT&;
+
+        /// @brief Pointer Type
+        using pointer = ValueT*;
+
+        /// @brief Const Pointer Type
+        using const_pointer = const ValueT*;
+
+        /// @brief Iterator Type
+        using iterator = ValueT*;
+
+        /// @brief Const Iterator Type
+        using const_iterator = const ValueT*;
+
+        /**
+         * Default Constructor.  Creates an empty array using the inline buffer.
+         */
+        Small_Buffer_Array() = default;
+
+        /**
+         * Create an array of the given size, value-initializing each element.
+         */
+        explicit Small_Buffer_Array( size_t count )
+        {
+            resize( count );
+        }
+
+        /**
+         * Create an array of the given size, setting each element to value.
+         */
+        Small_Buffer_Array( size_t        count,
+                            const ValueT& value )
+        {
+            resize( count, value );
+        }
+
+        /**
+         * Create an array from an initializer list
+         */
+        Small_Buffer_Array( std::initializer_list<ValueT> data )
+        {
+            assign( data.begin(), data.end() );
+        }
+
+        /**
+         * Create an array from an iterator range
+         */
+        template <typename IteratorT>
+        Small_Buffer_Array( IteratorT first,
+                            IteratorT last ) requires ( !std::is_integral_v<IteratorT> )
+        {
+            assign( first, last );
+        }
+
+        /**
+         * Copy Constructor
+         */
+        Small_Buffer_Array( const Small_Buffer_Array& other )
+        {
+            assign( other.begin(), other.end() );
+        }
+
+        /**
+         * Move Constructor.  Steals the heap buffer if the source has spilled.
+         */
+        Small_Buffer_Array( Small_Buffer_Array&& other ) noexcept
+        {
+            steal( std::move( other ) );
+        }
+
+        /**
+         * Copy Assignment Operator
+         */
+        Small_Buffer_Array& operator = ( const Small_Buffer_Array& other )
+        {
+            if( this != &other )
+            {
+                assign( other.begin(), other.end() );
+            }
+            return (*this);
+        }
+
+        /**
+         * Move Assignment Operator
+         */
+        Small_Buffer_Array& operator = ( Small_Buffer_Array&& other ) noexcept
+        {
+            if( this != &other )
+            {
+                m_heap.reset();
+                m_size     = 0;
+                m_capacity = InlineN;
+                steal( std::move( other ) );
+            }
+            return (*this);
+        }
+
+        /**
+         * Replace the contents with the given iterator range
+         */
+        template <typename IteratorT>
+        void assign( IteratorT first,
+                     IteratorT last )
+        {
+            using category_t = typename std::iterator_traits<IteratorT>::iterator_category;
+            if constexpr ( std::is_base_of_v<std::forward_iterator_tag,category_t> )
+            {
+                size_t count = std::distance( first, last );
+                reserve_discard( count );
+                std::copy( first, last, data() );
+                m_size = count;
+            }
+            else
+            {
+                clear();
+                for( ; first != last; ++first )
+                {
+                    push_back( *first );
+                }
+            }
+        }
+
+        /**
+         * Get the number of elements
+         */
+        size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * Check if the array is empty
+         */
+        bool empty() const
+        {
+            return m_size == 0;
+        }
+
+        /**
+         * Get the number of elements which can be stored without reallocating
+         */
+        size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        /**
+         * Get the inline capacity of this array type
+         */
+        static constexpr size_t inline_capacity()
+        {
+            return InlineN;
+        }
+
+        /**
+         * Check if the elements are currently stored inside the object
+         */
+        bool is_inline() const
+        {
+            return !m_heap;
+        }
+
+        /**
+         * Remove all elements.  Capacity is retained.
+         */
+        void clear()
+        {
+            m_size = 0;
+        }
+
+        /**
+         * Make sure the array can hold at least new_capacity elements, preserving contents.
+         */
+        void reserve( size_t new_capacity )
+        {
+            if( new_capacity <= m_capacity )
+            {
+                return;
+            }
+            auto new_heap = std::make_unique<ValueT[]>( new_capacity );
+            std::move( begin(), end(), new_heap.get() );
+            m_heap     = std::move( new_heap );
+            m_capacity = new_capacity;
+        }
+
+        /**
+         * Resize the array, value-initializing any new elements
+         */
+        void resize( size_t new_size )
+        {
+            resize( new_size, ValueT() );
+        }
+
+        /**
+         * Resize the array, setting any new elements to value
+         */
+        void resize( size_t        new_size,
+                     const ValueT& value )
+        {
+            if( new_size > m_capacity )
+            {
+                reserve( std::max( new_size, 2 * m_capacity ) );
+            }
+            if( new_size > m_size )
+            {
+                std::fill( data() + m_size, data() + new_size, value );
+            }
+            m_size = new_size;
+        }
+
+        /**
+         * Append an element to the end of the array
+         */
+        void push_back( const ValueT& value )
+        {
+            if( m_size == m_capacity )
+            {
+                // Copy first, as value may reference an element we are about to move
+                ValueT temp = value;
+                reserve( 2 * m_capacity + 1 );
+                data()[m_size++] = std::move( temp );
+                return;
+            }
+            data()[m_size++] = value;
+        }
+
+        /**
+         * Swap contents with another array
+         */
+        void swap( Small_Buffer_Array& other ) noexcept
+        {
+            Small_Buffer_Array temp( std::move( other ) );
+            other = std::move( *this );
+            (*this) = std::move( temp );
+        }
+
+        /**
+         * Index Operator
+         */
+        reference operator[]( size_t idx )
+        {
+            return data()[idx];
+        }
+
+        /**
+         * Index Operator
+         */
+        const_reference operator[]( size_t idx ) const
+        {
+            return data()[idx];
+        }
+
+        /**
+         * Bounds-checked element access
+         */
+        reference at( size_t idx )
+        {
+            check_range( idx );
+            return data()[idx];
+        }
+
+        /**
+         * Bounds-checked element access
+         */
+        const_reference at( size_t idx ) const
+        {
+            check_range( idx );
+            return data()[idx];
+        }
+
+        /**
+         * Get pointer to the underlying data
+         */
+        pointer data()
+        {
+            return m_heap ? m_heap.get() : m_inline;
+        }
+
+        /**
+         * Get pointer to the underlying data
+         */
+        const_pointer data() const
+        {
+            return m_heap ? m_heap.get() : m_inline;
+        }
+
+        /**
+         * Get the starting iterator position
+         */
+        iterator begin()
+        {
+            return data();
+        }
+
+        /**
+         * Get the starting iterator position
+         */
+        const_iterator begin() const
+        {
+            return data();
+        }
+
+        /**
+         * Get the ending iterator position
+         */
+        iterator end()
+        {
+            return data() + m_size;
+        }
+
+        /**
+         * Get the ending iterator position
+         */
+        const_iterator end() const
+        {
+            return data() + m_size;
+        }
+
+    private:
+
+        /**
+         * Make sure the array can hold count elements, discarding contents.
+         */
+        void reserve_discard( size_t count )
+        {
+            m_size = 0;
+            if( count > m_capacity )
+            {
+                m_heap     = std::make_unique<ValueT[]>( count );
+                m_capacity = count;
+            }
+        }
+
+        /**
+         * Take ownership of another array's contents.  Assumes this array is empty.
+         */
+        void steal( Small_Buffer_Array&& other )
+        {
+            if( other.m_heap )
+            {
+                m_heap     = std::move( other.m_heap );
+                m_capacity = other.m_capacity;
+            }
+            else
+            {
+                std::move( other.begin(), other.end(), m_inline );
+            }
+            m_size           = other.m_size;
+            other.m_size     = 0;
+            other.m_capacity = InlineN;
+        }
+
+        /**
+         * Throw if the index is out of range
+         */
+        void check_range( size_t idx ) const
+        {
+            if( idx >= m_size )
+            {
+                std::stringstream sout;
+                sout << "Small_Buffer_Array: index " << idx << " out of range for size " << m_size;
+                throw std::out_of_range( sout.str() );
+            }
+        }
+
+        /// @brief Inline element storage
+        ValueT m_inline[InlineN > 0 ? InlineN : 1] {};
+
+        /// @brief Heap storage, used once capacity exceeds InlineN
+        std::unique_ptr<ValueT[]> m_heap;
+
+        /// @brief Number of elements
+        size_t m_size { 0 };
+
+        /// @brief Number of elements storable without reallocating
+        size_t m_capacity { InlineN };
+
+}; // End of Small_Buffer_Array class
+
+} // End of tmns::math namespace
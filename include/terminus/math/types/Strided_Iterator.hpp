@@ -0,0 +1,111 @@
+/**
+ * @file    Strided_Iterator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Boost Libraries
+#include <boost/iterator/iterator_facade.hpp>
+
+// C++ Libraries
+#include <cstddef>
+
+namespace tmns::math {
+
+/**
+ * @class Strided_Iterator<ValueT>
+ *
+ * Random-access iterator over every stride-th element of a buffer.  The
+ * stride is in elements and may be negative.
+ */
+template <typename ValueT>
+class Strided_Iterator : public boost::iterator_facade<Strided_Iterator<ValueT>,
+                                                       ValueT,
+                                                       boost::random_access_traversal_tag>
+{
+    public:
+
+        /// @brief Pointer Difference Type
+        using difference_type = typename Strided_Iterator::difference_type;
+
+        /**
+         * Constructor
+         *
+         * @param base   Pointer to element 0
+         * @param stride Distance between elements
+         * @param index  Starting element index
+         */
+        Strided_Iterator( ValueT*         base,
+                          std::ptrdiff_t  stride,
+                          difference_type index = 0 )
+            : m_base( base ),
+              m_stride( stride ),
+              m_index( index )
+        {}
+
+    private:
+
+        friend class boost::iterator_core_access;
+
+        /**
+         * Check if another iterator is at the same position
+         */
+        bool equal( const Strided_Iterator& iter ) const
+        {
+            return m_index == iter.m_index;
+        }
+
+        /**
+         * Number of elements to another iterator
+         */
+        difference_type distance_to( const Strided_Iterator& iter ) const
+        {
+            return iter.m_index - m_index;
+        }
+
+        /**
+         * Move to the next element
+         */
+        void increment()
+        {
+            ++m_index;
+        }
+
+        /**
+         * Move to the previous element
+         */
+        void decrement()
+        {
+            --m_index;
+        }
+
+        /**
+         * Advance N elements
+         */
+        void advance( difference_type n )
+        {
+            m_index += n;
+        }
+
+        /**
+         * Dereference the iterator.  The offset is only formed for valid elements,
+         * so end iterators never point past the underlying buffer.
+         */
+        ValueT& dereference() const
+        {
+            return m_base[ m_index * m_stride ];
+        }
+
+        /// @brief Element 0
+        ValueT* m_base { nullptr };
+
+        /// @brief Distance between elements
+        std::ptrdiff_t m_stride { 1 };
+
+        /// @brief Current element index
+        difference_type m_index { 0 };
+
+}; // End of Strided_Iterator class
+
+} // End of tmns::math namespace
@@ -0,0 +1,41 @@
+/**
+ * @file    Strided_View.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// C++ Libraries
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tmns::math {
+
+/**
+ * Any multi-dimensional view with the std::mdspan interface and a strided layout:
+ * static rank() and is_always_strided(), extent(r), stride(r) and data_handle().
+ *
+ * std::mdspan satisfies it where the standard library ships one, and so do the
+ * reference implementation (std::experimental::mdspan / Kokkos::mdspan) and simple
+ * user types, so Matrix_Proxy and Vector_Proxy can wrap them on any toolchain.
+ */
+template <typename ViewT,
+          size_t   RankN>
+concept Strided_View = requires( const ViewT& view, size_t r )
+{
+    { ViewT::rank() }              -> std::convertible_to<size_t>;
+    { ViewT::is_always_strided() } -> std::convertible_to<bool>;
+    { view.extent( r ) }           -> std::convertible_to<size_t>;
+    { view.stride( r ) }           -> std::convertible_to<size_t>;
+    { view.data_handle() };
+} && ( ViewT::rank() == RankN ) && ViewT::is_always_strided();
+
+/**
+ * Element type of a Strided_View, taken from its data handle
+ */
+template <typename ViewT>
+using Strided_View_Element = std::remove_pointer_t<decltype( std::declval<const ViewT&>().data_handle() )>;
+
+} // End of tmns::math namespace
@@ -10,6 +10,8 @@
 #include <cmath>
 #include <iostream>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 
 // Terminus Libraries
 #include <terminus/math/types/Fundamental_Types.hpp>
@@ -367,10 +369,13 @@ class Vector_ : public Vector_Base<Vector_<ValueT,Dims>>
          */
         template <typename Vector1T,
                   typename Vector2T>
-        static double dot( const Vector_Base<Vector1T>& vec1,
-                           const Vector_Base<Vector2T>& vec2 )
+        static auto dot( const Vector_Base<Vector1T>& vec1,
+                         const Vector_Base<Vector2T>& vec2 )
         {
-            double mag = 0;
+            // Arithmetic types accumulate in double, others (e.g. Jet) in their own type
+            using product_type = decltype( std::declval<typename Vector1T::value_type>() *
+                                           std::declval<typename Vector2T::value_type>() );
+            std::conditional_t<std::is_arithmetic_v<product_type>,double,product_type> mag = 0;
 
             auto it1 = vec1.impl().begin();
             auto it2 = vec2.impl().begin();
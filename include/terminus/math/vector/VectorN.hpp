@@ -6,6 +6,7 @@
 #pragma once
 
 // Terminus Math Libraries
+#include "../types/Small_Buffer_Array.hpp"
 #include "Vector.hpp"
 
 // C++ Libraries
@@ -16,6 +17,9 @@ namespace tmns::math {
 /**
  * @class VectorN
  * N-dimensional, resizable vector
+ *
+ * Elements are stored inline up to Vector_Inline_Capacity<ValueT>::value, after
+ * which they spill to the heap.
 */
 template <typename ValueT>
 class Vector_<ValueT,0> : public Vector_Base<Vector_<ValueT>>
@@ -26,7 +30,7 @@ class Vector_<ValueT,0> : public Vector_Base<Vector_<ValueT>>
         using value_type = ValueT;
 
         /// @brief Array Type
-        using array_type = std::vector<value_type>;
+        using array_type = Small_Buffer_Array<value_type,Vector_Inline_Capacity<ValueT>::value>;
 
         /// @brief Reference Type
         using reference_type = ValueT&;
@@ -83,8 +87,8 @@ class Vector_<ValueT,0> : public Vector_Base<Vector_<ValueT>>
         */
         explicit Vector_( const ValueT* ptr,
                           size_t        size )
+          : m_data( ptr, ptr + size )
         {
-            std::copy( ptr, ptr + size, m_data.begin() );
         }
 
         /**
@@ -95,13 +99,29 @@ class Vector_<ValueT,0> : public Vector_Base<Vector_<ValueT>>
         {
         }
 
+        /**
+         * Move Constructor
+         */
+        Vector_( Vector_&& other ) noexcept
+            : m_data( std::move( other.m_data ) )
+        {
+        }
+
         /**
          * General Assignment Operator
          */
         Vector_& operator = ( const Vector_& v )
         {
-            Vector_ temp( v );
-            m_data = temp.m_data;
+            m_data = v.m_data;
+            return (*this);
+        }
+
+        /**
+         * Move Assignment Operator
+         */
+        Vector_& operator = ( Vector_&& v ) noexcept
+        {
+            m_data = std::move( v.m_data );
             return (*this);
         }
 
@@ -112,7 +132,7 @@ class Vector_<ValueT,0> : public Vector_Base<Vector_<ValueT>>
         Vector_& operator = ( const Vector_Base<OtherVectorT>& v )
         {
             Vector_ tmp( v );
-            m_data = tmp.m_data;
+            m_data = std::move( tmp.m_data );
             return *this;
         }
 
@@ -142,6 +162,21 @@ class Vector_<ValueT,0> : public Vector_Base<Vector_<ValueT>>
             m_data.clear();
         }
 
+        /**
+         * Resize the vector.  Existing elements are kept when preserve is set,
+         * otherwise the contents are unspecified.  Storage capacity is never
+         * released, so shrinking and regrowing does not allocate.
+         */
+        void set_size( size_t new_size,
+                       bool   preserve = false )
+        {
+            if( !preserve )
+            {
+                m_data.clear();
+            }
+            m_data.resize( new_size, 0 );
+        }
+
         /**
          * Index Operator
         */
@@ -345,10 +380,13 @@ class Vector_<ValueT,0> : public Vector_Base<Vector_<ValueT>>
          */
         template <typename Vector1T,
                   typename Vector2T>
-        static double dot( const Vector_Base<Vector1T>& vec1,
-                           const Vector_Base<Vector2T>& vec2 )
+        static auto dot( const Vector_Base<Vector1T>& vec1,
+                         const Vector_Base<Vector2T>& vec2 )
         {
-            double mag = 0;
+            // Arithmetic types accumulate in double, others (e.g. Jet) in their own type
+            using product_type = decltype( std::declval<typename Vector1T::value_type>() *
+                                           std::declval<typename Vector2T::value_type>() );
+            std::conditional_t<std::is_arithmetic_v<product_type>,double,product_type> mag = 0;
 
             auto it1 = vec1.impl().begin();
             auto it2 = vec2.impl().begin();
@@ -371,7 +409,7 @@ class Vector_<ValueT,0> : public Vector_Base<Vector_<ValueT>>
 
     private:
 
-        std::vector<ValueT> m_data;
+        array_type m_data;
 
 }; // End of Vector_<ValueT,0> Class
 
@@ -6,8 +6,23 @@
 #pragma once
 
 // Terminus Libraries
+#include "../types/Strided_Iterator.hpp"
+#include "../types/Strided_View.hpp"
 #include "Vector.hpp"
 
+// C++ Libraries
+#include <array>
+#include <cstddef>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <version>
+
+#if defined( __cpp_lib_mdspan )
+#include <mdspan>
+#endif
+
 namespace tmns::math {
 
 /**
@@ -36,6 +51,12 @@ class Vector_Proxy : public Vector_Base<Vector_Proxy<ElementT,SizeN>>
         Vector_Proxy( ElementT *ptr )
             : m_ptr( ptr ) {}
 
+        /**
+         * Constructs a vector proxy over a span of exactly SizeN elements.
+         */
+        Vector_Proxy( std::span<ElementT,SizeN> buffer )
+            : m_ptr( buffer.data() ) {}
+
         /**
          * Standard copy assignment operator.
          */
@@ -206,6 +227,14 @@ class Vector_Proxy : public Vector_Base<Vector_Proxy<ElementT,SizeN>>
             return m_ptr + size();
         }
 
+        /**
+         * Get the elements as a span
+         */
+        std::span<ElementT,SizeN> to_span() const
+        {
+            return std::span<ElementT,SizeN>( m_ptr, SizeN );
+        }
+
     private:
 
         ElementT* m_ptr { nullptr };
@@ -235,9 +264,9 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
 
         using const_reference_type = ElementT const&;
 
-        using iter_t = ElementT*;
+        using iter_t = Strided_Iterator<ElementT>;
         
-        using const_iter_t = const ElementT*;
+        using const_iter_t = Strided_Iterator<const ElementT>;
 
         /**
          * Constructs a vector from a buffer
@@ -247,6 +276,60 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
             : m_ptr( ptr ),
               m_size( size ) {}
 
+        /**
+         * Constructs a vector from every stride-th element of a buffer.
+         * The stride is in elements and may be negative.
+         */
+        Vector_Proxy( size_t         size,
+                      ElementT*      ptr,
+                      std::ptrdiff_t stride )
+            : m_ptr( ptr ),
+              m_size( size ),
+              m_stride( stride ) {}
+
+        /**
+         * Constructs a vector over a span
+         */
+        Vector_Proxy( std::span<ElementT> buffer )
+            : m_ptr( buffer.data() ),
+              m_size( buffer.size() ) {}
+
+        /**
+         * Constructs a vector from every stride-th element of a span.
+         * Throws if any element would fall outside the span.
+         */
+        Vector_Proxy( std::span<ElementT> buffer,
+                      size_t              size,
+                      size_t              stride )
+            : m_ptr( buffer.data() ),
+              m_size( size ),
+              m_stride( static_cast<std::ptrdiff_t>( stride ) )
+        {
+            if( size > 0 && ( size - 1 ) * stride >= buffer.size() )
+            {
+                std::stringstream sout;
+                sout << "Vector_Proxy: " << size << " elements with stride " << stride
+                     << " exceeds buffer of " << buffer.size() << " elements.";
+                throw std::runtime_error( sout.str() );
+            }
+        }
+
+        /**
+         * Constructs a vector over a rank-1 strided view, e.g. a std::mdspan with
+         * any strided layout
+         */
+        template <Strided_View<1> ViewT>
+        Vector_Proxy( const ViewT& view )
+            requires ( std::is_convertible_v<decltype( view.data_handle() ),ElementT*> )
+            : m_ptr( view.data_handle() ),
+              m_size( view.extent( 0 ) ),
+              m_stride( static_cast<std::ptrdiff_t>( view.stride( 0 ) ) ) {}
+
+        /**
+         * Copy Constructor.  Shallow.
+         */
+        Vector_Proxy( const Vector_Proxy& ) = default;
+
         /**
          * Standard copy assignment operator.
          */
@@ -306,12 +389,28 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
             return m_size;
         }
 
+        /**
+         * Get the distance, in elements, between consecutive entries
+         */
+        std::ptrdiff_t stride() const
+        {
+            return m_stride;
+        }
+
+        /**
+         * Check if the elements are packed with no gaps
+         */
+        bool is_contiguous() const
+        {
+            return m_stride == 1 || m_size <= 1;
+        }
+
         /**
          * Function Operator
          */
         reference_type operator()( size_t i )
         {
-            return m_ptr[i];
+            return m_ptr[ offset( i ) ];
         }
 
         /**
@@ -319,7 +418,7 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
          */
         const_reference_type operator()( size_t i ) const
         {
-            return m_ptr[i];
+            return m_ptr[ offset( i ) ];
         }
 
         /**
@@ -327,7 +426,7 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
          */
         reference_type operator[]( size_t i )
         {
-            return m_ptr[i];
+            return m_ptr[ offset( i ) ];
         }
 
         /**
@@ -335,15 +434,45 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
          */
         const_reference_type operator[]( size_t i ) const
         {
-            return m_ptr[i];
+            return m_ptr[ offset( i ) ];
+        }
+
+        /**
+         * Get the elements as a span.  Throws unless is_contiguous().
+         */
+        std::span<ElementT> to_span() const
+        {
+            if( !is_contiguous() )
+            {
+                throw std::runtime_error( "Vector_Proxy: Cannot convert a strided proxy to std::span." );
+            }
+            return std::span<ElementT>( m_ptr, m_size );
         }
 
+#if defined( __cpp_lib_mdspan )
+        /**
+         * Get the view as a layout_stride mdspan.  Throws on negative strides,
+         * which mdspan cannot represent.
+         */
+        std::mdspan<ElementT,std::dextents<size_t,1>,std::layout_stride> to_mdspan() const
+        {
+            if( m_stride < 0 )
+            {
+                throw std::runtime_error( "Vector_Proxy: Cannot convert a negative stride to std::mdspan." );
+            }
+            using extents_t = std::dextents<size_t,1>;
+            std::layout_stride::mapping<extents_t> mapping( extents_t( m_size ),
+                                                            std::array<size_t,1>{ static_cast<size_t>( m_stride ) } );
+            return std::mdspan<ElementT,extents_t,std::layout_stride>( m_ptr, mapping );
+        }
+#endif
+
         /**
          * Get the beginning iterator
          */
         iter_t begin()
         {
-            return m_ptr;
+            return iter_t( m_ptr, m_stride );
         }
 
         /**
@@ -351,7 +480,7 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
          */
         const_iter_t begin() const
         {
-            return m_ptr;
+            return const_iter_t( m_ptr, m_stride );
         }
 
         /**
@@ -359,7 +488,7 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
          */
         iter_t end()
         {
-            return m_ptr + size();
+            return iter_t( m_ptr, m_stride, size() );
         }
 
         /**
@@ -367,15 +496,25 @@ class Vector_Proxy<ElementT,0> : public Vector_Base<Vector_Proxy<ElementT>>
          */
         const_iter_t end() const
         {
-            return m_ptr + size();
+            return const_iter_t( m_ptr, m_stride, size() );
         }
 
     private:
 
+        /**
+         * Offset of an element from the data pointer
+         */
+        std::ptrdiff_t offset( size_t i ) const
+        {
+            return static_cast<std::ptrdiff_t>( i ) * m_stride;
+        }
+
         ElementT* m_ptr { nullptr };
         
         size_t m_size { 0 };
 
+        std::ptrdiff_t m_stride { 1 };
+
 }; // End of Vector_Proxy<>
 
 /**
@@ -386,7 +525,39 @@ Vector_Proxy<DataT>
     vector_proxy( DataT* data,
                   size_t size )
 {
-    return Vector_Proxy<DataT>( data, size );
+    return Vector_Proxy<DataT>( size, data );
+}
+
+/**
+ * Shallow proxy view of every stride-th element of a block of memory as a vector.
+ */
+template <typename DataT>
+Vector_Proxy<DataT>
+    vector_proxy( DataT*         data,
+                  size_t         size,
+                  std::ptrdiff_t stride )
+{
+    return Vector_Proxy<DataT>( size, data, stride );
+}
+
+/**
+ * Shallow proxy view of a span as a vector.
+ */
+template <typename DataT>
+Vector_Proxy<DataT>
+    vector_proxy( std::span<DataT> buffer )
+{
+    return Vector_Proxy<DataT>( buffer );
+}
+
+/**
+ * Shallow proxy view of a rank-1 strided view, such as a std::mdspan, as a vector.
+ */
+template <Strided_View<1> ViewT>
+Vector_Proxy<Strided_View_Element<ViewT>>
+    vector_proxy( const ViewT& view )
+{
+    return Vector_Proxy<Strided_View_Element<ViewT>>( view );
 }
 
 } // End of tmns::math namespace
\ No newline at end of file
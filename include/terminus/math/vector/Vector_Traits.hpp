@@ -20,6 +20,16 @@ struct Vector_Size
     const static std::size_t value = 0;
 };
 
+/**
+ * Number of elements a dynamically-sized VectorN<ValueT> stores inline before
+ * spilling to the heap.  Specialize this to tune the footprint for a given type.
+ */
+template <typename ValueT>
+struct Vector_Inline_Capacity
+{
+    const static std::size_t value = 16;
+};
+
 /**
  * A wrapper template class for vectors and vector expressions.
  * Provides a mechanism for disabling the use of temporary objects
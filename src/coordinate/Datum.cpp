@@ -86,6 +86,21 @@ Datum::Datum( std::string_view name,
     m_impl->m_meridian_offset = meridian_offset;
 }
 
+/********************************/
+/*      Move Constructor        */
+/********************************/
+Datum::Datum( Datum&& rhs ) noexcept = default;
+
+/********************************/
+/*      Move Assignment         */
+/********************************/
+Datum& Datum::operator = ( Datum&& rhs ) noexcept = default;
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Datum::~Datum() = default;
+
 /************************************/
 /*          Get Datum Name          */
 /************************************/
@@ -164,6 +179,80 @@ double Datum::radius( [[maybe_unused]] double lat_deg,
     return std::sqrt( x * x + y * y );
 }
 
+/********************************/
+/*          Get Ellipsoid       */
+/********************************/
+Ellipsoid Datum::ellipsoid() const
+{
+    return Ellipsoid( m_impl->m_semi_major_axis,
+                      m_impl->m_semi_minor_axis,
+                      m_impl->m_meridian_offset );
+}
+
+/************************************************/
+/*          Convert Geodetic to Cartesian       */
+/************************************************/
+math::Vector3d Datum::geodetic_to_cartesian( const math::Vector3d& llh ) const
+{
+    return coordinate::geodetic_to_cartesian( ellipsoid(), llh );
+}
+
+/************************************************************/
+/*          Convert Geodetic to Cartesian (Points)          */
+/************************************************************/
+void Datum::geodetic_to_cartesian( std::span<const math::Vector3d> llh,
+                                   std::span<math::Vector3d>       xyz,
+                                   math::parallel::Thread_Pool&    pool ) const
+{
+    coordinate::geodetic_to_cartesian( ellipsoid(), llh, xyz, pool );
+}
+
+/************************************************************/
+/*          Convert Geodetic to Cartesian (Arrays)          */
+/************************************************************/
+void Datum::geodetic_to_cartesian( std::span<const double>      lon,
+                                   std::span<const double>      lat,
+                                   std::span<const double>      height,
+                                   std::span<double>            x,
+                                   std::span<double>            y,
+                                   std::span<double>            z,
+                                   math::parallel::Thread_Pool& pool ) const
+{
+    coordinate::geodetic_to_cartesian( ellipsoid(), lon, lat, height, x, y, z, pool );
+}
+
+/************************************************/
+/*          Convert Cartesian to Geodetic       */
+/************************************************/
+math::Vector3d Datum::cartesian_to_geodetic( const math::Vector3d& xyz ) const
+{
+    return coordinate::cartesian_to_geodetic( ellipsoid(), xyz );
+}
+
+/************************************************************/
+/*          Convert Cartesian to Geodetic (Points)          */
+/************************************************************/
+void Datum::cartesian_to_geodetic( std::span<const math::Vector3d> xyz,
+                                   std::span<math::Vector3d>       llh,
+                                   math::parallel::Thread_Pool&    pool ) const
+{
+    coordinate::cartesian_to_geodetic( ellipsoid(), xyz, llh, pool );
+}
+
+/************************************************************/
+/*          Convert Cartesian to Geodetic (Arrays)          */
+/************************************************************/
+void Datum::cartesian_to_geodetic( std::span<const double>      x,
+                                   std::span<const double>      y,
+                                   std::span<const double>      z,
+                                   std::span<double>            lon,
+                                   std::span<double>            lat,
+                                   std::span<double>            height,
+                                   math::parallel::Thread_Pool& pool ) const
+{
+    coordinate::cartesian_to_geodetic( ellipsoid(), x, y, z, lon, lat, height, pool );
+}
+
 /************************************/
 /*      From Well-Known Name        */
 /************************************/
@@ -89,7 +89,7 @@ Quaternion Quaternion::operator * ( const Quaternion& rhs ) const
     Quaternion output;
     output.m_real = real() * rhs.real() - VectorT::dot( imag(), rhs.imag() );
     output.m_imag = real()     * rhs.imag() 
-                  + rhs.real() * rhs.imag() 
+                  + rhs.real() * imag() 
                   + VectorT::cross( imag(), rhs.imag() );
     return output;
 }
@@ -101,11 +101,11 @@ Quaternion Quaternion::operator / ( const Quaternion& rhs ) const
 {
     // Reference:  https://www.boost.org/doc/libs/1_83_0/boost/math/quaternion.hpp
     //      Operator /=
-    auto denom = magnitude();
+    auto denom = rhs.magnitude_sq();
 
     auto real = ( m_real * rhs.m_real + Vector3d::dot( m_imag, rhs.m_imag ) ) / denom;
     Vector3d imag;
-    imag.x() = ( -m_real * rhs.m_imag.x() ) + ( m_imag.x() * rhs.m_real     ) + ( m_imag.y() * rhs.m_imag.z() ) + ( m_imag.z() * rhs.m_imag.y() );
+    imag.x() = ( -m_real * rhs.m_imag.x() ) + ( m_imag.x() * rhs.m_real     ) - ( m_imag.y() * rhs.m_imag.z() ) + ( m_imag.z() * rhs.m_imag.y() );
     imag.y() = ( -m_real * rhs.m_imag.y() ) + ( m_imag.x() * rhs.m_imag.z() ) + ( m_imag.y() * rhs.m_real     ) - ( m_imag.z() * rhs.m_imag.x() );
     imag.z() = ( -m_real * rhs.m_imag.z() ) - ( m_imag.x() * rhs.m_imag.y() ) + ( m_imag.y() * rhs.m_imag.x() ) + ( m_imag.z() * rhs.m_real     );
     
@@ -137,6 +137,22 @@ Quaternion Quaternion::normalize() const
     return Quaternion( m_real / mag, m_imag / mag );
 }
 
+/****************************************/
+/*      Convert to Rotation Matrix      */
+/****************************************/
+Matrix<Quaternion::ElementT,3,3> Quaternion::to_matrix() const
+{
+    auto q = normalize();
+    ElementT w = q.m_real;
+    ElementT x = q.m_imag[0];
+    ElementT y = q.m_imag[1];
+    ElementT z = q.m_imag[2];
+
+    return Matrix<ElementT,3,3>( { 1 - 2 * ( y * y + z * z ),     2 * ( x * y - w * z ),     2 * ( x * z + w * y ),
+                                       2 * ( x * y + w * z ), 1 - 2 * ( x * x + z * z ),     2 * ( y * z - w * x ),
+                                       2 * ( x * z - w * y ),     2 * ( y * z + w * x ), 1 - 2 * ( x * x + y * y ) } );
+}
+
 /****************************************/
 /*          Quaternion Conjugate        */
 /****************************************/
@@ -150,7 +166,8 @@ Quaternion Quaternion::conj() const
 /****************************************/
 Quaternion Quaternion::inverse() const
 {
-    return conj() / normalize();
+    auto mag_sq = magnitude_sq();
+    return Quaternion( m_real / mag_sq, m_imag * ( -1 / mag_sq ) );
 }
 
 } // end of tmns::math API
\ No newline at end of file
@@ -127,4 +127,47 @@ Quaternion slerp_n( std::vector<double>     w,
     return slerp_n( w2, Q2, spin );
 }
 
+/****************************************************/
+/*          SO(3) Exponential Map                   */
+/****************************************************/
+Quaternion quaternion_exp( const Vector3d& omega )
+{
+    const double theta_sq = omega.magnitude_sq();
+
+    // Taylor series of cos( t/2 ) and sin( t/2 ) / t near zero
+    if( theta_sq < 1e-16 )
+    {
+        return Quaternion( 1.0 - theta_sq / 8.0,
+                           omega * ( 0.5 - theta_sq / 48.0 ) );
+    }
+
+    const double theta = std::sqrt( theta_sq );
+    return Quaternion( std::cos( theta / 2.0 ),
+                       omega * ( std::sin( theta / 2.0 ) / theta ) );
+}
+
+/****************************************************/
+/*          SO(3) Logarithm Map                     */
+/****************************************************/
+Vector3d quaternion_log( const Quaternion& q )
+{
+    auto unit = q.normalize();
+
+    // q and -q are the same rotation; take the one with the shorter angle
+    double w = unit.real();
+    Vector3d v = unit.imag();
+    if( w < 0 )
+    {
+        w = -w;
+        v = v * -1;
+    }
+
+    const double v_norm = v.magnitude();
+    if( v_norm < 1e-8 )
+    {
+        return v * ( 2.0 / w );
+    }
+    return v * ( 2.0 * std::atan2( v_norm, w ) / v_norm );
+}
+
 } // End of tmns::math namespace
\ No newline at end of file
@@ -8,6 +8,13 @@
 // Project Libraries
 #include "../../thirdparty/eigen/Eigen_Utilities.hpp"
 
+// C++ Libraries
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
 // Eigen Libraries
 #include <Eigen/SVD>
 
@@ -19,14 +26,47 @@ namespace tmns::math::linalg {
 ImageResult<VectorN<double>> solve_symmetric( const MatrixN<double>& A,
                                               const VectorN<double>& b )
 {
-    // Create Eigen matrix
-    auto eigen_A = eigen::to_eigen<::Eigen::MatrixXd>( A );
-    auto eigen_b = eigen::to_eigen<::Eigen::VectorXd>( b );
+    if( A.rows() != A.cols() || A.rows() != b.size() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "solve_symmetric: matrix is ", A.rows(), "x", A.cols(),
+                              " but vector has ", b.size(), " elements" );
+    }
+
+    MatrixN<double> work = A;
+    VectorN<double> x = b;
+    std::vector<std::ptrdiff_t> pivots( A.rows() );
+    if( !detail::solve_symmetric_in_place( A, work, pivots, x ) )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "solve_symmetric: matrix is singular" );
+    }
+    return outcome::ok<VectorN<double>>( std::move( x ) );
+}
 
-    Eigen::MatrixXd x = eigen_A.value().colPivHouseholderQr().solve( eigen_b.value() );
+/************************************************************/
+/*      Solve the symmetric system for several columns      */
+/************************************************************/
+ImageResult<MatrixN<double>> solve_symmetric( const MatrixN<double>& A,
+                                              const MatrixN<double>& B )
+{
+    if( A.rows() != A.cols() || A.rows() != B.rows() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "solve_symmetric: matrix is ", A.rows(), "x", A.cols(),
+                              " but right-hand side has ", B.rows(), " rows" );
+    }
 
-    return outcome::ok<VectorN<double>>( VectorN<double>( x.data(),
-                                                          x.size() ) );
+    MatrixN<double> work = A;
+    MatrixN<double> X = B;
+    VectorN<double> column( A.rows() );
+    std::vector<std::ptrdiff_t> pivots( A.rows() );
+    if( !detail::solve_symmetric_columns_in_place( A, work, pivots, X, column ) )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "solve_symmetric: matrix is singular" );
+    }
+    return outcome::ok<MatrixN<double>>( std::move( X ) );
 }
 
 /************************************************/
@@ -36,46 +76,116 @@ ImageResult<VectorN<double>> solve( const MatrixN<double>& mat_A,
                                     const VectorN<double>& vec_b,
                                     double                 eps )
 {
-    // Convert to eigen types
-    auto A = eigen::to_eigen<::Eigen::MatrixXd>( mat_A );
-    auto b = eigen::to_eigen<::Eigen::VectorXd>( vec_b );
-
-    // Create the Jacobian SVN Engine
-    Eigen::JacobiSVD<Eigen::Matrix<double,
-                                   Eigen::Dynamic,
-                                   Eigen::Dynamic,
-                                   Eigen::RowMajor> > svd( A.value(),
-                                                           Eigen::ComputeThinU |
-                                                           Eigen::ComputeThinV );
-
-    // Grab the Diagonal
-    Eigen::Matrix<double,
-                  Eigen::Dynamic,
-                  Eigen::Dynamic,
-                  Eigen::RowMajor> s = svd.singularValues().asDiagonal();
-
-    // wipe out the small singular values
-    for( int64_t y = 0; y < s.rows(); y++ )
-    for( int64_t x = 0; x < s.cols(); x++ )
+    SVD_Solve_Info info;
+    return solve( mat_A, vec_b, info, eps );
+}
+
+/************************************************/
+/*      Solve System of Linear Equations        */
+/************************************************/
+ImageResult<VectorN<double>> solve( const MatrixN<double>& mat_A,
+                                    const VectorN<double>& vec_b,
+                                    SVD_Solve_Info&        info,
+                                    double                 eps )
+{
+    // A vector is a single column
+    MatrixN<double> mat_B( vec_b.size(), 1 );
+    std::copy( vec_b.begin(), vec_b.end(), mat_B.begin() );
+
+    auto result = solve( mat_A, mat_B, info, eps );
+    if( result.has_error() )
+    {
+        return result.error();
+    }
+    return outcome::ok<VectorN<double>>( VectorN<double>( result.value().data(),
+                                                          result.value().rows() ) );
+}
+
+/************************************************/
+/*      Solve System of Linear Equations        */
+/************************************************/
+ImageResult<MatrixN<double>> solve( const MatrixN<double>& mat_A,
+                                    const MatrixN<double>& mat_B,
+                                    double                 eps )
+{
+    SVD_Solve_Info info;
+    return solve( mat_A, mat_B, info, eps );
+}
+
+namespace {
+
+/**
+ * X = V S^+ U^T B, keeping singular values above eps.  They are sorted in decreasing
+ * order, so only the leading columns of U and V take part.
+ */
+template <typename SVD_T>
+::Eigen::MatrixXd truncated_solve( const SVD_T&             svd,
+                                   const ::Eigen::MatrixXd& B,
+                                   double                   eps,
+                                   SVD_Solve_Info&          info )
+{
+    const auto& s = svd.singularValues();
+    Eigen::Index rank = 0;
+    while( rank < s.size() && s[rank] > eps )
+    {
+        rank++;
+    }
+
+    info.rank = static_cast<size_t>( rank );
+    if( s.size() == 0 )
+    {
+        info.condition = 0;
+    }
+    else if( s[s.size() - 1] > 0 )
+    {
+        info.condition = s[0] / s[s.size() - 1];
+    }
+    else
     {
-        if( s(y,x) > eps )
-        {
-            s(y,x) = 1/s(y,x);
-        }
-        else
-        {
-            s(y,x) = 0;
-        }
+        info.condition = std::numeric_limits<double>::infinity();
     }
 
-    auto inv = svd.matrixV() * s * svd.matrixU().transpose();
+    ::Eigen::MatrixXd UtB = svd.matrixU().leftCols( rank ).transpose() * B;
+    UtB = s.head( rank ).cwiseInverse().asDiagonal() * UtB;
+    return svd.matrixV().leftCols( rank ) * UtB;
+}
+
+} // End of anonymous namespace
+
+/************************************************/
+/*      Solve System of Linear Equations        */
+/************************************************/
+ImageResult<MatrixN<double>> solve( const MatrixN<double>& mat_A,
+                                    const MatrixN<double>& mat_B,
+                                    SVD_Solve_Info&        info,
+                                    double                 eps )
+{
+    if( mat_A.rows() != mat_B.rows() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "solve: matrix has ", mat_A.rows(), " rows but right-hand side has ",
+                              mat_B.rows() );
+    }
 
-    Eigen::MatrixXd output = inv * b.value();
+    // Convert to eigen types
+    auto A = eigen::to_eigen<::Eigen::MatrixXd>( mat_A );
+    auto B = eigen::to_eigen<::Eigen::MatrixXd>( mat_B );
 
-    VectorN<double> output_tmns( output.data(),
-                                 output.size() );
+    ::Eigen::MatrixXd X;
+    if( std::min( mat_A.rows(), mat_A.cols() ) >= SVD_BDC_MIN_SIZE )
+    {
+        ::Eigen::BDCSVD<::Eigen::MatrixXd> svd( A.value(), ::Eigen::ComputeThinU | ::Eigen::ComputeThinV );
+        X = truncated_solve( svd, B.value(), eps, info );
+    }
+    else
+    {
+        ::Eigen::JacobiSVD<::Eigen::MatrixXd> svd( A.value(), ::Eigen::ComputeThinU | ::Eigen::ComputeThinV );
+        X = truncated_solve( svd, B.value(), eps, info );
+    }
 
-    return outcome::ok<VectorN<double>>( output_tmns );    
+    MatrixN<double> output;
+    eigen::from_eigen( X, output );
+    return outcome::ok<MatrixN<double>>( std::move( output ) );
 }
 
 } // End of tmns::math::linalg namespace
\ No newline at end of file
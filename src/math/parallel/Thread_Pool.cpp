@@ -0,0 +1,109 @@
+/**
+ * @file    Thread_Pool.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <terminus/math/parallel/Thread_Pool.hpp>
+
+namespace tmns::math::parallel {
+
+namespace {
+
+/// @brief Set on threads owned by a Thread_Pool
+thread_local bool g_in_worker { false };
+
+} // End of anonymous namespace
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Thread_Pool::Thread_Pool( size_t num_threads )
+{
+    if( num_threads == 0 )
+    {
+        num_threads = std::max<size_t>( 1, std::thread::hardware_concurrency() );
+    }
+    m_workers.reserve( num_threads );
+    for( size_t i = 0; i < num_threads; i++ )
+    {
+        m_workers.emplace_back( [this](){ worker_loop(); } );
+    }
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Thread_Pool::~Thread_Pool()
+{
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    for( auto& worker : m_workers )
+    {
+        worker.join();
+    }
+}
+
+/************************************/
+/*      Get the number of workers   */
+/************************************/
+size_t Thread_Pool::size() const
+{
+    return m_workers.size();
+}
+
+/****************************************/
+/*      Check if called from a worker   */
+/****************************************/
+bool Thread_Pool::in_worker()
+{
+    return g_in_worker;
+}
+
+/************************************/
+/*      Get the global instance     */
+/************************************/
+Thread_Pool& Thread_Pool::global()
+{
+    static Thread_Pool pool;
+    return pool;
+}
+
+/********************************/
+/*          Queue a task        */
+/********************************/
+void Thread_Pool::enqueue( std::function<void()> task )
+{
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_tasks.push_back( std::move( task ) );
+    }
+    m_condition.notify_one();
+}
+
+/************************************/
+/*          Worker main loop        */
+/************************************/
+void Thread_Pool::worker_loop()
+{
+    g_in_worker = true;
+    while( true )
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_condition.wait( lock, [this](){ return m_stop || !m_tasks.empty(); } );
+            if( m_stop && m_tasks.empty() )
+            {
+                return;
+            }
+            task = std::move( m_tasks.front() );
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+} // End of tmns::math::parallel namespace
@@ -15,20 +15,35 @@
 
 namespace tmns::math::eigen {
 
+/// @brief Eigen view of the row-major storage used by Matrix
+using Row_Major_MatrixXd = ::Eigen::Matrix<double,::Eigen::Dynamic,::Eigen::Dynamic,::Eigen::RowMajor>;
+
 /**
- * Convert Matrix to Eigen Matrix
+ * Convert Matrix to Eigen Matrix.  Matrix is row-major, so the data is mapped as
+ * such before copying into Eigen's column-major layout.
 */
 template <typename OutMatrixT,
           typename MatrixT>
 ImageResult<OutMatrixT> to_eigen( const MatrixT& mat ) requires ( std::is_same_v<::Eigen::MatrixXd,OutMatrixT> )
 {
-    ::Eigen::MatrixXd result = Eigen::Map<Eigen::MatrixXd>( const_cast<double*>( mat.data() ),
-                                                            mat.rows(),
-                                                            mat.cols() );
+    ::Eigen::MatrixXd result = ::Eigen::Map<const Row_Major_MatrixXd>( mat.data(),
+                                                                       mat.rows(),
+                                                                       mat.cols() );
 
     return outcome::ok<::Eigen::MatrixXd>( result );
 }
 
+/**
+ * Copy an Eigen Matrix into a row-major Matrix
+*/
+template <typename MatrixT>
+void from_eigen( const ::Eigen::MatrixXd& mat,
+                 MatrixT&                 output )
+{
+    output.set_size( mat.rows(), mat.cols() );
+    ::Eigen::Map<Row_Major_MatrixXd>( output.data(), mat.rows(), mat.cols() ) = mat;
+}
+
 /**
  * Convert Vector to Eigen Vector
 */
@@ -0,0 +1,276 @@
+/**
+ * @file    TEST_Geodetic_Conversions.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/coordinate/Datum.hpp>
+#include <terminus/coordinate/conversions/Geodetic_Conversions.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace tmc = tmns::coordinate;
+namespace tmx = tmns::math;
+
+/**
+ * WGS84 ellipsoid
+ */
+tmc::Ellipsoid wgs84()
+{
+    return tmc::Ellipsoid( 6378137.0, 6356752.314245179 );
+}
+
+/**
+ * Point i of a batch, spread over the globe and over heights from -10 km to 1,000 km
+ */
+tmx::Vector3d geodetic_sample( size_t i )
+{
+    return tmx::Vector3d( { 180.0 * std::sin( 0.37 * i ),
+                            90.0 * std::sin( 1.91 * i + 0.3 ),
+                            -10000.0 + 505000.0 * ( 1 + std::cos( 0.73 * i ) ) } );
+}
+
+/****************************************************************/
+/*          Closed-form points on the WGS84 ellipsoid           */
+/****************************************************************/
+TEST( Geodetic_Conversions, reference_points )
+{
+    const auto ellipsoid = wgs84();
+    const double a = ellipsoid.a;
+    const double b = ellipsoid.b;
+
+    auto check = [&]( const tmx::Vector3d& llh,
+                      const tmx::Vector3d& expected )
+    {
+        auto xyz = tmc::geodetic_to_cartesian( ellipsoid, llh );
+        for( size_t i = 0; i < 3; i++ )
+        {
+            ASSERT_NEAR( xyz[i], expected[i], 1e-8 );
+        }
+        auto back = tmc::cartesian_to_geodetic( ellipsoid, expected );
+        ASSERT_NEAR( back[1], llh[1], 1e-13 );
+        ASSERT_NEAR( back[2], llh[2], 1e-8 );
+        if( std::fabs( llh[1] ) < 90 )
+        {
+            ASSERT_NEAR( back[0], llh[0], 1e-13 );
+        }
+    };
+
+    check( tmx::Vector3d( {   0,   0,   0 } ), tmx::Vector3d( { a, 0, 0 } ) );
+    check( tmx::Vector3d( {  90,   0, 100 } ), tmx::Vector3d( { 0, a + 100, 0 } ) );
+    check( tmx::Vector3d( { 180,   0,   0 } ), tmx::Vector3d( { -a, 0, 0 } ) );
+    check( tmx::Vector3d( {   0,  90,   0 } ), tmx::Vector3d( { 0, 0, b } ) );
+    check( tmx::Vector3d( {   0, -90, -50 } ), tmx::Vector3d( { 0, 0, -b + 50 } ) );
+
+    // At 45 degrees, N = a / sqrt( 1 - e^2 / 2 )
+    const double N = a / std::sqrt( 1 - ellipsoid.e2 / 2 );
+    const double h = 8848;
+    check( tmx::Vector3d( { -45, 45, h } ),
+           tmx::Vector3d( { ( N + h ) / 2, -( N + h ) / 2, ( N * ( 1 - ellipsoid.e2 ) + h ) * std::sqrt( 0.5 ) } ) );
+}
+
+/****************************************************************/
+/*          Round trips from the poles to high orbit            */
+/****************************************************************/
+TEST( Geodetic_Conversions, round_trip )
+{
+    const auto ellipsoid = wgs84();
+    for( const double height : { -10000.0, 0.0, 8848.0, 1.0e5, 1.0e7 } )
+    {
+        for( double lat = -90; lat <= 90; lat += 0.75 )
+        {
+            for( double lon = -179.5; lon <= 180; lon += 11.5 )
+            {
+                auto xyz = tmc::geodetic_to_cartesian( ellipsoid, tmx::Vector3d( { lon, lat, height } ) );
+                auto llh = tmc::cartesian_to_geodetic( ellipsoid, xyz );
+                ASSERT_NEAR( llh[1], lat, 1e-13 );
+                ASSERT_NEAR( llh[2], height, 1e-8 );
+                if( std::fabs( lat ) < 90 )
+                {
+                    ASSERT_NEAR( llh[0], lon, 1e-12 );
+                }
+            }
+        }
+    }
+}
+
+/****************************************************************/
+/*      Spherical datums, and longitudes off a prime meridian   */
+/****************************************************************/
+TEST( Geodetic_Conversions, sphere_and_meridian )
+{
+    tmc::Ellipsoid moon( 1737400, 1737400, 10 );
+    tmx::Vector3d llh( { 175, 30, 2000 } );
+    auto xyz = tmc::geodetic_to_cartesian( moon, llh );
+
+    // Longitude 175 is 185 east of Greenwich
+    const double r = 1737400 + 2000;
+    ASSERT_NEAR( xyz[0], r * std::cos( M_PI / 6 ) * std::cos( 185 * M_PI / 180 ), 1e-8 );
+    ASSERT_NEAR( xyz[1], r * std::cos( M_PI / 6 ) * std::sin( 185 * M_PI / 180 ), 1e-8 );
+    ASSERT_NEAR( xyz[2], r * 0.5, 1e-8 );
+
+    auto back = tmc::cartesian_to_geodetic( moon, xyz );
+    ASSERT_NEAR( back[0], 175, 1e-12 );
+    ASSERT_NEAR( back[1], 30, 1e-12 );
+    ASSERT_NEAR( back[2], 2000, 1e-8 );
+
+    // The center of the body has a finite answer
+    auto center = tmc::cartesian_to_geodetic( wgs84(), tmx::Vector3d( { 0, 0, 0 } ) );
+    ASSERT_TRUE( std::isfinite( center[1] ) );
+    ASSERT_TRUE( std::isfinite( center[2] ) );
+}
+
+/****************************************************************/
+/*      Batches match the single point conversions exactly      */
+/****************************************************************/
+TEST( Geodetic_Conversions, batch )
+{
+    const auto ellipsoid = wgs84();
+    const size_t count = 10007;
+    tmx::parallel::Thread_Pool pool( 4 );
+
+    std::vector<tmx::Vector3d> llh( count ), xyz( count ), back( count );
+    std::vector<double> lon( count ), lat( count ), height( count );
+    for( size_t i = 0; i < count; i++ )
+    {
+        llh[i]    = geodetic_sample( i );
+        lon[i]    = llh[i][0];
+        lat[i]    = llh[i][1];
+        height[i] = llh[i][2];
+    }
+
+    // Array of structures
+    tmc::geodetic_to_cartesian( ellipsoid, std::span<const tmx::Vector3d>( llh ), std::span<tmx::Vector3d>( xyz ), pool );
+    tmc::cartesian_to_geodetic( ellipsoid, std::span<const tmx::Vector3d>( xyz ), std::span<tmx::Vector3d>( back ), pool );
+    for( size_t i = 0; i < count; i++ )
+    {
+        auto expected_xyz = tmc::geodetic_to_cartesian( ellipsoid, llh[i] );
+        auto expected_llh = tmc::cartesian_to_geodetic( ellipsoid, expected_xyz );
+        for( size_t k = 0; k < 3; k++ )
+        {
+            ASSERT_EQ( xyz[i][k], expected_xyz[k] );
+            ASSERT_EQ( back[i][k], expected_llh[k] );
+        }
+        ASSERT_NEAR( back[i][1], llh[i][1], 1e-13 );
+        ASSERT_NEAR( back[i][2], llh[i][2], 1e-8 );
+    }
+
+    // Structure of arrays, converted in place
+    tmc::geodetic_to_cartesian( ellipsoid, lon, lat, height, lon, lat, height, pool );
+    for( size_t i = 0; i < count; i++ )
+    {
+        ASSERT_EQ( lon[i], xyz[i][0] );
+        ASSERT_EQ( lat[i], xyz[i][1] );
+        ASSERT_EQ( height[i], xyz[i][2] );
+    }
+    tmc::cartesian_to_geodetic( ellipsoid, lon, lat, height, lon, lat, height, pool );
+    for( size_t i = 0; i < count; i++ )
+    {
+        ASSERT_EQ( lon[i], back[i][0] );
+        ASSERT_EQ( lat[i], back[i][1] );
+        ASSERT_EQ( height[i], back[i][2] );
+    }
+
+    // Array of structures, in place
+    tmc::geodetic_to_cartesian( ellipsoid, std::span<const tmx::Vector3d>( llh ), std::span<tmx::Vector3d>( llh ), pool );
+    for( size_t i = 0; i < count; i++ )
+    {
+        ASSERT_EQ( llh[i][0], xyz[i][0] );
+    }
+
+    // Mismatched buffers are rejected
+    height.pop_back();
+    ASSERT_THROW( tmc::cartesian_to_geodetic( ellipsoid, lon, lat, height, lon, lat, height, pool ),
+                  std::runtime_error );
+    ASSERT_THROW( tmc::cartesian_to_geodetic( ellipsoid,
+                                              std::span<const tmx::Vector3d>( xyz ),
+                                              std::span<tmx::Vector3d>( back ).first( 10 ),
+                                              pool ),
+                  std::runtime_error );
+}
+
+/****************************************************************/
+/*      WGS84 datum against PROJ reference coordinates          */
+/****************************************************************/
+TEST( Geodetic_Conversions, datum_wgs84 )
+{
+    auto result = tmc::Datum::from_well_known_name( "WGS84" );
+    ASSERT_FALSE( result.has_error() );
+    const auto& datum = result.value();
+
+    const auto ellipsoid = datum.ellipsoid();
+    ASSERT_EQ( ellipsoid.a, 6378137.0 );
+    ASSERT_NEAR( ellipsoid.b, 6356752.314245179, 1e-6 );
+    ASSERT_NEAR( ellipsoid.e2, 0.00669437999014, 1e-14 );
+    ASSERT_EQ( ellipsoid.meridian_offset, 0 );
+
+    // From PROJ 9.5.1, +proj=longlat +datum=WGS84 to +proj=geocent +datum=WGS84
+    const std::vector<std::pair<tmx::Vector3d,tmx::Vector3d>> references = {
+        { tmx::Vector3d( { -104.9903,  39.7392, 1609.3 } ), tmx::Vector3d( { -1270647.240647, -4745333.396502,  4056789.616853 } ) },
+        { tmx::Vector3d( {    2.2945,  48.8584,  330.0 } ), tmx::Vector3d( {  4201152.758655,   168331.794517,  4780461.560653 } ) },
+        { tmx::Vector3d( {  151.2153, -33.8568,    5.0 } ), tmx::Vector3d( { -4646972.276464,  2553078.919527, -3533269.913086 } ) },
+        { tmx::Vector3d( {  139.6917,  35.6895,   40.0 } ), tmx::Vector3d( { -3954869.063155,  3354957.949068,  3700288.123721 } ) },
+        { tmx::Vector3d( {    0.0,     89.99,    -25.0 } ), tmx::Vector3d( {     1116.935426,        0.0,      6356727.216774 } ) },
+        { tmx::Vector3d( {  179.5,     -0.5,  100000.0 } ), tmx::Vector3d( { -6477645.299821,    56529.554127,   -56159.103830 } ) } };
+
+    // Single points.  The references are printed to the micrometer.
+    std::vector<tmx::Vector3d> llh, xyz;
+    for( const auto& [expected_llh, expected_xyz] : references )
+    {
+        auto point_xyz = datum.geodetic_to_cartesian( expected_llh );
+        auto point_llh = datum.cartesian_to_geodetic( expected_xyz );
+        for( size_t k = 0; k < 3; k++ )
+        {
+            ASSERT_NEAR( point_xyz[k], expected_xyz[k], 2e-6 );
+        }
+        ASSERT_NEAR( point_llh[0], expected_llh[0], 1e-10 );
+        ASSERT_NEAR( point_llh[1], expected_llh[1], 1e-10 );
+        ASSERT_NEAR( point_llh[2], expected_llh[2], 1e-5 );
+        llh.push_back( expected_llh );
+        xyz.push_back( expected_xyz );
+    }
+
+    // Buffers of points match the single point conversions
+    const size_t count = references.size();
+    std::vector<tmx::Vector3d> batch_xyz( count ), batch_llh( count );
+    datum.geodetic_to_cartesian( std::span<const tmx::Vector3d>( llh ), std::span<tmx::Vector3d>( batch_xyz ) );
+    datum.cartesian_to_geodetic( std::span<const tmx::Vector3d>( xyz ), std::span<tmx::Vector3d>( batch_llh ) );
+
+    // And so do separate arrays
+    std::vector<double> lon( count ), lat( count ), height( count ), x( count ), y( count ), z( count );
+    for( size_t i = 0; i < count; i++ )
+    {
+        lon[i] = llh[i][0];  lat[i] = llh[i][1];  height[i] = llh[i][2];
+    }
+    datum.geodetic_to_cartesian( lon, lat, height, x, y, z );
+    for( size_t i = 0; i < count; i++ )
+    {
+        auto point_xyz = datum.geodetic_to_cartesian( llh[i] );
+        auto point_llh = datum.cartesian_to_geodetic( xyz[i] );
+        for( size_t k = 0; k < 3; k++ )
+        {
+            ASSERT_EQ( batch_xyz[i][k], point_xyz[k] );
+            ASSERT_EQ( batch_llh[i][k], point_llh[k] );
+        }
+        ASSERT_EQ( x[i], point_xyz[0] );
+        ASSERT_EQ( y[i], point_xyz[1] );
+        ASSERT_EQ( z[i], point_xyz[2] );
+    }
+    datum.cartesian_to_geodetic( x, y, z, lon, lat, height );
+    for( size_t i = 0; i < count; i++ )
+    {
+        auto point_llh = datum.cartesian_to_geodetic( datum.geodetic_to_cartesian( llh[i] ) );
+        ASSERT_EQ( lon[i], point_llh[0] );
+        ASSERT_EQ( lat[i], point_llh[1] );
+        ASSERT_EQ( height[i], point_llh[2] );
+    }
+
+    // Mismatched buffers are rejected
+    z.pop_back();
+    ASSERT_THROW( datum.cartesian_to_geodetic( x, y, z, lon, lat, height ), std::runtime_error );
+}
@@ -7,6 +7,10 @@
 
 // Terminus Libraries
 #include <terminus/math/Quaternion.hpp>
+#include <terminus/math/Quaternion_Utilities.hpp>
+
+// C++ Libraries
+#include <cmath>
 
 /************************************************/
 /*      Test the Quaternion Constructors        */
@@ -20,3 +24,64 @@ TEST( Quaternion, Constructors )
     ASSERT_NEAR( q1.imag().z(), 0, 0.001 );
 
 }
+
+/************************************************/
+/*      Test Quaternion Multiplication          */
+/************************************************/
+TEST( Quaternion, Multiplication )
+{
+    tmns::math::Quaternion q1( 1, 2, 3, 4 );
+    tmns::math::Quaternion q2( 5, 6, 7, 8 );
+
+    // Hamilton product
+    auto q3 = q1 * q2;
+    ASSERT_NEAR( q3.real(),     -60, 1e-12 );
+    ASSERT_NEAR( q3.imag().x(),  12, 1e-12 );
+    ASSERT_NEAR( q3.imag().y(),  30, 1e-12 );
+    ASSERT_NEAR( q3.imag().z(),  24, 1e-12 );
+
+    // Division undoes multiplication
+    auto q4 = q3 / q2;
+    auto q5 = q1 * q2.inverse() * q2;
+    for( size_t i = 0; i < 4; i++ )
+    {
+        ASSERT_NEAR( q4[i], q1[i], 1e-12 );
+        ASSERT_NEAR( q5[i], q1[i], 1e-12 );
+    }
+
+    // Inverse of a non-unit quaternion
+    auto identity = q1 * q1.inverse();
+    ASSERT_NEAR( identity.real(), 1, 1e-12 );
+    ASSERT_NEAR( identity.imag().magnitude(), 0, 1e-12 );
+}
+
+/************************************************/
+/*      Test the SO(3) Exponential and Log      */
+/************************************************/
+TEST( Quaternion, Exp_Log )
+{
+    // Quarter turn about z
+    auto q = tmns::math::quaternion_exp( tmns::math::Vector3d( { 0, 0, M_PI / 2 } ) );
+    ASSERT_NEAR( q.real(), std::sqrt( 0.5 ), 1e-12 );
+    ASSERT_NEAR( q.imag().z(), std::sqrt( 0.5 ), 1e-12 );
+
+    auto rotated = q.rotate_vector( tmns::math::Vector3d( { 1, 0, 0 } ) );
+    ASSERT_NEAR( rotated[0], 0, 1e-12 );
+    ASSERT_NEAR( rotated[1], 1, 1e-12 );
+    ASSERT_NEAR( rotated[2], 0, 1e-12 );
+
+    // Round trip, including tiny angles and the far hemisphere
+    for( auto omega : { tmns::math::Vector3d( { 0.3, -1.2, 0.7 } ),
+                        tmns::math::Vector3d( { 1e-9, 2e-9, -1e-9 } ),
+                        tmns::math::Vector3d( { 0, 0, 0 } ) } )
+    {
+        auto result = tmns::math::quaternion_log( tmns::math::quaternion_exp( omega ) );
+        for( size_t i = 0; i < 3; i++ )
+        {
+            ASSERT_NEAR( result[i], omega[i], 1e-12 );
+        }
+    }
+    auto negated = tmns::math::quaternion_exp( tmns::math::Vector3d( { 0.3, -1.2, 0.7 } ) );
+    auto result  = tmns::math::quaternion_log( tmns::math::Quaternion( -negated.real(), negated.imag() * -1 ) );
+    ASSERT_NEAR( result[1], -1.2, 1e-12 );
+}
@@ -0,0 +1,192 @@
+/**
+ * @file    TEST_Point_Cloud.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/geometry/Point_Cloud.hpp>
+
+// C++ Libraries
+#include <numbers>
+
+using Cloud3d = tmns::math::geom::Point_Cloud<double,3>;
+
+/**
+ * Build a cloud large enough to span several parallel chunks
+ */
+Cloud3d make_grid_cloud( size_t num_points )
+{
+    Cloud3d cloud;
+    cloud.reserve( num_points );
+    for( size_t i = 0; i < num_points; i++ )
+    {
+        cloud.push_back( tmns::math::ToPoint3<double>( i % 100, ( i / 100 ) % 100, i / 10000.0 ) );
+    }
+    return cloud;
+}
+
+/************************************************/
+/*          Test Storage and Attributes         */
+/************************************************/
+TEST( Point_Cloud, storage_and_attributes )
+{
+    std::vector<tmns::math::Point3d> points { tmns::math::ToPoint3<double>( 1, 2, 3 ),
+                                              tmns::math::ToPoint3<double>( 4, 5, 6 ) };
+    Cloud3d cloud( points );
+    ASSERT_EQ( cloud.size(), 2 );
+    ASSERT_EQ( cloud.dimensions(), 3 );
+    ASSERT_NEAR( cloud.coords( 1 )[0], 2, 0.0001 );
+    ASSERT_NEAR( cloud.coords( 2 )[1], 6, 0.0001 );
+
+    ASSERT_TRUE( cloud.add_attribute( "intensity", 7 ) );
+    ASSERT_FALSE( cloud.add_attribute( "intensity" ) );
+    ASSERT_THROW( cloud.attribute( "class" ), std::runtime_error );
+
+    cloud.push_back( tmns::math::ToPoint3<double>( 7, 8, 9 ) );
+    ASSERT_EQ( cloud.attribute( "intensity" ).size(), 3 );
+    ASSERT_NEAR( cloud.attribute( "intensity" )[0], 7, 0.0001 );
+    ASSERT_NEAR( cloud.attribute( "intensity" )[2], 0, 0.0001 );
+
+    auto round_trip = cloud.to_points();
+    ASSERT_EQ( round_trip.size(), 3 );
+    ASSERT_NEAR( round_trip[2].z(), 9, 0.0001 );
+}
+
+/********************************************/
+/*          Test Affine Transforms          */
+/********************************************/
+TEST( Point_Cloud, transform )
+{
+    auto cloud = make_grid_cloud( 200000 );
+    auto expected = cloud.to_points();
+
+    // 90 degree rotation about Z plus a translation
+    tmns::math::Matrix<double,3,3> R( { 0, -1, 0,
+                                        1,  0, 0,
+                                        0,  0, 1 } );
+    tmns::math::Vector3d t( { 10, 20, 30 } );
+    cloud.transform( R, t );
+    for( size_t i = 0; i < cloud.size(); i += 997 )
+    {
+        auto pt = cloud.point( i );
+        ASSERT_NEAR( pt.x(), 10 - expected[i].y(), 1e-9 );
+        ASSERT_NEAR( pt.y(), 20 + expected[i].x(), 1e-9 );
+        ASSERT_NEAR( pt.z(), 30 + expected[i].z(), 1e-9 );
+    }
+
+    // Undo it with the equivalent homogeneous matrix inverse
+    tmns::math::Matrix<double,4,4> H( {  0, 1, 0, -20,
+                                        -1, 0, 0,  10,
+                                         0, 0, 1, -30,
+                                         0, 0, 0,   1 } );
+    cloud.transform( H );
+    for( size_t i = 0; i < cloud.size(); i += 997 )
+    {
+        auto pt = cloud.point( i );
+        ASSERT_NEAR( pt.x(), expected[i].x(), 1e-9 );
+        ASSERT_NEAR( pt.y(), expected[i].y(), 1e-9 );
+        ASSERT_NEAR( pt.z(), expected[i].z(), 1e-9 );
+    }
+
+    // Quaternion for the same rotation about Z
+    double half = std::numbers::pi / 4.0;
+    tmns::math::Quaternion q( std::cos( half ), 0, 0, std::sin( half ) );
+    cloud.transform( q, t );
+    for( size_t i = 0; i < cloud.size(); i += 997 )
+    {
+        auto pt = cloud.point( i );
+        ASSERT_NEAR( pt.x(), 10 - expected[i].y(), 1e-9 );
+        ASSERT_NEAR( pt.y(), 20 + expected[i].x(), 1e-9 );
+    }
+}
+
+/************************************************/
+/*          Test Bounding Box and Moments       */
+/************************************************/
+TEST( Point_Cloud, reductions )
+{
+    auto cloud = make_grid_cloud( 200000 );
+
+    auto bbox = cloud.bounding_box();
+    ASSERT_NEAR( bbox.min().x(), 0,  0.0001 );
+    ASSERT_NEAR( bbox.min().y(), 0,  0.0001 );
+    ASSERT_NEAR( bbox.min().z(), 0,  0.0001 );
+    ASSERT_NEAR( bbox.width(),   99, 0.0001 );
+    ASSERT_NEAR( bbox.height(),  99, 0.0001 );
+    ASSERT_NEAR( bbox.depth(),   19.9999, 0.0001 );
+
+    // Compare against a plain serial computation
+    auto points = cloud.to_points();
+    tmns::math::Vector3d mean;
+    for( const auto& pt : points )
+    {
+        mean += pt;
+    }
+    mean /= points.size();
+
+    auto center = cloud.centroid();
+    for( size_t d = 0; d < 3; d++ )
+    {
+        ASSERT_NEAR( center[d], mean[d], 1e-9 );
+    }
+
+    tmns::math::Matrix<double,3,3> expected_cov;
+    for( const auto& pt : points )
+    {
+        for( size_t r = 0; r < 3; r++ )
+        for( size_t c = 0; c < 3; c++ )
+        {
+            expected_cov( r, c ) += ( pt[r] - mean[r] ) * ( pt[c] - mean[c] );
+        }
+    }
+    auto cov = cloud.covariance();
+    for( size_t r = 0; r < 3; r++ )
+    for( size_t c = 0; c < 3; c++ )
+    {
+        ASSERT_NEAR( cov( r, c ), expected_cov( r, c ) / points.size(), 1e-6 );
+    }
+
+    // Distances
+    auto reference = tmns::math::ToPoint3<double>( 1, 2, 2 );
+    auto dists = cloud.distances_to( reference );
+    auto mags  = cloud.magnitudes();
+    ASSERT_EQ( dists.size(), cloud.size() );
+    ASSERT_NEAR( dists[0], 3, 0.0001 );
+    for( size_t i = 0; i < cloud.size(); i += 1013 )
+    {
+        ASSERT_NEAR( mags[i], points[i].magnitude(), 1e-9 );
+    }
+}
+
+/****************************************/
+/*          Test Predicate Filter       */
+/****************************************/
+TEST( Point_Cloud, filter )
+{
+    auto cloud = make_grid_cloud( 200000 );
+    cloud.add_attribute( "index" );
+    for( size_t i = 0; i < cloud.size(); i++ )
+    {
+        cloud.attribute( "index" )[i] = i;
+    }
+
+    auto filtered = cloud.filter( []( const tmns::math::Point3d& pt ){ return pt.x() < 10; } );
+    ASSERT_EQ( filtered.size(), 20000 );
+    ASSERT_TRUE( filtered.has_attribute( "index" ) );
+
+    // Order must be preserved across chunk boundaries
+    const auto& index = filtered.attribute( "index" );
+    for( size_t i = 0; i < filtered.size(); i++ )
+    {
+        size_t src = index[i];
+        ASSERT_EQ( src % 100, i % 10 );
+        ASSERT_NEAR( filtered.coords( 0 )[i], cloud.coords( 0 )[src], 1e-12 );
+        ASSERT_NEAR( filtered.coords( 2 )[i], cloud.coords( 2 )[src], 1e-12 );
+    }
+
+    auto none = cloud.filter( []( const auto& ){ return false; } );
+    ASSERT_TRUE( none.empty() );
+    ASSERT_TRUE( none.has_attribute( "index" ) );
+}
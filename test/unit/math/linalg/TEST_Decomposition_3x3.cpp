@@ -0,0 +1,306 @@
+/**
+ * @file    TEST_Decomposition_3x3.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/Decomposition_3x3.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Test matrix i, symmetric if requested.  Some have repeated or zero eigenvalues.
+ */
+template <typename ValueT>
+tmx::Matrix<ValueT,3,3> decomposition_matrix( size_t i,
+                                              bool   symmetric )
+{
+    tmx::Matrix<ValueT,3,3> A;
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            A( r, c ) = std::sin( 0.37 * i + 1.7 * r + 0.9 * c * c ) * ( 1 + i % 5 );
+        }
+    }
+    if( symmetric )
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = 0; c < r; c++ )
+            {
+                A( r, c ) = A( c, r );
+            }
+        }
+    }
+
+    // Degenerate cases
+    if( i % 7 == 3 )
+    {
+        A = tmx::Matrix<ValueT,3,3>();
+        A( 0, 0 ) = 2;  A( 1, 1 ) = 2;  A( 2, 2 ) = symmetric ? 2 : -1;
+    }
+    if( i % 11 == 4 )
+    {
+        // Rank one
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = 0; c < 3; c++ )
+            {
+                A( r, c ) = ValueT( ( r + 1.0 ) * ( c + 1.0 ) );
+            }
+        }
+    }
+    if( i == 13 )
+    {
+        A = tmx::Matrix<ValueT,3,3>();
+    }
+    return A;
+}
+
+/**
+ * Frobenius norm
+ */
+template <typename ValueT>
+double frobenius( const tmx::Matrix<ValueT,3,3>& A )
+{
+    double sum = 0;
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            sum += double( A( r, c ) ) * A( r, c );
+        }
+    }
+    return std::sqrt( sum );
+}
+
+/**
+ * Check Q^T Q == I
+ */
+template <typename ValueT>
+void check_orthonormal( const tmx::Matrix<ValueT,3,3>& Q,
+                        double                         tolerance )
+{
+    for( size_t a = 0; a < 3; a++ )
+    {
+        for( size_t b = 0; b < 3; b++ )
+        {
+            double dot = 0;
+            for( size_t k = 0; k < 3; k++ )
+            {
+                dot += double( Q( k, a ) ) * Q( k, b );
+            }
+            ASSERT_NEAR( dot, a == b ? 1 : 0, tolerance );
+        }
+    }
+}
+
+/**
+ * Check the documented eigen-decomposition bounds
+ */
+template <typename ValueT>
+void check_eigen( const tmx::Matrix<ValueT,3,3>&            A,
+                  const tmx::linalg::Symmetric_Eigen_3x3<ValueT>& eigen )
+{
+    const double u     = std::numeric_limits<ValueT>::epsilon();
+    const double scale = frobenius( A ) + std::numeric_limits<double>::min();
+
+    check_orthonormal( eigen.vectors, 16 * u );
+    ASSERT_LE( eigen.values[0], eigen.values[1] );
+    ASSERT_LE( eigen.values[1], eigen.values[2] );
+
+    // A v = lambda v
+    for( size_t c = 0; c < 3; c++ )
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            double Av = 0;
+            for( size_t k = 0; k < 3; k++ )
+            {
+                Av += double( A( r, k ) ) * eigen.vectors( k, c );
+            }
+            ASSERT_NEAR( Av, double( eigen.values[c] ) * eigen.vectors( r, c ), 16 * u * scale );
+        }
+    }
+
+    // Trace is preserved
+    ASSERT_NEAR( double( eigen.values[0] ) + eigen.values[1] + eigen.values[2],
+                 double( A( 0, 0 ) ) + A( 1, 1 ) + A( 2, 2 ), 16 * u * scale );
+}
+
+/**
+ * Check the documented SVD bounds
+ */
+template <typename ValueT>
+void check_svd( const tmx::Matrix<ValueT,3,3>& A,
+                const tmx::linalg::SVD_3x3<ValueT>& svd )
+{
+    const double u     = std::numeric_limits<ValueT>::epsilon();
+    const double scale = frobenius( A ) + std::numeric_limits<double>::min();
+
+    check_orthonormal( svd.U, 16 * u );
+    check_orthonormal( svd.V, 16 * u );
+    ASSERT_GE( svd.S[0], svd.S[1] );
+    ASSERT_GE( svd.S[1], svd.S[2] );
+    ASSERT_GE( svd.S[2], 0 );
+
+    // A = U S V^T
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            double value = 0;
+            for( size_t k = 0; k < 3; k++ )
+            {
+                value += double( svd.U( r, k ) ) * svd.S[k] * svd.V( c, k );
+            }
+            ASSERT_NEAR( value, A( r, c ), 32 * u * scale );
+        }
+    }
+}
+
+/****************************************************************/
+/*          Symmetric eigen-decomposition, double and float     */
+/****************************************************************/
+TEST( Decomposition_3x3, symmetric_eigen )
+{
+    for( size_t i = 0; i < 40; i++ )
+    {
+        auto A = decomposition_matrix<double>( i, true );
+        check_eigen( A, tmx::linalg::symmetric_eigen_3x3( A ) );
+
+        auto A_f = decomposition_matrix<float>( i, true );
+        check_eigen( A_f, tmx::linalg::symmetric_eigen_3x3( A_f ) );
+    }
+
+    // Known spectrum
+    tmx::Matrix<double,3,3> A;
+    A( 0, 0 ) = 2;  A( 0, 1 ) = 1;  A( 1, 0 ) = 1;  A( 1, 1 ) = 2;  A( 2, 2 ) = 5;
+    auto eigen = tmx::linalg::symmetric_eigen_3x3( A );
+    ASSERT_NEAR( eigen.values[0], 1, 1e-15 );
+    ASSERT_NEAR( eigen.values[1], 3, 1e-15 );
+    ASSERT_NEAR( eigen.values[2], 5, 1e-15 );
+    ASSERT_NEAR( std::fabs( eigen.vectors( 2, 2 ) ), 1, 1e-15 );
+}
+
+/****************************************************************/
+/*          SVD, double and float                               */
+/****************************************************************/
+TEST( Decomposition_3x3, svd )
+{
+    for( size_t i = 0; i < 40; i++ )
+    {
+        auto A = decomposition_matrix<double>( i, false );
+        check_svd( A, tmx::linalg::svd_3x3( A ) );
+
+        auto A_f = decomposition_matrix<float>( i, false );
+        check_svd( A_f, tmx::linalg::svd_3x3( A_f ) );
+    }
+
+    // A rotation has unit singular values
+    tmx::Matrix<double,3,3> R;
+    R( 0, 1 ) = -1;  R( 1, 0 ) = 1;  R( 2, 2 ) = 1;
+    auto svd = tmx::linalg::svd_3x3( R );
+    for( size_t i = 0; i < 3; i++ )
+    {
+        ASSERT_NEAR( svd.S[i], 1, 1e-15 );
+    }
+}
+
+/****************************************************************/
+/*      SVD of nearly singular matrices keeps its accuracy      */
+/****************************************************************/
+TEST( Decomposition_3x3, svd_graded )
+{
+    // Rotations about different axes
+    auto rotation = []( double angle, size_t axis )
+    {
+        tmx::Matrix<double,3,3> R;
+        const size_t i = ( axis + 1 ) % 3;
+        const size_t j = ( axis + 2 ) % 3;
+        R( axis, axis ) = 1;
+        R( i, i ) = std::cos( angle );  R( i, j ) = -std::sin( angle );
+        R( j, i ) = std::sin( angle );  R( j, j ) =  std::cos( angle );
+        return R;
+    };
+    // X Y, or X Y^T
+    auto product = []( const tmx::Matrix<double,3,3>& X,
+                       const tmx::Matrix<double,3,3>& Y,
+                       bool                           transposed )
+    {
+        tmx::Matrix<double,3,3> Z;
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = 0; c < 3; c++ )
+            {
+                for( size_t k = 0; k < 3; k++ )
+                {
+                    Z( r, c ) += X( r, k ) * ( transposed ? Y( c, k ) : Y( k, c ) );
+                }
+            }
+        }
+        return Z;
+    };
+    const auto P = product( product( rotation( 0.7, 0 ), rotation( -1.1, 1 ), false ), rotation( 0.4, 2 ), false );
+    const auto Q = product( product( rotation( 2.3, 2 ), rotation( 0.5, 0 ), false ), rotation( -0.8, 1 ), false );
+
+    // Graded spectrum, and the near-planar cross-covariance of a Kabsch alignment
+    const double spectra[2][3] = { { 1, 1e-8, 5e-9 },
+                                   { 1, 1e-6, 0 } };
+    for( const auto& sigma : spectra )
+    {
+        tmx::Matrix<double,3,3> D;
+        D( 0, 0 ) = sigma[0];  D( 1, 1 ) = sigma[1];  D( 2, 2 ) = sigma[2];
+        const auto A = product( product( P, D, false ), Q, true );
+
+        const auto svd = tmx::linalg::svd_3x3( A );
+        check_svd( A, svd );
+        const double u = std::numeric_limits<double>::epsilon();
+        for( size_t i = 0; i < 3; i++ )
+        {
+            ASSERT_NEAR( svd.S[i], sigma[i], 16 * u * frobenius( A ) );
+        }
+    }
+}
+
+/****************************************************************/
+/*          Batches match the single-matrix kernels             */
+/****************************************************************/
+TEST( Decomposition_3x3, batch )
+{
+    const size_t count = 45;
+    std::vector<tmx::Matrix<double,3,3>> symmetric( count ), general( count );
+    for( size_t i = 0; i < count; i++ )
+    {
+        symmetric[i] = decomposition_matrix<double>( i, true );
+        general[i]   = decomposition_matrix<double>( i, false );
+    }
+
+    tmx::parallel::Thread_Pool pool( 4 );
+    std::vector<tmx::Vector_<double,3>>  values( count ), S( count );
+    std::vector<tmx::Matrix<double,3,3>> vectors( count ), U( count ), V( count );
+    tmx::linalg::symmetric_eigen_3x3_batch<double>( symmetric, values, vectors, pool );
+    tmx::linalg::svd_3x3_batch<double>( general, U, S, V, pool );
+
+    for( size_t i = 0; i < count; i++ )
+    {
+        auto eigen = tmx::linalg::symmetric_eigen_3x3( symmetric[i] );
+        check_eigen( symmetric[i], tmx::linalg::Symmetric_Eigen_3x3<double>{ values[i], vectors[i] } );
+        check_svd( general[i], tmx::linalg::SVD_3x3<double>{ U[i], S[i], V[i] } );
+        for( size_t r = 0; r < 3; r++ )
+        {
+            ASSERT_NEAR( values[i][r], eigen.values[r], 1e-12 * ( 1 + frobenius( symmetric[i] ) ) );
+        }
+    }
+
+    values.pop_back();
+    ASSERT_THROW( tmx::linalg::symmetric_eigen_3x3_batch<double>( symmetric, values, vectors ), std::runtime_error );
+}
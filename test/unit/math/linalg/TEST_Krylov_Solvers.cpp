@@ -0,0 +1,378 @@
+/**
+ * @file    TEST_Krylov_Solvers.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/Krylov_Solvers.hpp>
+#include <terminus/math/optimization/Jacobian_Sparsity.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * 5-point Laplacian on a k by k grid, with the rows and columns scaled by scale(i)
+ * and shift * I subtracted
+ */
+tmx::MatrixN<double> krylov_laplacian( size_t k,
+                                       double shift      = 0,
+                                       double convection = 0,
+                                       bool   scaled     = false )
+{
+    const size_t n = k * k;
+    tmx::MatrixN<double> A( n, n );
+    for( size_t i = 0; i < k; i++ )
+    {
+        for( size_t j = 0; j < k; j++ )
+        {
+            const size_t p = i * k + j;
+            A( p, p ) = 4 - shift;
+            if( i > 0 )     { A( p, p - k ) = -1 - convection; }
+            if( i + 1 < k ) { A( p, p + k ) = -1 + convection; }
+            if( j > 0 )     { A( p, p - 1 ) = -1 - convection; }
+            if( j + 1 < k ) { A( p, p + 1 ) = -1 + convection; }
+        }
+    }
+    if( scaled )
+    {
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t c = 0; c < n; c++ )
+            {
+                A( r, c ) *= ( 1 + 0.9 * std::sin( 1.0 * r ) ) * ( 1 + 0.9 * std::sin( 1.0 * c ) );
+            }
+        }
+    }
+    return A;
+}
+
+/**
+ * Right-hand side for an n by n system
+ */
+tmx::VectorN<double> krylov_rhs( size_t n )
+{
+    tmx::VectorN<double> b( n );
+    for( size_t i = 0; i < n; i++ )
+    {
+        b[i] = std::cos( 0.3 * i ) + 0.5;
+    }
+    return b;
+}
+
+/**
+ * Check | b - A x | <= tolerance * | b |
+ */
+void check_solution( const tmx::MatrixN<double>& A,
+                     const tmx::VectorN<double>& b,
+                     const tmx::VectorN<double>& x,
+                     double                      tolerance )
+{
+    ASSERT_EQ( x.size(), b.size() );
+    double residual = 0;
+    double b_norm   = 0;
+    for( size_t r = 0; r < A.rows(); r++ )
+    {
+        double value = b[r];
+        for( size_t c = 0; c < A.cols(); c++ )
+        {
+            value -= A( r, c ) * x[c];
+        }
+        residual += value * value;
+        b_norm   += b[r] * b[r];
+    }
+    ASSERT_LE( std::sqrt( residual ), tolerance * std::sqrt( b_norm ) );
+}
+
+/****************************************************************/
+/*      Conjugate gradients, with and without preconditioning   */
+/****************************************************************/
+TEST( Krylov_Solvers, conjugate_gradient )
+{
+    auto A = krylov_laplacian( 12, 0, 0, true );
+    auto b = krylov_rhs( A.rows() );
+
+    tmx::linalg::Krylov_Options options;
+    options.tolerance = 1e-10;
+
+    tmx::VectorN<double> x;
+    auto plain = tmx::linalg::conjugate_gradient( A, b, x, options );
+    ASSERT_TRUE( plain.converged() );
+    ASSERT_LE( plain.residual_norm, 1e-9 );
+    check_solution( A, b, x, 1e-9 );
+
+    tmx::VectorN<double> x_jacobi;
+    auto jacobi = tmx::linalg::conjugate_gradient( A, b, x_jacobi, options,
+                                                   tmx::linalg::Jacobi_Preconditioner( A ) );
+    ASSERT_TRUE( jacobi.converged() );
+    check_solution( A, b, x_jacobi, 1e-9 );
+    ASSERT_LT( jacobi.iterations, plain.iterations );
+
+    tmx::linalg::Incomplete_Cholesky_Preconditioner ic( A );
+    ASSERT_EQ( ic.shift(), 0 );
+    tmx::VectorN<double> x_ic;
+    auto incomplete = tmx::linalg::conjugate_gradient( A, b, x_ic, options, ic );
+    ASSERT_TRUE( incomplete.converged() );
+    check_solution( A, b, x_ic, 1e-9 );
+    ASSERT_LT( incomplete.iterations, jacobi.iterations );
+
+    // A converged guess takes no iterations
+    auto again = tmx::linalg::conjugate_gradient( A, b, x_ic, options, ic );
+    ASSERT_TRUE( again.converged() );
+    ASSERT_EQ( again.iterations, 0 );
+}
+
+/****************************************************************/
+/*      Incomplete Cholesky of a tridiagonal matrix is exact    */
+/****************************************************************/
+TEST( Krylov_Solvers, incomplete_cholesky_exact )
+{
+    const size_t n = 40;
+    tmx::MatrixN<double> A( n, n );
+    for( size_t i = 0; i < n; i++ )
+    {
+        A( i, i ) = 2.5 + std::sin( 1.0 * i );
+        if( i > 0 )
+        {
+            A( i, i - 1 ) = A( i - 1, i ) = -1;
+        }
+    }
+    tmx::linalg::Incomplete_Cholesky_Preconditioner ic( A );
+    ASSERT_EQ( ic.non_zeros(), 2 * n - 1 );
+
+    auto b = krylov_rhs( n );
+    tmx::VectorN<double> x;
+    auto summary = tmx::linalg::conjugate_gradient( A, b, x, tmx::linalg::Krylov_Options(), ic );
+    ASSERT_TRUE( summary.converged() );
+    ASSERT_EQ( summary.iterations, 1 );
+    check_solution( A, b, x, 1e-12 );
+
+    // Not square
+    ASSERT_THROW( tmx::linalg::Incomplete_Cholesky_Preconditioner( tmx::MatrixN<double>( 3, 4 ) ),
+                  std::runtime_error );
+}
+
+/****************************************************************/
+/*  Incomplete Cholesky from sparse rows matches the dense one  */
+/****************************************************************/
+TEST( Krylov_Solvers, incomplete_cholesky_sparse )
+{
+    // Full matrix in compressed rows; the upper triangle is ignored
+    auto A = krylov_laplacian( 8, 0, 0, true );
+    std::vector<size_t> offsets( 1, 0 );
+    std::vector<size_t> columns;
+    std::vector<double> values;
+    for( size_t r = 0; r < A.rows(); r++ )
+    {
+        for( size_t c = 0; c < A.cols(); c++ )
+        {
+            if( A( r, c ) != 0 )
+            {
+                columns.push_back( c );
+                values.push_back( A( r, c ) );
+            }
+        }
+        offsets.push_back( columns.size() );
+    }
+
+    tmx::linalg::Incomplete_Cholesky_Preconditioner dense( A );
+    tmx::linalg::Incomplete_Cholesky_Preconditioner sparse( offsets, columns, values );
+    ASSERT_EQ( sparse.rows(), dense.rows() );
+    ASSERT_EQ( sparse.non_zeros(), dense.non_zeros() );
+    ASSERT_EQ( sparse.shift(), dense.shift() );
+
+    auto b = krylov_rhs( A.rows() );
+    tmx::VectorN<double> z_dense( b.size() );
+    tmx::VectorN<double> z_sparse( b.size() );
+    dense.apply( b, z_dense );
+    sparse.apply( b, z_sparse );
+    for( size_t i = 0; i < b.size(); i++ )
+    {
+        ASSERT_EQ( z_sparse[i], z_dense[i] );
+    }
+
+    // Inconsistent arrays, unsorted columns and a missing diagonal
+    ASSERT_THROW( tmx::linalg::Incomplete_Cholesky_Preconditioner( offsets, columns,
+                                                                   std::span<const double>( values ).first( 3 ) ),
+                  std::runtime_error );
+    std::swap( columns[0], columns[1] );
+    ASSERT_THROW( tmx::linalg::Incomplete_Cholesky_Preconditioner( offsets, columns, values ),
+                  std::runtime_error );
+    std::vector<size_t> no_diagonal_offsets( { 0, 1, 2 } );
+    std::vector<size_t> no_diagonal_columns( { 0, 0 } );
+    std::vector<double> no_diagonal_values( { 1, 1 } );
+    ASSERT_THROW( tmx::linalg::Incomplete_Cholesky_Preconditioner( no_diagonal_offsets,
+                                                                   no_diagonal_columns,
+                                                                   no_diagonal_values ),
+                  std::runtime_error );
+}
+
+/****************************************************************/
+/*      Incomplete Cholesky rejects what it cannot factor       */
+/****************************************************************/
+TEST( Krylov_Solvers, incomplete_cholesky_failures )
+{
+    // Non-finite entries
+    auto A = krylov_laplacian( 4 );
+    A( 5, 1 ) = std::numeric_limits<double>::quiet_NaN();
+    ASSERT_THROW( tmx::linalg::Incomplete_Cholesky_Preconditioner{ A }, std::runtime_error );
+    A( 5, 1 ) = -1;
+    A( 5, 5 ) = std::numeric_limits<double>::infinity();
+    ASSERT_THROW( tmx::linalg::Incomplete_Cholesky_Preconditioner{ A }, std::runtime_error );
+
+    // So far from diagonally dominant that no allowed shift helps
+    tmx::MatrixN<double> B( 2, 2 );
+    B( 0, 0 ) = B( 1, 1 ) = 1;
+    B( 0, 1 ) = B( 1, 0 ) = 1e20;
+    ASSERT_THROW( tmx::linalg::Incomplete_Cholesky_Preconditioner{ B }, std::runtime_error );
+}
+
+/****************************************************************/
+/*          MINRES on definite and indefinite systems           */
+/****************************************************************/
+TEST( Krylov_Solvers, minres )
+{
+    tmx::linalg::Krylov_Options options;
+    options.tolerance = 1e-10;
+
+    auto A = krylov_laplacian( 12 );
+    auto b = krylov_rhs( A.rows() );
+    tmx::VectorN<double> x;
+    auto definite = tmx::linalg::minres( A, b, x, options );
+    ASSERT_TRUE( definite.converged() );
+    check_solution( A, b, x, 1e-9 );
+
+    // Eigenvalues on both sides of zero, where CG is not applicable
+    auto indefinite = krylov_laplacian( 12, 2.0 );
+    tmx::VectorN<double> y;
+    auto summary = tmx::linalg::minres( indefinite, b, y, options );
+    ASSERT_TRUE( summary.converged() );
+    check_solution( indefinite, b, y, 1e-9 );
+
+    tmx::VectorN<double> z;
+    auto jacobi = tmx::linalg::minres( indefinite, b, z, options,
+                                       tmx::linalg::Jacobi_Preconditioner( indefinite ) );
+    ASSERT_TRUE( jacobi.converged() );
+    check_solution( indefinite, b, z, 1e-8 );
+}
+
+/****************************************************************/
+/*      BiCGSTAB and GMRES on a convection-diffusion system     */
+/****************************************************************/
+TEST( Krylov_Solvers, nonsymmetric )
+{
+    auto A = krylov_laplacian( 12, 0, 0.4 );
+    auto b = krylov_rhs( A.rows() );
+
+    tmx::linalg::Krylov_Options options;
+    options.tolerance = 1e-10;
+
+    tmx::VectorN<double> x;
+    auto bicgstab = tmx::linalg::bicgstab( A, b, x, options );
+    ASSERT_TRUE( bicgstab.converged() );
+    check_solution( A, b, x, 1e-9 );
+
+    tmx::VectorN<double> y;
+    auto jacobi = tmx::linalg::bicgstab( A, b, y, options, tmx::linalg::Jacobi_Preconditioner( A ) );
+    ASSERT_TRUE( jacobi.converged() );
+    check_solution( A, b, y, 1e-9 );
+
+    // Full GMRES, then restarted
+    options.restart = A.rows();
+    tmx::VectorN<double> z;
+    auto full = tmx::linalg::gmres( A, b, z, options );
+    ASSERT_TRUE( full.converged() );
+    check_solution( A, b, z, 1e-9 );
+
+    options.restart = 10;
+    tmx::VectorN<double> w;
+    auto restarted = tmx::linalg::gmres( A, b, w, options, tmx::linalg::Jacobi_Preconditioner( A ) );
+    ASSERT_TRUE( restarted.converged() );
+    check_solution( A, b, w, 1e-9 );
+    ASSERT_GE( restarted.iterations, full.iterations );
+
+    // Running out of iterations is reported
+    options.max_iterations = 3;
+    tmx::VectorN<double> v;
+    auto limited = tmx::linalg::gmres( A, b, v, options );
+    ASSERT_EQ( limited.status, tmx::linalg::Krylov_Status::MAX_ITERATIONS );
+    ASSERT_EQ( limited.iterations, 3 );
+    ASSERT_GT( limited.residual_norm, 1e-10 );
+}
+
+/****************************************************************/
+/*      Matrix-free and sparse operators give the same answer   */
+/****************************************************************/
+TEST( Krylov_Solvers, operators )
+{
+    const size_t n = 100;
+    auto b = krylov_rhs( n );
+
+    // 1D Laplacian applied without storing it
+    auto laplacian = tmx::linalg::make_linear_operator( n, n, [n]( const tmx::VectorN<double>& x,
+                                                                    tmx::VectorN<double>&       y )
+    {
+        for( size_t i = 0; i < n; i++ )
+        {
+            y[i] = 2.5 * x[i] - ( i > 0 ? x[i - 1] : 0 ) - ( i + 1 < n ? x[i + 1] : 0 );
+        }
+    } );
+    static_assert( tmx::linalg::Linear_Operator<decltype( laplacian )> );
+
+    tmx::VectorN<double> x_free;
+    ASSERT_TRUE( tmx::linalg::conjugate_gradient( laplacian, b, x_free ).converged() );
+
+    // The same matrix as a sparse Jacobian
+    std::vector<std::pair<size_t,size_t>> entries;
+    for( size_t i = 0; i < n; i++ )
+    {
+        for( size_t j = ( i > 0 ? i - 1 : 0 ); j <= std::min( i + 1, n - 1 ); j++ )
+        {
+            entries.emplace_back( i, j );
+        }
+    }
+    tmx::optimize::Jacobian_Sparsity pattern( n, n, entries );
+    tmx::optimize::Sparse_Jacobian sparse( pattern );
+    for( size_t c = 0; c < n; c++ )
+    {
+        auto rows = pattern.column( c );
+        for( size_t k = 0; k < rows.size(); k++ )
+        {
+            sparse.values()[pattern.column_offset( c ) + k] = rows[k] == c ? 2.5 : -1;
+        }
+    }
+    static_assert( tmx::linalg::Linear_Operator<tmx::optimize::Sparse_Jacobian> );
+
+    auto dense = sparse.to_dense();
+    tmx::VectorN<double> x_sparse, x_gmres;
+    ASSERT_TRUE( tmx::linalg::minres( sparse, b, x_sparse ).converged() );
+    ASSERT_TRUE( tmx::linalg::gmres( sparse, b, x_gmres ).converged() );
+    check_solution( dense, b, x_free, 1e-9 );
+    check_solution( dense, b, x_sparse, 1e-9 );
+    check_solution( dense, b, x_gmres, 1e-9 );
+
+    // Transposed products match the dense transpose
+    tmx::VectorN<double> Jt_b( n );
+    sparse.apply_transpose( b, Jt_b );
+    for( size_t c = 0; c < n; c++ )
+    {
+        double value = 0;
+        for( size_t r = 0; r < n; r++ )
+        {
+            value += dense( r, c ) * b[r];
+        }
+        ASSERT_NEAR( Jt_b[c], value, 1e-14 );
+    }
+
+    // Operators which do not match the right-hand side are rejected
+    tmx::VectorN<double> x;
+    ASSERT_THROW( tmx::linalg::bicgstab( laplacian, krylov_rhs( n + 1 ), x ), std::runtime_error );
+    ASSERT_THROW( tmx::linalg::gmres( tmx::MatrixN<double>( n, n + 1 ), b, x ), std::runtime_error );
+}
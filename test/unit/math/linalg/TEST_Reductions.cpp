@@ -0,0 +1,169 @@
+/**
+ * @file    TEST_Reductions.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/Reductions.hpp>
+#include <terminus/math/matrix/Matrix_Transpose.hpp>
+#include <terminus/math/vector/Vector_Utilities.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+using tmns::math::linalg::Summation_Mode;
+
+/****************************************/
+/*          Test Vector Reductions      */
+/****************************************/
+TEST( Reductions, vector_reductions )
+{
+    tmns::math::Vector_<double,5> v1( { 3, -7, 1, 4, -2 } );
+    ASSERT_NEAR( tmns::math::linalg::sum( v1 ), -1, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_1( v1 ), 17, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_2( v1 ), std::sqrt( 79.0 ), 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_inf( v1 ), 7, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::min( v1 ), -7, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::max( v1 ), 4, 1e-12 );
+
+    // Expressions and dynamic vectors
+    tmns::math::VectorN<double> v2( { 1, 1, 1, 1, 1 } );
+    ASSERT_NEAR( tmns::math::linalg::sum( v1 + v2 ), 4, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::dot( v1, v2 ), -1, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::max( v1 * 2.0 ), 8, 1e-12 );
+
+    // Integer sums use the accumulator type
+    tmns::math::VectorN<uint8_t> bytes( 1000 );
+    for( size_t i = 0; i < bytes.size(); i++ )
+    {
+        bytes[i] = 255;
+    }
+    ASSERT_EQ( tmns::math::linalg::sum( bytes ), 255000 );
+
+    // Errors
+    tmns::math::VectorN<double> empty;
+    ASSERT_NEAR( tmns::math::linalg::sum( empty ), 0, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_inf( empty ), 0, 1e-12 );
+    ASSERT_THROW( tmns::math::linalg::min( empty ), std::runtime_error );
+    ASSERT_THROW( tmns::math::linalg::dot( v1, empty ), std::runtime_error );
+}
+
+/****************************************/
+/*          Test Matrix Reductions      */
+/****************************************/
+TEST( Reductions, matrix_reductions )
+{
+    tmns::math::Matrix<double,2,3> m1( { 1, -2,  3,
+                                        -4,  5, -6 } );
+    ASSERT_NEAR( tmns::math::linalg::sum( m1 ), -3, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::min( m1 ), -6, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::max( m1 ),  5, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_1( m1 ), 9, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_inf( m1 ), 15, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_frobenius( m1 ), std::sqrt( 91.0 ), 1e-12 );
+
+    // Transposed expression swaps the induced norms
+    ASSERT_NEAR( tmns::math::linalg::norm_1( tmns::math::transpose( m1 ) ), 15, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_inf( tmns::math::transpose( m1 ) ), 9, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::min( tmns::math::transpose( m1 ) ), -6, 1e-12 );
+
+    tmns::math::MatrixN<double> m2( 300, 200 );
+    for( size_t r = 0; r < m2.rows(); r++ )
+    for( size_t c = 0; c < m2.cols(); c++ )
+    {
+        m2( r, c ) = ( r % 2 == 0 ) ? 1.0 : -1.0;
+    }
+    ASSERT_NEAR( tmns::math::linalg::sum( m2 ), 0, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_inf( m2 ), 200, 1e-12 );
+    ASSERT_NEAR( tmns::math::linalg::norm_1( m2 ), 300, 1e-12 );
+}
+
+/****************************************************/
+/*          Test Accuracy and Determinism           */
+/****************************************************/
+TEST( Reductions, summation_modes )
+{
+    // Many small values after one huge one are lost by naive summation
+    const size_t count = 1000001;
+    tmns::math::VectorN<double> v( count );
+    v[0] = 1e16;
+    for( size_t i = 1; i < count; i++ )
+    {
+        v[i] = 1.0;
+    }
+    const double exact = 1e16 + 1e6;
+
+    double kahan    = tmns::math::linalg::sum( v, Summation_Mode::KAHAN );
+    double pairwise = tmns::math::linalg::sum( v, Summation_Mode::PAIRWISE );
+    ASSERT_EQ( kahan, exact );
+    ASSERT_NEAR( pairwise, exact, 16 );
+
+    // Same input always gives bit-identical results
+    for( auto mode : { Summation_Mode::FAST, Summation_Mode::PAIRWISE, Summation_Mode::KAHAN } )
+    {
+        double first = tmns::math::linalg::sum( v, mode );
+        for( int trial = 0; trial < 3; trial++ )
+        {
+            ASSERT_EQ( tmns::math::linalg::sum( v, mode ), first );
+        }
+    }
+
+    // Large inputs agree with a long double reference
+    tmns::math::VectorN<double> w( count );
+    long double reference = 0;
+    for( size_t i = 0; i < count; i++ )
+    {
+        w[i] = std::sin( i * 0.001 ) * 1000.0;
+        reference += static_cast<long double>( w[i] ) * w[i];
+    }
+    ASSERT_NEAR( tmns::math::linalg::dot( w, w, Summation_Mode::KAHAN ), static_cast<double>( reference ), 1e-6 );
+    ASSERT_NEAR( tmns::math::linalg::norm_2_sqr( w ), static_cast<double>( reference ), 1e-3 );
+    ASSERT_NEAR( tmns::math::linalg::norm_inf( w ), 1000.0, 1e-3 );
+}
+
+/****************************************************/
+/*      Bit-identical Results on Any Thread Pool    */
+/****************************************************/
+TEST( Reductions, reproducible_across_pools )
+{
+    // Mixed magnitudes and signs, so the rounding depends on the summation order
+    const size_t count = 200003;
+    tmns::math::VectorN<double> v( count );
+    tmns::math::MatrixN<double> m( 401, 499 );
+    for( size_t i = 0; i < count; i++ )
+    {
+        v[i] = std::sin( 0.7 * i ) * std::pow( 10.0, static_cast<double>( i % 13 ) - 6 );
+        m.data()[i % ( m.rows() * m.cols() )] = v[i];
+    }
+
+    tmns::math::parallel::Thread_Pool serial( 1 );
+    tmns::math::parallel::Thread_Pool pair( 2 );
+    tmns::math::parallel::Thread_Pool wide( std::max<size_t>( 4, std::thread::hardware_concurrency() ) );
+
+    for( auto mode : { Summation_Mode::FAST, Summation_Mode::PAIRWISE, Summation_Mode::KAHAN } )
+    {
+        const double sum_1       = tmns::math::linalg::sum( v, mode, serial );
+        const double dot_1       = tmns::math::linalg::dot( v, v, mode, serial );
+        const double norm_1_1    = tmns::math::linalg::norm_1( v, mode, serial );
+        const double frobenius_1 = tmns::math::linalg::norm_frobenius( m, mode, serial );
+        const double induced_1   = tmns::math::linalg::norm_1( m, mode, serial );
+        for( auto* pool : { &pair, &wide } )
+        {
+            ASSERT_EQ( tmns::math::linalg::sum( v, mode, *pool ), sum_1 );
+            ASSERT_EQ( tmns::math::linalg::dot( v, v, mode, *pool ), dot_1 );
+            ASSERT_EQ( tmns::math::linalg::norm_1( v, mode, *pool ), norm_1_1 );
+            ASSERT_EQ( tmns::math::linalg::norm_frobenius( m, mode, *pool ), frobenius_1 );
+            ASSERT_EQ( tmns::math::linalg::norm_1( m, mode, *pool ), induced_1 );
+        }
+
+        // The global pool agrees too
+        ASSERT_EQ( tmns::math::linalg::sum( v, mode ), sum_1 );
+    }
+
+    ASSERT_EQ( tmns::math::linalg::max( v, wide ), tmns::math::linalg::max( v, serial ) );
+    ASSERT_EQ( tmns::math::linalg::norm_inf( v, pair ), tmns::math::linalg::norm_inf( v, serial ) );
+}
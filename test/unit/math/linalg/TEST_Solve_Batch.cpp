@@ -0,0 +1,156 @@
+/**
+ * @file    TEST_Solve_Batch.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/Solve_Batch.hpp>
+#include <terminus/math/linalg/Solvers.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Symmetric positive-definite system i of a batch
+ */
+template <size_t N>
+tmx::Matrix<double,N,N> batch_spd_matrix( size_t i )
+{
+    tmx::Matrix<double,N,N> A;
+    for( size_t r = 0; r < N; r++ )
+    {
+        for( size_t c = 0; c < N; c++ )
+        {
+            for( size_t k = 0; k < N; k++ )
+            {
+                A( r, c ) += std::sin( 1.0 + i + r * 3.0 + k ) * std::sin( 1.0 + i + c * 3.0 + k );
+            }
+        }
+        A( r, r ) += 0.5;
+    }
+    return A;
+}
+
+/**
+ * Non-symmetric system i of a batch, needing pivoting
+ */
+template <size_t N>
+tmx::Matrix<double,N,N> batch_general_matrix( size_t i )
+{
+    tmx::Matrix<double,N,N> A;
+    for( size_t r = 0; r < N; r++ )
+    {
+        for( size_t c = 0; c < N; c++ )
+        {
+            A( r, c ) = std::cos( 0.7 * i + 1.3 * r * c + c );
+        }
+    }
+    A( 0, 0 ) = 0;
+    return A;
+}
+
+/**
+ * Check A * x == b
+ */
+template <size_t N>
+void check_batch_solution( const tmx::Matrix<double,N,N>& A,
+                           const tmx::Vector_<double,N>&  x,
+                           const tmx::Vector_<double,N>&  b )
+{
+    for( size_t r = 0; r < N; r++ )
+    {
+        double value = 0;
+        for( size_t c = 0; c < N; c++ )
+        {
+            value += A( r, c ) * x[c];
+        }
+        ASSERT_NEAR( value, b[r], 1e-9 );
+    }
+}
+
+/****************************************************************/
+/*      Cholesky batch, with failures flagged per system        */
+/****************************************************************/
+TEST( Solve_Batch, symmetric )
+{
+    const size_t count = 37;
+    std::vector<tmx::Matrix<double,3,3>> A( count );
+    std::vector<tmx::Vector_<double,3>>  b( count ), x( count );
+    std::vector<uint8_t> success( count );
+    for( size_t i = 0; i < count; i++ )
+    {
+        A[i] = batch_spd_matrix<3>( i );
+        b[i] = tmx::Vector_<double,3>( { 1.0 * i, -2.0, 0.5 } );
+    }
+
+    // Indefinite and singular systems, the last positive-definite only by round-off,
+    // as lu_solve() would also reject it
+    A[5]( 1, 1 ) = -4;
+    A[20] = tmx::Matrix<double,3,3>();
+    A[30] = tmx::Matrix<double,3,3>();
+    A[30]( 0, 0 ) = A[30]( 0, 1 ) = A[30]( 1, 0 ) = A[30]( 2, 2 ) = 1;
+    A[30]( 1, 1 ) = 1 + std::numeric_limits<double>::epsilon();
+
+    tmx::parallel::Thread_Pool pool( 4 );
+    const size_t solved = tmx::linalg::solve_symmetric_batch<3>( A, b, x, success, pool );
+    ASSERT_EQ( solved, count - 3 );
+    for( size_t i = 0; i < count; i++ )
+    {
+        if( i == 5 || i == 20 || i == 30 )
+        {
+            ASSERT_EQ( success[i], 0 );
+            continue;
+        }
+        ASSERT_EQ( success[i], 1 );
+        check_batch_solution( A[i], x[i], b[i] );
+
+        auto expected = tmx::linalg::solve_symmetric( A[i], b[i] );
+        ASSERT_FALSE( expected.has_error() );
+        for( size_t r = 0; r < 3; r++ )
+        {
+            ASSERT_NEAR( x[i][r], expected.value()[r], 1e-12 );
+        }
+    }
+
+    success.pop_back();
+    ASSERT_THROW( tmx::linalg::solve_symmetric_batch<3>( A, b, x, success ), std::runtime_error );
+}
+
+/****************************************************************/
+/*      LU batch, pivoting per system                           */
+/****************************************************************/
+TEST( Solve_Batch, general )
+{
+    const size_t count = 21;
+    std::vector<tmx::Matrix<double,5,5>> A( count );
+    std::vector<tmx::Vector_<double,5>>  b( count ), x( count );
+    std::vector<uint8_t> success( count );
+    for( size_t i = 0; i < count; i++ )
+    {
+        A[i] = batch_general_matrix<5>( i );
+        b[i] = tmx::Vector_<double,5>( { 1.0, -1.0 * i, 2.0, 0.25, 3.0 } );
+    }
+
+    // Two equal rows
+    for( size_t c = 0; c < 5; c++ )
+    {
+        A[8]( 3, c ) = A[8]( 1, c );
+    }
+
+    const size_t solved = tmx::linalg::solve_batch<5>( A, b, x, success );
+    ASSERT_EQ( solved, count - 1 );
+    for( size_t i = 0; i < count; i++ )
+    {
+        ASSERT_EQ( success[i], i == 8 ? 0 : 1 );
+        if( i != 8 )
+        {
+            check_batch_solution( A[i], x[i], b[i] );
+        }
+    }
+}
@@ -0,0 +1,287 @@
+/**
+ * @file    TEST_Solvers.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/Solvers.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <type_traits>
+
+namespace tmx = tmns::math;
+
+/**
+ * Check A * x == b for a dense system
+ */
+template <typename MatrixT,
+          typename VectorT>
+void check_solution( const MatrixT& A,
+                     const VectorT& x,
+                     const VectorT& b )
+{
+    for( size_t r = 0; r < A.rows(); r++ )
+    {
+        double value = 0;
+        for( size_t c = 0; c < A.cols(); c++ )
+        {
+            value += A( r, c ) * x[c];
+        }
+        ASSERT_NEAR( value, b[r], 1e-10 );
+    }
+}
+
+/**********************************************************/
+/*      Symmetric positive-definite and indefinite        */
+/**********************************************************/
+TEST( Solvers, solve_symmetric_dynamic )
+{
+    const size_t n = 6;
+    tmx::MatrixN<double> A( n, n );
+    tmx::VectorN<double> b( n );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            A( r, c ) = 1.0 / ( 1 + r + c );
+        }
+        A( r, r ) += 1;
+        b[r] = r + 1.0;
+    }
+
+    auto x = tmx::linalg::solve_symmetric( A, b );
+    ASSERT_FALSE( x.has_error() );
+    check_solution( A, x.value(), b );
+
+    // Indefinite, so Cholesky fails and LDL^T is used
+    A( 2, 2 ) = -3;
+    x = tmx::linalg::solve_symmetric( A, b );
+    ASSERT_FALSE( x.has_error() );
+    check_solution( A, x.value(), b );
+
+    // Singular
+    for( size_t c = 0; c < n; c++ )
+    {
+        A( 4, c ) = A( 3, c );
+        A( c, 4 ) = A( c, 3 );
+    }
+    x = tmx::linalg::solve_symmetric( A, b );
+    ASSERT_TRUE( x.has_error() );
+
+    // Mismatched sizes
+    x = tmx::linalg::solve_symmetric( A, tmx::VectorN<double>( n + 1 ) );
+    ASSERT_TRUE( x.has_error() );
+}
+
+/**********************************************************/
+/*      Fixed-size systems                                */
+/**********************************************************/
+TEST( Solvers, solve_symmetric_fixed )
+{
+    tmx::Matrix<double,3,3> A;
+    A( 0, 0 ) = 4;  A( 0, 1 ) = 1;  A( 0, 2 ) = 2;
+    A( 1, 0 ) = 1;  A( 1, 1 ) = 5;  A( 1, 2 ) = 0;
+    A( 2, 0 ) = 2;  A( 2, 1 ) = 0;  A( 2, 2 ) = 6;
+    tmx::Vector_<double,3> b( { 1, -2, 3 } );
+
+    auto x = tmx::linalg::solve_symmetric( A, b );
+    static_assert( std::is_same_v<std::decay_t<decltype( x.value() )>,tmx::Vector_<double,3>> );
+    ASSERT_FALSE( x.has_error() );
+    check_solution( A, x.value(), b );
+
+    // Agrees with the dynamic version
+    auto x_dyn = tmx::linalg::solve_symmetric( tmx::MatrixN<double>( A ), tmx::VectorN<double>( b ) );
+    ASSERT_FALSE( x_dyn.has_error() );
+    for( size_t i = 0; i < 3; i++ )
+    {
+        ASSERT_NEAR( x.value()[i], x_dyn.value()[i], 1e-14 );
+    }
+
+    tmx::Matrix<double,2,2> S;
+    S( 0, 0 ) = 1;  S( 0, 1 ) = 2;
+    S( 1, 0 ) = 2;  S( 1, 1 ) = 4;
+    ASSERT_TRUE( tmx::linalg::solve_symmetric( S, tmx::Vector_<double,2>( { 1, 1 } ) ).has_error() );
+}
+
+/**********************************************************/
+/*      Indefinite systems with zero or tiny pivots       */
+/**********************************************************/
+TEST( Solvers, solve_symmetric_pivoted )
+{
+    // Zero and tiny leading diagonal entries, which need a row interchange
+    for( const double leading : { 0.0, 1e-17 } )
+    {
+        tmx::Matrix<double,2,2> A;
+        A( 0, 0 ) = leading;  A( 0, 1 ) = 1;
+        A( 1, 0 ) = 1;        A( 1, 1 ) = leading == 0 ? 0 : 1;
+        tmx::Vector_<double,2> b( { 2, 3 } );
+
+        auto x = tmx::linalg::solve_symmetric( A, b );
+        ASSERT_FALSE( x.has_error() );
+        check_solution( A, x.value(), b );
+
+        auto x_dyn = tmx::linalg::solve_symmetric( tmx::MatrixN<double>( A ), tmx::VectorN<double>( b ) );
+        ASSERT_FALSE( x_dyn.has_error() );
+        check_solution( tmx::MatrixN<double>( A ), x_dyn.value(), tmx::VectorN<double>( b ) );
+    }
+
+    // Saddle point system [ H C^T ; C 0 ], which takes 2x2 pivots
+    const size_t n = 7;
+    tmx::MatrixN<double> K( n, n );
+    tmx::VectorN<double> b( n );
+    for( size_t r = 0; r < 4; r++ )
+    {
+        K( r, r ) = 2 + r;
+        for( size_t c = 4; c < n; c++ )
+        {
+            K( r, c ) = std::cos( 1.0 * r * c + 0.3 );
+            K( c, r ) = K( r, c );
+        }
+    }
+    for( size_t r = 0; r < n; r++ )
+    {
+        b[r] = 1.0 - 0.5 * r;
+    }
+    auto x = tmx::linalg::solve_symmetric( K, b );
+    ASSERT_FALSE( x.has_error() );
+    check_solution( K, x.value(), b );
+}
+
+/**********************************************************/
+/*      General solve, square and least squares           */
+/**********************************************************/
+TEST( Solvers, solve_svd )
+{
+    // Non-symmetric, so a transposed copy of A would give the wrong answer
+    for( size_t n : { 5, 40 } )
+    {
+        tmx::MatrixN<double> A( n, n );
+        tmx::VectorN<double> b( n );
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t c = 0; c < n; c++ )
+            {
+                A( r, c ) = std::sin( 1.0 + r + 3.0 * c * c ) + ( r == c ? n : 0 ) + 0.5 * c;
+            }
+            b[r] = std::cos( 2.0 * r );
+        }
+
+        tmx::linalg::SVD_Solve_Info info;
+        auto x = tmx::linalg::solve( A, b, info );
+        ASSERT_FALSE( x.has_error() );
+        check_solution( A, x.value(), b );
+        ASSERT_EQ( info.rank, n );
+        ASSERT_GT( info.condition, 1 );
+        ASSERT_LT( info.condition, 1e3 );
+    }
+
+    // Rank deficient, giving the minimum-norm solution
+    tmx::MatrixN<double> A( 3, 2 );
+    A( 0, 0 ) = 1;  A( 0, 1 ) = 1;
+    A( 1, 0 ) = 2;  A( 1, 1 ) = 2;
+    A( 2, 0 ) = 3;  A( 2, 1 ) = 3;
+    tmx::VectorN<double> b( { 2, 4, 6 } );
+    tmx::linalg::SVD_Solve_Info info;
+    auto x = tmx::linalg::solve( A, b, info );
+    ASSERT_FALSE( x.has_error() );
+    ASSERT_EQ( info.rank, 1 );
+    ASSERT_GT( info.condition, 1e12 );
+    ASSERT_NEAR( x.value()[0], 1, 1e-12 );
+    ASSERT_NEAR( x.value()[1], 1, 1e-12 );
+
+    ASSERT_TRUE( tmx::linalg::solve( A, tmx::VectorN<double>( 2 ) ).has_error() );
+}
+
+/**********************************************************/
+/*      Several right-hand sides share a decomposition    */
+/**********************************************************/
+TEST( Solvers, solve_svd_multiple )
+{
+    const size_t n = 6;
+    tmx::MatrixN<double> A( n + 2, n ), B( n + 2, 3 );
+    for( size_t r = 0; r < n + 2; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            A( r, c ) = 1.0 / ( 1.0 + r + 2.0 * c ) + ( r == c ? 1 : 0 );
+        }
+        for( size_t c = 0; c < 3; c++ )
+        {
+            B( r, c ) = std::sin( 1.0 * r * ( c + 1 ) );
+        }
+    }
+
+    auto X = tmx::linalg::solve( A, B );
+    ASSERT_FALSE( X.has_error() );
+    ASSERT_EQ( X.value().rows(), n );
+    ASSERT_EQ( X.value().cols(), 3 );
+    for( size_t c = 0; c < 3; c++ )
+    {
+        tmx::VectorN<double> b( n + 2 );
+        for( size_t r = 0; r < n + 2; r++ )
+        {
+            b[r] = B( r, c );
+        }
+        auto x = tmx::linalg::solve( A, b );
+        ASSERT_FALSE( x.has_error() );
+        for( size_t r = 0; r < n; r++ )
+        {
+            ASSERT_NEAR( X.value()( r, c ), x.value()[r], 1e-12 );
+        }
+    }
+}
+
+/**********************************************************/
+/*      Symmetric solve for several right-hand sides      */
+/**********************************************************/
+TEST( Solvers, solve_symmetric_multiple )
+{
+    tmx::Matrix<double,3,3> A;
+    A( 0, 0 ) = 4;  A( 0, 1 ) = 1;  A( 0, 2 ) = 0;
+    A( 1, 0 ) = 1;  A( 1, 1 ) = 3;  A( 1, 2 ) = -1;
+    A( 2, 0 ) = 0;  A( 2, 1 ) = -1; A( 2, 2 ) = 2;
+    tmx::Matrix<double,3,2> B;
+    B( 0, 0 ) = 1;  B( 0, 1 ) = 0;
+    B( 1, 0 ) = 2;  B( 1, 1 ) = -1;
+    B( 2, 0 ) = 3;  B( 2, 1 ) = 5;
+
+    auto X     = tmx::linalg::solve_symmetric( A, B );
+    auto X_dyn = tmx::linalg::solve_symmetric( tmx::MatrixN<double>( A ), tmx::MatrixN<double>( B ) );
+    ASSERT_FALSE( X.has_error() );
+    ASSERT_FALSE( X_dyn.has_error() );
+    for( size_t c = 0; c < 2; c++ )
+    {
+        tmx::Vector_<double,3> b( { B( 0, c ), B( 1, c ), B( 2, c ) } );
+        tmx::Vector_<double,3> x( { X.value()( 0, c ), X.value()( 1, c ), X.value()( 2, c ) } );
+        check_solution( A, x, b );
+        for( size_t r = 0; r < 3; r++ )
+        {
+            ASSERT_NEAR( X_dyn.value()( r, c ), x[r], 1e-14 );
+        }
+    }
+
+    // Indefinite with a zero leading pivot, which takes the pivoted factorization
+    tmx::Matrix<double,3,3> K;
+    K( 0, 0 ) = 0;  K( 0, 1 ) = 1;  K( 0, 2 ) = 0;
+    K( 1, 0 ) = 1;  K( 1, 1 ) = 0;  K( 1, 2 ) = 2;
+    K( 2, 0 ) = 0;  K( 2, 1 ) = 2;  K( 2, 2 ) = -1;
+    auto Y     = tmx::linalg::solve_symmetric( K, B );
+    auto Y_dyn = tmx::linalg::solve_symmetric( tmx::MatrixN<double>( K ), tmx::MatrixN<double>( B ) );
+    ASSERT_FALSE( Y.has_error() );
+    ASSERT_FALSE( Y_dyn.has_error() );
+    for( size_t c = 0; c < 2; c++ )
+    {
+        tmx::Vector_<double,3> b( { B( 0, c ), B( 1, c ), B( 2, c ) } );
+        tmx::Vector_<double,3> y( { Y.value()( 0, c ), Y.value()( 1, c ), Y.value()( 2, c ) } );
+        check_solution( K, y, b );
+        for( size_t r = 0; r < 3; r++ )
+        {
+            ASSERT_NEAR( Y_dyn.value()( r, c ), y[r], 1e-14 );
+        }
+    }
+
+    ASSERT_TRUE( tmx::linalg::solve_symmetric( tmx::MatrixN<double>( A ), tmx::MatrixN<double>( 2, 2 ) ).has_error() );
+}
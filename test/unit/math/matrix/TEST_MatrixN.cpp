@@ -89,4 +89,29 @@ TEST( MatrixN, constructor_tests )
     ASSERT_EQ( &(*(mat_01.begin())),   &(mat_01(0,0)));
     ASSERT_EQ( &(*(mat_01.begin()+1)), &(mat_01(0,1)));
     ASSERT_EQ( mat_01.end(), mat_01.begin() + 6 );
+}
+
+/****************************************/
+/*      Test Small-Buffer Storage       */
+/****************************************/
+TEST( MatrixN, small_buffer_storage )
+{
+    // A 5x4 Jacobian fits inline
+    tmx::MatrixN<double> mat_01( 5, 4 );
+    ASSERT_EQ( &(*(mat_01.begin())), mat_01.data() );
+    ASSERT_TRUE( reinterpret_cast<const char*>( mat_01.data() ) >= reinterpret_cast<const char*>( &mat_01 ) &&
+                 reinterpret_cast<const char*>( mat_01.data() ) <  reinterpret_cast<const char*>( &mat_01 + 1 ) );
+
+    // Preserving resize past the inline capacity keeps existing values
+    mat_01( 1, 2 ) = 7;
+    mat_01.set_size( 10, 10, true );
+    ASSERT_EQ( mat_01.rows(), 10 );
+    ASSERT_EQ( mat_01.cols(), 10 );
+    ASSERT_NEAR( mat_01( 1, 2 ), 7, 0.001 );
+    ASSERT_NEAR( mat_01( 9, 9 ), 0, 0.001 );
+
+    // Moving a spilled matrix does not copy the elements
+    const double* ptr = mat_01.data();
+    tmx::MatrixN<double> mat_02( std::move( mat_01 ) );
+    ASSERT_EQ( mat_02.data(), ptr );
 }
\ No newline at end of file
@@ -490,10 +490,14 @@ TEST_F( Matrix_Operations, select_row_test_02_transpose )
 /************************************************/
 TEST_F( Matrix_Operations, matrix_multiplication_blended )
 {
-    // Create Proxy Matrix
+    // Create Proxy Matrix over the top 3x3 block of mat_01
     const tmx::Matrix_Proxy<const double,3,3> mat_p( mat_01.data() );
 
-    const tmx::Matrix_Transpose mat_t( mat_02 );
+    // Transpose of its transpose, i.e. the same 3x3 block
+    tmx::Matrix<double,3,3> mat_03 { { 1, 4, 7,
+                                       2, 5, 8,
+                                       3, 6, 9 } };
+    const tmx::Matrix_Transpose mat_t( mat_03 );
 
     // Multiply matrices
     auto result = mat_p * mat_t;
@@ -514,21 +518,28 @@ TEST_F( Matrix_Operations, matrix_multiplication_blended )
 /************************************************/
 TEST_F( Matrix_Operations, matrix_multiplication_vector_blended )
 {
-    // Create Proxy Matrix
+    // Create Proxy Matrix over the top 3x3 block of mat_01
     const tmx::Matrix_Proxy<const double,3,3> mat_p( mat_01.data() );
 
-    const tmx::Matrix_Transpose mat_t( mat_02 );
-
-    // Multiply matrices
-    auto result = mat_p * mat_t;
+    // Each column of the expected product, as the proxy times a column of the
+    // transposed operand
+    tmx::Matrix<double,3,3> mat_03 { { 1, 4, 7,
+                                       2, 5, 8,
+                                       3, 6, 9 } };
+    const tmx::Matrix_Transpose mat_t( mat_03 );
 
     std::array<double,9> exp_result {  30,  36,  42,
                                        66,  81,  96,
                                       102, 126, 150 };
 
-    size_t counter = 0;
-    for( auto it = result.begin(); it != result.end(); it++ )
+    for( size_t c = 0; c < 3; c++ )
     {
-        ASSERT_NEAR( (*it), exp_result[counter++], 0.01 );
+        tmx::Vector_<double,3> column( { mat_t( 0, c ), mat_t( 1, c ), mat_t( 2, c ) } );
+        auto result = mat_p * column;
+        ASSERT_EQ( result.size(), 3 );
+        for( size_t r = 0; r < 3; r++ )
+        {
+            ASSERT_NEAR( result( r ), exp_result[3 * r + c], 0.01 );
+        }
     }
 }
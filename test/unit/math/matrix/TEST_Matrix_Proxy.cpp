@@ -0,0 +1,166 @@
+/**
+ * @file    TEST_Matrix_Proxy.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/matrix.hpp>
+#include <terminus/math/vector.hpp>
+
+// C++ Libraries
+#include <array>
+#include <numeric>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Smallest view with the std::mdspan interface, so the interop is exercised on
+ * toolchains without <mdspan>
+ */
+template <typename ElementT,
+          size_t   RankN>
+struct Test_Strided_View
+{
+    static constexpr size_t rank() { return RankN; }
+    static constexpr bool is_always_strided() { return true; }
+    size_t extent( size_t r ) const { return extents[r]; }
+    size_t stride( size_t r ) const { return strides[r]; }
+    ElementT* data_handle() const { return data; }
+
+    ElementT* data;
+    std::array<size_t,RankN> extents;
+    std::array<size_t,RankN> strides;
+};
+
+/********************************************/
+/*          Test Packed Span Views          */
+/********************************************/
+TEST( Matrix_Proxy, span_views )
+{
+    std::vector<double> buffer( 12 );
+    std::iota( buffer.begin(), buffer.end(), 0 );
+
+    tmx::Matrix_Proxy<double> view( std::span<double>( buffer ), 3, 4 );
+    ASSERT_EQ( view.rows(), 3 );
+    ASSERT_EQ( view.cols(), 4 );
+    ASSERT_TRUE( view.is_contiguous() );
+    ASSERT_NEAR( view( 2, 1 ), 9, 0.0001 );
+
+    // Writes go through to the buffer
+    view( 1, 1 ) = 100;
+    ASSERT_NEAR( buffer[5], 100, 0.0001 );
+
+    auto round_trip = view.to_span();
+    ASSERT_EQ( round_trip.data(), buffer.data() );
+    ASSERT_EQ( round_trip.size(), 12 );
+
+    // Too small for the requested shape
+    ASSERT_THROW( tmx::Matrix_Proxy<double>( std::span<double>( buffer ), 4, 4 ), std::runtime_error );
+    ASSERT_THROW( tmx::Matrix_Proxy<double>( std::span<double>( buffer ), 3, 4, 5, 1 ), std::runtime_error );
+
+    // Fixed-size proxy over a fixed-extent span
+    std::array<double,4> fixed { 1, 2, 3, 4 };
+    tmx::Matrix_Proxy<double,2,2> fixed_view{ std::span<double,4>( fixed ) };
+    ASSERT_NEAR( fixed_view( 1, 0 ), 3, 0.0001 );
+    ASSERT_EQ( fixed_view.to_span().data(), fixed.data() );
+}
+
+/************************************************/
+/*          Test Strided and Windowed Views     */
+/************************************************/
+TEST( Matrix_Proxy, strided_views )
+{
+    // Column-major (layout_left) 2x3 buffer
+    std::vector<double> col_major { 1, 4, 2, 5, 3, 6 };
+    auto left = tmx::matrix_proxy( col_major.data(), 2, 3, 1, 2 );
+    ASSERT_FALSE( left.is_contiguous() );
+    ASSERT_THROW( left.to_span(), std::runtime_error );
+
+    tmx::Matrix<double,2,3> expected( { 1, 2, 3,
+                                        4, 5, 6 } );
+    for( size_t r = 0; r < 2; r++ )
+    for( size_t c = 0; c < 3; c++ )
+    {
+        ASSERT_NEAR( left( r, c ), expected( r, c ), 0.0001 );
+    }
+
+    // Iteration is in row-major order regardless of layout
+    std::vector<double> visited( left.begin(), left.end() );
+    ASSERT_EQ( visited, std::vector<double>( { 1, 2, 3, 4, 5, 6 } ) );
+
+    // Full expression support:  (2x3) * (3x2)
+    tmx::Matrix<double,3,2> rhs( { 1, 0,
+                                   0, 1,
+                                   1, 1 } );
+    tmx::Matrix<double,2,2> product = left * rhs;
+    ASSERT_NEAR( product( 0, 0 ),  4, 0.0001 );
+    ASSERT_NEAR( product( 1, 1 ), 11, 0.0001 );
+
+    // Interleaved raster (2 bands, pixel spacing 2) with a flipped row order
+    std::vector<float> raster( 2 * 3 * 4 );
+    std::iota( raster.begin(), raster.end(), 0 );
+    tmx::Matrix_Proxy<float> band1( raster.data() + 1 + 2 * 8, 3, 4, -8, 2 );
+    ASSERT_NEAR( band1( 0, 0 ), 17, 0.0001 );
+    ASSERT_NEAR( band1( 2, 3 ),  7, 0.0001 );
+
+    // Sub-window keeps the parent strides and writes in place
+    auto window = band1.window( 1, 1, 2, 2 );
+    ASSERT_EQ( window.rows(), 2 );
+    ASSERT_EQ( window.row_stride(), -8 );
+    ASSERT_NEAR( window( 0, 0 ), 11, 0.0001 );
+    window = tmx::Matrix<float,2,2>( { -1, -2, -3, -4 } );
+    ASSERT_NEAR( raster[11], -1, 0.0001 );
+    ASSERT_NEAR( raster[5],  -4, 0.0001 );
+    ASSERT_NEAR( raster[1],   1, 0.0001 );
+    ASSERT_THROW( band1.window( 2, 2, 2, 2 ), std::runtime_error );
+
+    // Copying out produces a packed matrix
+    tmx::MatrixN<float> packed( window );
+    ASSERT_NEAR( packed( 1, 0 ), -3, 0.0001 );
+}
+
+/********************************************/
+/*          Test mdspan-style Views         */
+/********************************************/
+TEST( Matrix_Proxy, strided_view_interop )
+{
+    static_assert( tmx::Strided_View<Test_Strided_View<double,2>,2> );
+    static_assert( !tmx::Strided_View<Test_Strided_View<double,1>,2> );
+    static_assert( !tmx::Strided_View<tmx::MatrixN<double>,2> );
+
+    // Column-major (layout_left) 2x3 buffer
+    std::vector<double> col_major { 1, 4, 2, 5, 3, 6 };
+    Test_Strided_View<double,2> view { col_major.data(), { 2, 3 }, { 1, 2 } };
+    auto left = tmx::matrix_proxy( view );
+    static_assert( std::is_same_v<decltype( left ), tmx::Matrix_Proxy<double>> );
+    ASSERT_EQ( left.rows(), 2 );
+    ASSERT_EQ( left.col_stride(), 2 );
+    ASSERT_NEAR( left( 1, 2 ), 6, 0.0001 );
+    left( 0, 1 ) = -2;
+    ASSERT_NEAR( col_major[2], -2, 0.0001 );
+
+    // Read-only data stays read-only
+    const std::vector<double>& readonly = col_major;
+    Test_Strided_View<const double,2> const_view { readonly.data(), { 2, 3 }, { 1, 2 } };
+    auto const_proxy = tmx::matrix_proxy( const_view );
+    static_assert( std::is_same_v<decltype( const_proxy ), tmx::Matrix_Proxy<const double>> );
+    static_assert( !std::is_constructible_v<tmx::Matrix_Proxy<double>,Test_Strided_View<const double,2>> );
+    ASSERT_NEAR( const_proxy( 1, 0 ), 4, 0.0001 );
+
+    // Read-only containers give read-only proxies
+    const tmx::MatrixN<double> matrix( 2, 2 );
+    auto matrix_view = tmx::matrix_proxy( matrix );
+    static_assert( std::is_same_v<decltype( matrix_view ), tmx::Matrix_Proxy<const double>> );
+    ASSERT_EQ( matrix_view.data(), matrix.data() );
+
+#if defined( __cpp_lib_mdspan )
+    std::mdspan<double,std::dextents<size_t,2>,std::layout_left> md( col_major.data(), 2, 3 );
+    auto md_proxy = tmx::matrix_proxy( md );
+    ASSERT_NEAR( md_proxy( 1, 2 ), 6, 0.0001 );
+    auto round_trip = md_proxy.to_mdspan();
+    ASSERT_EQ( round_trip.stride( 1 ), 2 );
+#endif
+}
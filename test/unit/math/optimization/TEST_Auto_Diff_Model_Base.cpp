@@ -0,0 +1,145 @@
+/**
+ * @file    TEST_Auto_Diff_Model_Base.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/Auto_Diff_Model_Base.hpp>
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+
+namespace tmx = tmns::math;
+
+/**
+ * Same model as the LM test, with exact derivatives
+*/
+struct Test_Auto_Diff_Model : public tmx::optimize::Auto_Diff_Model_Base<Test_Auto_Diff_Model,4>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    /// Evaluate h(x)
+    template <typename T>
+    tmx::VectorN<T> operator()( tmx::VectorN<T> const& x ) const
+    {
+        using std::sin;
+        using std::cos;
+        using std::atan2;
+
+        tmx::VectorN<T> h(5);
+        h(0) = sin(x(0)+0.1);
+        h(1) = cos(x(1) * x(2));
+        h(2) = x(1) * cos(x(2));
+        h(3) = atan2(x(0),x(3));
+        h(4) = atan2(x(2),x(1));
+        return h;
+    }
+}; // End of Test_Auto_Diff_Model class
+
+/**
+ * Numerically differentiated copy of the model
+*/
+struct Test_Numeric_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Numeric_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        return Test_Auto_Diff_Model()( x );
+    }
+}; // End of Test_Numeric_Model class
+
+/**
+ * Polynomial with more parameters than the Jet carries
+*/
+struct Test_Chunked_Model : public tmx::optimize::Auto_Diff_Model_Base<Test_Chunked_Model,4>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    template <typename T>
+    tmx::VectorN<T> operator()( tmx::VectorN<T> const& x ) const
+    {
+        tmx::VectorN<T> h( 3 );
+        for( size_t i = 0; i < x.size(); i++ )
+        {
+            h[0] += x[i] * x[i];
+            h[1] += ( i + 1.0 ) * x[i];
+            h[2] += x[i] * x[( i + 1 ) % x.size()];
+        }
+        return h;
+    }
+}; // End of Test_Chunked_Model class
+
+/********************************************************/
+/*      Compare the exact and numerical Jacobians       */
+/********************************************************/
+TEST( Auto_Diff_Model_Base, jacobian )
+{
+    Test_Auto_Diff_Model model;
+    Test_Numeric_Model   numeric;
+    tmx::VectorN<double> x( { 0.2, 0.3, 0.4, 0.5 } );
+
+    auto J  = model.jacobian( x );
+    auto Jn = numeric.jacobian( x );
+
+    ASSERT_EQ( J.rows(), 5 );
+    ASSERT_EQ( J.cols(), 4 );
+    for( size_t r = 0; r < J.rows(); r++ )
+    {
+        for( size_t c = 0; c < J.cols(); c++ )
+        {
+            EXPECT_NEAR( J( r, c ), Jn( r, c ), 1e-5 );
+        }
+    }
+
+    // Exact values
+    EXPECT_NEAR( J( 0, 0 ), std::cos( 0.3 ), 1e-15 );
+    EXPECT_NEAR( J( 2, 2 ), -0.3 * std::sin( 0.4 ), 1e-15 );
+    EXPECT_NEAR( J( 3, 0 ), 0.5 / ( 0.04 + 0.25 ), 1e-15 );
+}
+
+/************************************************************/
+/*      Problems larger than the Jet are done in blocks     */
+/************************************************************/
+TEST( Auto_Diff_Model_Base, chunked_jacobian )
+{
+    Test_Chunked_Model model;
+    tmx::VectorN<double> x( 10 );
+    for( size_t i = 0; i < x.size(); i++ )
+    {
+        x[i] = 0.1 * i - 0.3;
+    }
+
+    auto J = model.jacobian( x );
+    ASSERT_EQ( J.rows(), 3 );
+    ASSERT_EQ( J.cols(), 10 );
+    for( size_t i = 0; i < x.size(); i++ )
+    {
+        EXPECT_NEAR( J( 0, i ), 2 * x[i], 1e-15 );
+        EXPECT_NEAR( J( 1, i ), i + 1.0, 1e-15 );
+        EXPECT_NEAR( J( 2, i ), x[( i + 1 ) % 10] + x[( i + 9 ) % 10], 1e-15 );
+    }
+}
+
+/****************************************************/
+/*      Solve with LM using the exact Jacobian      */
+/****************************************************/
+TEST( Auto_Diff_Model_Base, levenberg_marquardt )
+{
+    Test_Auto_Diff_Model model;
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    tmx::VectorN<double> seed( { 1.0, 1.0, 1.0, 1.0 } );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto best = tmx::optimize::levenberg_marquardt( model, seed, target, status );
+    ASSERT_FALSE( best.has_error() );
+
+    tmx::Vector_<double,4> expected_best( { 0.101358, 1.15485, 1.12093, 0.185534 } );
+    EXPECT_NEAR( tmx::VectorN<double>( expected_best - best.value() ).magnitude(), 0, 1e-5 );
+}
@@ -0,0 +1,230 @@
+/**
+ * @file    TEST_Jacobian_Sparsity.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Tridiagonal model, where each output depends on its parameter and both neighbors.
+ * Counts its evaluations.
+*/
+struct Test_Banded_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Banded_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    explicit Test_Banded_Model( size_t size )
+      : m_size( size )
+    {}
+
+    result_type operator()( domain_type const& x ) const
+    {
+        m_evaluations++;
+        result_type h( m_size );
+        for( size_t i = 0; i < m_size; i++ )
+        {
+            h[i] = 2 * x[i] + 0.5 * x[i] * x[i];
+            if( i > 0 )
+            {
+                h[i] -= std::sin( x[i - 1] );
+            }
+            if( i + 1 < m_size )
+            {
+                h[i] += 0.3 * x[i + 1] * x[i];
+            }
+        }
+        return h;
+    }
+
+    size_t m_size;
+    mutable std::atomic<int> m_evaluations { 0 };
+}; // End of Test_Banded_Model class
+
+/**
+ * Point to differentiate at
+ */
+tmx::VectorN<double> banded_point( size_t size )
+{
+    tmx::VectorN<double> x( size );
+    for( size_t i = 0; i < size; i++ )
+    {
+        x[i] = 0.1 + 0.05 * i;
+    }
+    return x;
+}
+
+/****************************************************************/
+/*      Declared patterns are grouped into orthogonal columns   */
+/****************************************************************/
+TEST( Jacobian_Sparsity, declared_pattern )
+{
+    // Block diagonal with 3x2 blocks, plus a dense last column
+    std::vector<std::pair<size_t,size_t>> entries;
+    for( size_t block = 0; block < 4; block++ )
+    {
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = 0; c < 2; c++ )
+            {
+                entries.emplace_back( 3 * block + r, 2 * block + c );
+            }
+        }
+    }
+    for( size_t r = 0; r < 12; r++ )
+    {
+        entries.emplace_back( r, 8 );
+        entries.emplace_back( r, 8 );
+    }
+    tmx::optimize::Jacobian_Sparsity pattern( 12, 9, entries );
+
+    ASSERT_EQ( pattern.rows(), 12 );
+    ASSERT_EQ( pattern.cols(), 9 );
+    ASSERT_EQ( pattern.non_zeros(), 4 * 6 + 12 );
+    ASSERT_EQ( pattern.num_groups(), 3 );
+
+    // No two columns of a group share a row
+    for( size_t g = 0; g < pattern.num_groups(); g++ )
+    {
+        std::vector<int> used( pattern.rows(), 0 );
+        for( auto c : pattern.group( g ) )
+        {
+            ASSERT_EQ( pattern.group_of( c ), g );
+            for( auto r : pattern.column( c ) )
+            {
+                ASSERT_EQ( used[r]++, 0 );
+            }
+        }
+    }
+
+    entries.emplace_back( 12, 0 );
+    ASSERT_THROW( tmx::optimize::Jacobian_Sparsity( 12, 9, entries ), std::out_of_range );
+}
+
+/****************************************************************/
+/*      Grouped differences match the column-by-column ones     */
+/****************************************************************/
+TEST( Jacobian_Sparsity, grouped_jacobian )
+{
+    const size_t size = 30;
+    Test_Banded_Model model( size );
+    auto x  = banded_point( size );
+    auto h0 = model( x );
+
+    auto pattern = tmx::optimize::probe_jacobian_sparsity( model, x );
+    ASSERT_EQ( pattern.non_zeros(), 3 * size - 2 );
+    ASSERT_EQ( pattern.num_groups(), 3 );
+
+    for( auto difference : { tmx::optimize::Difference_Method::FORWARD,
+                             tmx::optimize::Difference_Method::CENTRAL } )
+    {
+        tmx::optimize::Numeric_Jacobian_Options options;
+        options.difference = difference;
+        model.set_jacobian_options( options );
+
+        tmx::MatrixN<double> expected( size, size );
+        tmx::optimize::Numeric_Jacobian_Scratch<tmx::VectorN<double>,tmx::VectorN<double>> scratch;
+        model.m_evaluations = 0;
+        model.jacobian( x, h0, expected, scratch );
+        const int dense_evaluations = model.m_evaluations;
+
+        // Dense output, with garbage to be cleared
+        options.sparsity = &pattern;
+        model.set_jacobian_options( options );
+        tmx::MatrixN<double> dense( size, size );
+        for( size_t r = 0; r < size; r++ )
+        {
+            for( size_t c = 0; c < size; c++ )
+            {
+                dense( r, c ) = 99;
+            }
+        }
+        model.m_evaluations = 0;
+        model.jacobian( x, h0, dense, scratch );
+        ASSERT_EQ( model.m_evaluations * size, dense_evaluations * 3 );
+
+        // Sparse output
+        tmx::optimize::Sparse_Jacobian sparse( pattern );
+        model.jacobian( x, h0, sparse, scratch );
+        auto expanded = sparse.to_dense();
+
+        // Parallel groups
+        options.parallel = true;
+        tmx::parallel::Thread_Pool pool( 4 );
+        options.pool = &pool;
+        model.set_jacobian_options( options );
+        tmx::MatrixN<double> parallel( size, size );
+        model.jacobian( x, h0, parallel, scratch );
+
+        for( size_t r = 0; r < size; r++ )
+        {
+            for( size_t c = 0; c < size; c++ )
+            {
+                ASSERT_EQ( dense( r, c ), expected( r, c ) );
+                ASSERT_EQ( expanded( r, c ), expected( r, c ) );
+                ASSERT_EQ( sparse( r, c ), expected( r, c ) );
+                ASSERT_EQ( parallel( r, c ), expected( r, c ) );
+            }
+        }
+    }
+}
+
+/****************************************************************/
+/*              Solve with a grouped Jacobian                   */
+/****************************************************************/
+TEST( Jacobian_Sparsity, levenberg_marquardt )
+{
+    const size_t size = 20;
+    Test_Banded_Model model( size );
+    auto truth  = banded_point( size );
+    auto target = model( truth );
+    tmx::VectorN<double> seed( size );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto expected = tmx::optimize::levenberg_marquardt( model, seed, target, status );
+    ASSERT_FALSE( expected.has_error() );
+
+    auto pattern = tmx::optimize::probe_jacobian_sparsity( model, truth );
+    tmx::optimize::Numeric_Jacobian_Options options;
+    options.sparsity = &pattern;
+    model.set_jacobian_options( options );
+
+    auto result = tmx::optimize::levenberg_marquardt( model, seed, target, status );
+    ASSERT_FALSE( result.has_error() );
+    for( size_t i = 0; i < size; i++ )
+    {
+        ASSERT_EQ( result.value()[i], expected.value()[i] );
+        ASSERT_NEAR( result.value()[i], truth[i], 1e-6 );
+    }
+
+    // Broyden updates save a grouped Jacobian's evaluations, two per group with CENTRAL
+    options.difference = tmx::optimize::Difference_Method::CENTRAL;
+    model.set_jacobian_options( options );
+    ASSERT_EQ( model.jacobian_evaluations( seed ), 2 * pattern.num_groups() );
+
+    tmx::optimize::LM_Jacobian_Update_Options update;
+    update.method = tmx::optimize::Jacobian_Update_Method::BROYDEN;
+    tmx::optimize::LM_Workspace<Test_Banded_Model> workspace;
+    workspace.set_jacobian_update( update );
+    ASSERT_FALSE( tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status ).has_error() );
+    const auto& statistics = workspace.jacobian_statistics();
+    ASSERT_GT( statistics.broyden_updates, 0 );
+    ASSERT_EQ( statistics.evaluations_saved, statistics.broyden_updates * 2 * pattern.num_groups() );
+
+    // Patterns of the wrong size are rejected
+    tmx::optimize::Jacobian_Sparsity wrong( size, size + 1, {} );
+    options.sparsity = &wrong;
+    model.set_jacobian_options( options );
+    ASSERT_THROW( model.jacobian( seed ), std::runtime_error );
+}
@@ -0,0 +1,107 @@
+/**
+ * @file    TEST_LM_Batch.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/LM_Batch.hpp>
+
+// C++ Libraries
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Exponential decay y = a * exp( -b * t ), sampled at 8 fixed times
+*/
+struct Test_Decay_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Decay_Model>
+{
+    using result_type   = tmx::Vector_<double,8>;
+    using domain_type   = tmx::Vector_<double,2>;
+    using jacobian_type = tmx::Matrix<double,8,2>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h;
+        for( size_t i = 0; i < 8; i++ )
+        {
+            h[i] = x[0] * std::exp( -x[1] * 0.25 * i );
+        }
+        return h;
+    }
+}; // End of Test_Decay_Model class
+
+/**
+ * Build a batch of problems with varying truth
+ */
+void build_batch( size_t                                       num_problems,
+                  std::vector<Test_Decay_Model::domain_type>&  truth,
+                  std::vector<Test_Decay_Model::domain_type>&  seeds,
+                  std::vector<Test_Decay_Model::result_type>&  observations )
+{
+    Test_Decay_Model model;
+    for( size_t i = 0; i < num_problems; i++ )
+    {
+        truth.push_back( Test_Decay_Model::domain_type( { 1.0 + 0.01 * i, 0.2 + 0.003 * i } ) );
+        seeds.push_back( Test_Decay_Model::domain_type( { 1.0, 0.5 } ) );
+        observations.push_back( model( truth.back() ) );
+    }
+}
+
+/************************************************************/
+/*      Batch solutions match individual solves exactly     */
+/************************************************************/
+TEST( LM_Batch, matches_individual_solves )
+{
+    tmns::math::parallel::Thread_Pool pool( 4 );
+    Test_Decay_Model model;
+
+    std::vector<Test_Decay_Model::domain_type> truth, seeds;
+    std::vector<Test_Decay_Model::result_type> observations;
+    build_batch( 300, truth, seeds, observations );
+
+    std::vector<Test_Decay_Model::domain_type> solutions( seeds.size() );
+    std::vector<tmx::optimize::LM_Batch_Result> results( seeds.size() );
+    tmx::optimize::levenberg_marquardt_batch( model,
+                                              seeds,
+                                              observations,
+                                              solutions,
+                                              results,
+                                              MATH_LM_ABS_TOL,
+                                              MATH_LM_REL_TOL,
+                                              MATH_LM_MAX_ITER,
+                                              pool );
+
+    for( size_t i = 0; i < seeds.size(); i++ )
+    {
+        tmx::optimize::LM_STATUS_CODE status;
+        auto expected = tmx::optimize::levenberg_marquardt( model, seeds[i], observations[i], status );
+        ASSERT_FALSE( expected.has_error() );
+
+        ASSERT_EQ( results[i].status, status );
+        ASSERT_GT( results[i].iterations, 0 );
+        ASSERT_EQ( solutions[i][0], expected.value()[0] );
+        ASSERT_EQ( solutions[i][1], expected.value()[1] );
+        ASSERT_NEAR( solutions[i][0], truth[i][0], 1e-6 );
+        ASSERT_NEAR( solutions[i][1], truth[i][1], 1e-6 );
+    }
+}
+
+/****************************************/
+/*      Mismatched batch sizes throw    */
+/****************************************/
+TEST( LM_Batch, size_mismatch )
+{
+    Test_Decay_Model model;
+
+    std::vector<Test_Decay_Model::domain_type> truth, seeds;
+    std::vector<Test_Decay_Model::result_type> observations;
+    build_batch( 10, truth, seeds, observations );
+
+    std::vector<Test_Decay_Model::domain_type> solutions( seeds.size() );
+    std::vector<tmx::optimize::LM_Batch_Result> results( seeds.size() - 1 );
+    ASSERT_THROW( tmx::optimize::levenberg_marquardt_batch( model, seeds, observations, solutions, results ),
+                  std::runtime_error );
+}
@@ -0,0 +1,175 @@
+/**
+ * @file    TEST_LM_Covariance.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+#include <terminus/math/optimization/LM_Covariance.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Sums of decaying exponentials sampled at a few times
+*/
+struct Test_Covariance_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Covariance_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h( SAMPLES );
+        for( size_t s = 0; s < SAMPLES; s++ )
+        {
+            const double t = 0.1 * s;
+            h[s] = 0;
+            for( size_t i = 0; i + 1 < x.size(); i += 2 )
+            {
+                h[s] += x[i] * std::exp( -x[i + 1] * t ) + 0.01 * i * t;
+            }
+        }
+        return h;
+    }
+
+    static constexpr size_t SAMPLES = 30;
+}; // End of Test_Covariance_Model class
+
+/**
+ * Solve with a kept factorization, returning the reference covariance ( J^T J )^-1
+ */
+tmx::MatrixN<double> covariance_fit( const Test_Covariance_Model&                        model,
+                                     tmx::optimize::LM_Workspace<Test_Covariance_Model>& workspace )
+{
+    tmx::VectorN<double> truth( { 2.0, 1.0, -1.0, 3.0, 0.5, 0.2 } );
+    tmx::VectorN<double> seed( { 1.5, 1.5, -0.5, 2.5, 1.0, 0.5 } );
+    auto target = model( truth );
+    for( size_t s = 0; s < target.size(); s++ )
+    {
+        target[s] += 0.01 * std::sin( 7.0 * s );
+    }
+
+    workspace.set_keep_factorization( true );
+    tmx::optimize::LM_STATUS_CODE status;
+    auto result = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    EXPECT_FALSE( result.has_error() );
+
+    auto J = model.jacobian( result.value() );
+    tmx::MatrixN<double> JtJ( J.cols(), J.cols() );
+    for( size_t a = 0; a < J.cols(); a++ )
+    {
+        for( size_t b = 0; b < J.cols(); b++ )
+        {
+            for( size_t r = 0; r < J.rows(); r++ )
+            {
+                JtJ( a, b ) += J( r, a ) * J( r, b );
+            }
+        }
+    }
+
+    // Columns of the inverse, by LU
+    tmx::MatrixN<double> inverse( J.cols(), J.cols() );
+    for( size_t c = 0; c < J.cols(); c++ )
+    {
+        tmx::VectorN<double> unit( J.cols() );
+        unit[c] = 1;
+        auto column = tmx::linalg::solve( JtJ, unit );
+        EXPECT_FALSE( column.has_error() );
+        for( size_t r = 0; r < J.cols(); r++ )
+        {
+            inverse( r, c ) = column.value()[r];
+        }
+    }
+    return inverse;
+}
+
+/****************************************************************/
+/*      Covariance from the kept factor matches the inverse     */
+/****************************************************************/
+TEST( LM_Covariance, full_and_marginal )
+{
+    Test_Covariance_Model model;
+    tmx::optimize::LM_Workspace<Test_Covariance_Model> workspace;
+    auto expected = covariance_fit( model, workspace );
+    ASSERT_TRUE( workspace.normal_factor_valid() );
+
+    const double variance = tmx::optimize::residual_variance( workspace );
+    ASSERT_GT( variance, 0 );
+
+    tmx::parallel::Thread_Pool pool( 4 );
+    auto full  = tmx::optimize::covariance( workspace, variance, pool );
+    auto sigma = tmx::optimize::marginal_standard_deviations( workspace, variance, pool );
+    ASSERT_FALSE( full.has_error() );
+    ASSERT_FALSE( sigma.has_error() );
+
+    const size_t n = expected.rows();
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            ASSERT_NEAR( full.value()( r, c ), variance * expected( r, c ),
+                         1e-8 * variance * std::fabs( expected( r, r ) ) );
+        }
+        ASSERT_NEAR( sigma.value()[r], std::sqrt( variance * expected( r, r ) ),
+                     1e-8 * sigma.value()[r] );
+    }
+}
+
+/****************************************************************/
+/*      Blocks match the same entries of the full covariance    */
+/****************************************************************/
+TEST( LM_Covariance, blocks )
+{
+    Test_Covariance_Model model;
+    tmx::optimize::LM_Workspace<Test_Covariance_Model> workspace;
+    auto expected = covariance_fit( model, workspace );
+
+    std::vector<tmx::optimize::Covariance_Block> blocks = { { 0, 2 }, { 2, 2 }, { 1, 4 }, { 5, 1 }, { 3, 0 } };
+    auto result = tmx::optimize::covariance_blocks( workspace,
+                                                    std::span<const tmx::optimize::Covariance_Block>( blocks ) );
+    ASSERT_FALSE( result.has_error() );
+    ASSERT_EQ( result.value().size(), blocks.size() );
+    for( size_t b = 0; b < blocks.size(); b++ )
+    {
+        const auto& cov = result.value()[b];
+        ASSERT_EQ( cov.rows(), blocks[b].size );
+        for( size_t r = 0; r < blocks[b].size; r++ )
+        {
+            for( size_t c = 0; c < blocks[b].size; c++ )
+            {
+                const double value = expected( blocks[b].begin + r, blocks[b].begin + c );
+                ASSERT_NEAR( cov( r, c ), value, 1e-8 * std::fabs( expected( blocks[b].begin + r, blocks[b].begin + r ) ) );
+            }
+        }
+    }
+
+    // Blocks past the parameters are rejected
+    blocks.push_back( { 4, 3 } );
+    ASSERT_THROW( tmx::optimize::covariance_blocks( workspace,
+                                                    std::span<const tmx::optimize::Covariance_Block>( blocks ) ),
+                  std::out_of_range );
+}
+
+/****************************************************************/
+/*      Without a kept factorization, queries fail              */
+/****************************************************************/
+TEST( LM_Covariance, not_kept )
+{
+    Test_Covariance_Model model;
+    tmx::optimize::LM_Workspace<Test_Covariance_Model> workspace;
+    tmx::VectorN<double> seed( { 1.5, 1.5, -0.5, 2.5, 1.0, 0.5 } );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto result = tmx::optimize::levenberg_marquardt( model, seed, model( seed ), workspace, status );
+    ASSERT_FALSE( result.has_error() );
+    ASSERT_FALSE( workspace.normal_factor_valid() );
+    ASSERT_TRUE( tmx::optimize::covariance( workspace ).has_error() );
+    ASSERT_TRUE( tmx::optimize::marginal_standard_deviations( workspace ).has_error() );
+}
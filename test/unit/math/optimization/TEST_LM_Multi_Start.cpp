@@ -0,0 +1,306 @@
+/**
+ * @file    TEST_LM_Multi_Start.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/LM_Multi_Start.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Non-convex model with several local minima
+*/
+struct Test_Multi_Start_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Multi_Start_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        tmx::VectorN<double> h( 5 );
+        h[0] = std::sin( x[0] + 0.1 );
+        h[1] = std::cos( x[1] * x[2] );
+        h[2] = x[1] * std::cos( x[2] );
+        h[3] = std::atan2( x[0], x[3] );
+        h[4] = std::atan2( x[2], x[1] );
+        return h;
+    }
+}; // End of Test_Multi_Start_Model class
+
+/**
+ * Model with a minimum at x = [4, 3] for the target [2, 3], whose residuals are all
+ * NaN for x[0] < 0.  A start there takes NaN steps and never leaves.
+*/
+struct Test_Sqrt_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Sqrt_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        if( !( x[0] >= 0 ) )
+        {
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            return tmx::VectorN<double>( { nan, nan } );
+        }
+        return tmx::VectorN<double>( { std::sqrt( x[0] ), x[1] } );
+    }
+
+    void jacobian( domain_type const& x, jacobian_type& J ) const
+    {
+        J( 0, 0 ) = x[0] > 0 ? 0.5 / std::sqrt( x[0] ) : 1;
+        J( 0, 1 ) = 0;
+        J( 1, 0 ) = 0;
+        J( 1, 1 ) = 1;
+    }
+}; // End of Test_Sqrt_Model class
+
+/**
+ * Inconsistent linear model, whose best residual norm is 1 at x = [0.5, 0.5].  Every
+ * trial step of the third outer iteration lands on a huge residual, so that iteration
+ * short-circuits.  Counts calls, so only for serial use.
+*/
+struct Test_Stall_Once_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Stall_Once_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        if( jacobians == STALL_ITERATION && poisoned <= tmx::optimize::detail::LM_MAX_INNER_ITERATIONS )
+        {
+            poisoned++;
+            return tmx::VectorN<double>( { 1e6, 1e6, 1e6, 1e6 } );
+        }
+        return tmx::VectorN<double>( { x[0], x[0], x[1], x[1] } );
+    }
+
+    void jacobian( [[maybe_unused]] domain_type const& x, jacobian_type& J ) const
+    {
+        jacobians++;
+        for( size_t r = 0; r < 4; r++ )
+        {
+            J( r, 0 ) = r < 2 ? 1 : 0;
+            J( r, 1 ) = r < 2 ? 0 : 1;
+        }
+    }
+
+    static constexpr int STALL_ITERATION = 3;
+    mutable int jacobians { 0 };
+    mutable int poisoned { 0 };
+}; // End of Test_Stall_Once_Model class
+
+/**
+ * Seeds spread over a box
+ */
+std::vector<tmx::VectorN<double>> multi_start_seeds()
+{
+    std::vector<tmx::VectorN<double>> seeds;
+    for( int i = 0; i < 16; i++ )
+    {
+        seeds.push_back( tmx::VectorN<double>( { -3.0 + 0.4 * i,
+                                                 2.0 * std::cos( i ),
+                                                 -2.0 + 0.25 * i,
+                                                 1.5 * std::sin( 2 * i ) } ) );
+    }
+    return seeds;
+}
+
+/**
+ * Residual norm of a solution
+ */
+double multi_start_norm( const Test_Multi_Start_Model& model,
+                         const tmx::VectorN<double>&   target,
+                         const tmx::VectorN<double>&   x )
+{
+    return tmx::VectorN<double>( target - model( x ) ).magnitude();
+}
+
+/****************************************************************/
+/*      Without cancellation, matches the best serial start     */
+/****************************************************************/
+TEST( LM_Multi_Start, matches_serial )
+{
+    Test_Multi_Start_Model model;
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    auto seeds = multi_start_seeds();
+
+    double best_serial = std::numeric_limits<double>::infinity();
+    for( const auto& seed : seeds )
+    {
+        tmx::optimize::LM_STATUS_CODE status;
+        auto result = tmx::optimize::levenberg_marquardt( model, seed, target, status );
+        ASSERT_FALSE( result.has_error() );
+        best_serial = std::min( best_serial, multi_start_norm( model, target, result.value() ) );
+    }
+
+    tmx::optimize::LM_Multi_Start_Options options;
+    options.cancel_ratio = std::numeric_limits<double>::infinity();
+    std::vector<tmx::optimize::LM_Start_Result> results( seeds.size() );
+    tmx::parallel::Thread_Pool pool( 4 );
+    auto best = tmx::optimize::levenberg_marquardt_multi_start( model,
+                                                                std::span<const tmx::VectorN<double>>( seeds ),
+                                                                target,
+                                                                std::span<tmx::optimize::LM_Start_Result>( results ),
+                                                                options,
+                                                                MATH_LM_ABS_TOL,
+                                                                MATH_LM_REL_TOL,
+                                                                MATH_LM_MAX_ITER,
+                                                                pool );
+    ASSERT_FALSE( best.has_error() );
+    ASSERT_EQ( multi_start_norm( model, target, best.value() ), best_serial );
+    for( const auto& result : results )
+    {
+        ASSERT_NE( result.status, tmx::optimize::LM_STATUS_CODE::ERROR_CANCELLED );
+        ASSERT_GT( result.iterations, 0 );
+        ASSERT_GE( result.final_norm, best_serial );
+    }
+}
+
+/****************************************************************/
+/*      Starts which cannot catch the incumbent are cancelled   */
+/****************************************************************/
+TEST( LM_Multi_Start, cancels_poor_starts )
+{
+    Test_Multi_Start_Model model;
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+
+    // Lead with the best converged start, so every later one competes against it
+    auto seeds = multi_start_seeds();
+    tmx::VectorN<double> leader;
+    for( const auto& seed : seeds )
+    {
+        tmx::optimize::LM_STATUS_CODE status;
+        auto result = tmx::optimize::levenberg_marquardt( model, seed, target, status );
+        ASSERT_FALSE( result.has_error() );
+        if( leader.size() == 0 ||
+            multi_start_norm( model, target, result.value() ) < multi_start_norm( model, target, leader ) )
+        {
+            leader = result.value();
+        }
+    }
+    seeds.insert( seeds.begin(), leader );
+
+    std::vector<tmx::optimize::LM_Start_Result> results( seeds.size() );
+    tmx::parallel::Thread_Pool pool( 1 );
+    auto best = tmx::optimize::levenberg_marquardt_multi_start( model,
+                                                                std::span<const tmx::VectorN<double>>( seeds ),
+                                                                target,
+                                                                std::span<tmx::optimize::LM_Start_Result>( results ),
+                                                                tmx::optimize::LM_Multi_Start_Options(),
+                                                                MATH_LM_ABS_TOL,
+                                                                MATH_LM_REL_TOL,
+                                                                MATH_LM_MAX_ITER,
+                                                                pool );
+    ASSERT_FALSE( best.has_error() );
+
+    int cancelled = 0;
+    for( const auto& result : results )
+    {
+        if( result.status == tmx::optimize::LM_STATUS_CODE::ERROR_CANCELLED )
+        {
+            cancelled++;
+            ASSERT_EQ( result.iterations, 3 );
+            ASSERT_GT( result.final_norm, 2 * results[0].final_norm );
+        }
+        ASSERT_GE( result.final_norm, results[0].final_norm );
+    }
+    ASSERT_GT( cancelled, 0 );
+    ASSERT_EQ( multi_start_norm( model, target, best.value() ), results[0].final_norm );
+}
+
+/****************************************************************/
+/*      A start is judged by its norm, not a rejected trial     */
+/****************************************************************/
+TEST( LM_Multi_Start, stalled_start_not_cancelled )
+{
+    Test_Stall_Once_Model model;
+    tmx::VectorN<double> target( { 0, 1, 0, 1 } );
+    std::vector<tmx::VectorN<double>> seeds( 1, tmx::VectorN<double>( { 3.0, -2.0 } ) );
+
+    std::vector<tmx::optimize::LM_Start_Result> results( seeds.size() );
+    tmx::parallel::Thread_Pool pool( 1 );
+    auto best = tmx::optimize::levenberg_marquardt_multi_start( model,
+                                                                std::span<const tmx::VectorN<double>>( seeds ),
+                                                                target,
+                                                                std::span<tmx::optimize::LM_Start_Result>( results ),
+                                                                tmx::optimize::LM_Multi_Start_Options(),
+                                                                MATH_LM_ABS_TOL,
+                                                                MATH_LM_REL_TOL,
+                                                                MATH_LM_MAX_ITER,
+                                                                pool );
+    ASSERT_FALSE( best.has_error() );
+
+    // The third iteration stalled on every trial, and the start carried on past it
+    ASSERT_EQ( model.poisoned, tmx::optimize::detail::LM_MAX_INNER_ITERATIONS + 1 );
+    ASSERT_NE( results[0].status, tmx::optimize::LM_STATUS_CODE::ERROR_CANCELLED );
+    ASSERT_GT( results[0].iterations, Test_Stall_Once_Model::STALL_ITERATION );
+    ASSERT_NEAR( results[0].final_norm, 1, 1e-9 );
+    ASSERT_NEAR( best.value()[0], 0.5, 1e-6 );
+    ASSERT_NEAR( best.value()[1], 0.5, 1e-6 );
+}
+
+/****************************************************************/
+/*          Starts with a non-finite residual never win         */
+/****************************************************************/
+TEST( LM_Multi_Start, non_finite_starts_skipped )
+{
+    Test_Sqrt_Model model;
+    tmx::VectorN<double> target( { 2, 3 } );
+
+    // The first seed is outside the domain, so its residual is NaN throughout
+    std::vector<tmx::VectorN<double>> seeds( { tmx::VectorN<double>( { -1.0, 0.0 } ),
+                                               tmx::VectorN<double>( {  1.0, 1.0 } ) } );
+    std::vector<tmx::optimize::LM_Start_Result> results( seeds.size() );
+    auto best = tmx::optimize::levenberg_marquardt_multi_start( model,
+                                                                std::span<const tmx::VectorN<double>>( seeds ),
+                                                                target,
+                                                                std::span<tmx::optimize::LM_Start_Result>( results ) );
+    ASSERT_FALSE( best.has_error() );
+    ASSERT_FALSE( std::isfinite( results[0].final_norm ) );
+    ASSERT_NEAR( best.value()[0], 4, 1e-6 );
+    ASSERT_NEAR( best.value()[1], 3, 1e-6 );
+
+    // With no finite start left, there is nothing to return
+    seeds[1] = tmx::VectorN<double>( { -2.0, 1.0 } );
+    best = tmx::optimize::levenberg_marquardt_multi_start( model,
+                                                           std::span<const tmx::VectorN<double>>( seeds ),
+                                                           target,
+                                                           std::span<tmx::optimize::LM_Start_Result>( results ) );
+    ASSERT_TRUE( best.has_error() );
+}
+
+/****************************************************************/
+/*              Bad inputs are reported                         */
+/****************************************************************/
+TEST( LM_Multi_Start, invalid_input )
+{
+    Test_Multi_Start_Model model;
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    std::vector<tmx::VectorN<double>> seeds;
+    std::vector<tmx::optimize::LM_Start_Result> results;
+
+    auto best = tmx::optimize::levenberg_marquardt_multi_start( model,
+                                                                std::span<const tmx::VectorN<double>>( seeds ),
+                                                                target,
+                                                                std::span<tmx::optimize::LM_Start_Result>( results ) );
+    ASSERT_TRUE( best.has_error() );
+
+    seeds = multi_start_seeds();
+    ASSERT_THROW( tmx::optimize::levenberg_marquardt_multi_start( model,
+                                                                  std::span<const tmx::VectorN<double>>( seeds ),
+                                                                  target,
+                                                                  std::span<tmx::optimize::LM_Start_Result>( results ) ),
+                  std::runtime_error );
+}
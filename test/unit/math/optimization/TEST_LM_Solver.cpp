@@ -0,0 +1,123 @@
+/**
+ * @file    TEST_LM_Solver.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/LM_Solver.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Ranges from a moving 3D position to fixed beacons
+*/
+struct Test_Range_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Range_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    Test_Range_Model()
+    {
+        for( size_t i = 0; i < 6; i++ )
+        {
+            m_beacons.push_back( tmx::VectorN<double>( { 10.0 * std::cos( i ), 10.0 * std::sin( i ), 2.0 * i - 5.0 } ) );
+        }
+    }
+
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h( m_beacons.size() );
+        for( size_t i = 0; i < m_beacons.size(); i++ )
+        {
+            h[i] = tmx::VectorN<double>( x - m_beacons[i] ).magnitude();
+        }
+        return h;
+    }
+
+    std::vector<tmx::VectorN<double>> m_beacons;
+}; // End of Test_Range_Model class
+
+/**
+ * Target position at a frame
+ */
+tmx::VectorN<double> track_position( size_t frame )
+{
+    const double t = 0.01 * frame;
+    return tmx::VectorN<double>( { 1.0 + t, 2.0 * std::sin( t ), 0.5 - t * t } );
+}
+
+/****************************************************************/
+/*      Warm starts match cold solves in fewer iterations       */
+/****************************************************************/
+TEST( LM_Solver, warm_start_tracking )
+{
+    Test_Range_Model model;
+    tmx::optimize::LM_Solver<Test_Range_Model> solver( model, false, 1e-12, 1e-10 );
+
+    auto previous = tmx::VectorN<double>( { 0.0, 0.0, 0.0 } );
+    int cold_iterations = 0;
+    int warm_iterations = 0;
+    for( size_t frame = 0; frame < 50; frame++ )
+    {
+        auto observation = model( track_position( frame ) );
+
+        tmx::optimize::LM_Workspace<Test_Range_Model> workspace;
+        tmx::optimize::LM_STATUS_CODE status;
+        auto cold = tmx::optimize::levenberg_marquardt( model, previous, observation, workspace, status, 1e-12, 1e-10 );
+        ASSERT_FALSE( cold.has_error() );
+        cold_iterations += workspace.iterations();
+
+        auto warm = ( frame == 0 ) ? solver.solve( previous, observation ) : solver.solve( observation );
+        ASSERT_FALSE( warm.has_error() );
+        ASSERT_NE( solver.status(), tmx::optimize::LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE );
+        warm_iterations += solver.iterations();
+
+        for( size_t i = 0; i < 3; i++ )
+        {
+            ASSERT_NEAR( warm.value()[i], track_position( frame )[i], 1e-6 );
+        }
+        previous = cold.value();
+    }
+    ASSERT_LT( warm_iterations, cold_iterations );
+}
+
+/****************************************************************/
+/*          Reusing the last Jacobian saves evaluations         */
+/****************************************************************/
+TEST( LM_Solver, reuse_jacobian )
+{
+    Test_Range_Model model;
+    tmx::optimize::LM_Solver<Test_Range_Model> solver( model, true, 1e-12, 1e-10 );
+
+    ASSERT_FALSE( solver.has_solution() );
+    ASSERT_TRUE( solver.solve( model( track_position( 0 ) ) ).has_error() );
+
+    int reused = 0;
+    auto seed = tmx::VectorN<double>( { 0.0, 0.0, 0.0 } );
+    for( size_t frame = 0; frame < 20; frame++ )
+    {
+        auto result = ( frame == 0 ) ? solver.solve( seed, model( track_position( frame ) ) )
+                                     : solver.solve( model( track_position( frame ) ) );
+        ASSERT_FALSE( result.has_error() );
+        for( size_t i = 0; i < 3; i++ )
+        {
+            ASSERT_NEAR( result.value()[i], track_position( frame )[i], 1e-6 );
+        }
+        reused += solver.workspace().jacobian_statistics().reused;
+    }
+    ASSERT_EQ( reused, 19 );
+
+    // After a reset the next solve starts cold
+    solver.reset();
+    ASSERT_FALSE( solver.has_solution() );
+    auto result = solver.solve( seed, model( track_position( 0 ) ) );
+    ASSERT_FALSE( result.has_error() );
+    ASSERT_EQ( solver.workspace().jacobian_statistics().reused, 0 );
+}
@@ -0,0 +1,83 @@
+/**
+ * @file    TEST_LM_Step_Control.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/LM_Step_Control.hpp>
+
+namespace tmx = tmns::math;
+
+using tmx::optimize::LM_STATUS_CODE;
+
+/****************************************************************/
+/*      Rejected steps raise the damping, accepted ones lower   */
+/****************************************************************/
+TEST( LM_Step_Control, accept_and_reject )
+{
+    tmx::optimize::detail::LM_Step_Control control( 10, 1e-6, 1e-3, 100, nullptr );
+    LM_STATUS_CODE status = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
+    ASSERT_FALSE( control.converged_at_start( status ) );
+
+    control.start_iteration();
+    ASSERT_TRUE( control.searching() );
+    control.record_trial( 12 );
+    ASSERT_TRUE( control.searching() );
+    ASSERT_NEAR( control.lambda(), 1, 1e-12 );
+    control.record_failed_solve();
+    ASSERT_NEAR( control.lambda(), 10, 1e-12 );
+    control.record_trial( 8 );
+    ASSERT_FALSE( control.searching() );
+    ASSERT_EQ( control.inner_iterations(), 3 );
+    ASSERT_TRUE( control.accepted() );
+    ASSERT_NEAR( control.progress(), 0.2, 1e-12 );
+    ASSERT_FALSE( control.check_convergence( status ) );
+
+    control.finish_iteration();
+    ASSERT_EQ( control.norm_start(), 8 );
+    ASSERT_NEAR( control.lambda(), 1, 1e-12 );
+
+    // A tiny improvement meets the relative tolerance, unless the caller defers it
+    control.start_iteration();
+    control.record_trial( 7.9999 );
+    ASSERT_FALSE( control.check_convergence( status, false ) );
+    ASSERT_TRUE( control.check_convergence( status ) );
+    ASSERT_EQ( status, LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE );
+}
+
+/****************************************************************/
+/*      Too many rejected steps abandon the outer iteration     */
+/****************************************************************/
+TEST( LM_Step_Control, short_circuit )
+{
+    tmx::optimize::detail::LM_Step_Control control( 5, 1e-6, 1e-3, 2, nullptr );
+    LM_STATUS_CODE status = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
+
+    control.start_iteration( 4 );
+    int solves = 0;
+    while( control.searching() )
+    {
+        control.record_trial( 6 + solves++ );
+    }
+    ASSERT_EQ( solves, tmx::optimize::detail::LM_MAX_INNER_ITERATIONS + 1 );
+    ASSERT_FALSE( control.accepted() );
+    ASSERT_EQ( control.norm_try(), 4 );
+    ASSERT_EQ( control.last_trial(), 11 );
+    ASSERT_EQ( control.progress(), 0 );
+
+    // No relative convergence without a step, but the iteration limit still applies
+    ASSERT_FALSE( control.check_convergence( status ) );
+    control.finish_iteration();
+    ASSERT_EQ( control.norm_start(), 4 );
+    control.start_iteration();
+    control.record_trial( 1e-7 );
+    ASSERT_TRUE( control.check_convergence( status ) );
+    ASSERT_EQ( status, LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE );
+    ASSERT_EQ( control.outer_iterations(), 2 );
+
+    // A seed already within tolerance
+    tmx::optimize::detail::LM_Step_Control done( 1e-8, 1e-6, 1e-3, 10, "test" );
+    ASSERT_TRUE( done.converged_at_start( status ) );
+}
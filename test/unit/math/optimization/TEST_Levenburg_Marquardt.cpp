@@ -10,6 +10,16 @@
 #include <terminus/math/optimization/Levenburg_Marquardt.hpp>
 #include <terminus/math/vector/Sub_Vector.hpp>
 
+// C++ Libraries
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+// Test Utilities
+#include "../../utility/Allocation_Counter.hpp"
+
 namespace tmx = tmns::math;
 
 /**
@@ -100,4 +110,535 @@ TEST( Levenberg_Marquardt, levenberg_marquardt )
     ASSERT_EQ( tmx::optimize::LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE, status );
     
     EXPECT_NEAR( tmx::VectorN<double>( expected_best - best.value() ).magnitude(), 0, 1e-5 );
-}
\ No newline at end of file
+}
+
+/**
+ * Set the solver log level for the life of a test.  Allocation counts are taken with
+ * logging off, since the logger may allocate to format.
+ */
+struct Scoped_LM_Log_Level
+{
+    explicit Scoped_LM_Log_Level( tmx::optimize::LM_Log_Level level )
+      : m_previous( tmx::optimize::lm_log_level() )
+    {
+        tmx::optimize::set_lm_log_level( level );
+    }
+
+    ~Scoped_LM_Log_Level()
+    {
+        tmx::optimize::set_lm_log_level( m_previous );
+    }
+
+    tmx::optimize::LM_Log_Level m_previous;
+}; // End of Scoped_LM_Log_Level struct
+
+/********************************************************/
+/*      Verify an LM iteration stays off the heap       */
+/********************************************************/
+TEST( Levenberg_Marquardt, iteration_allocations )
+{
+    Test_Least_Squares_Model model;
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    tmx::VectorN<double> seed( { 1.0, 1.0, 1.0, 1.0 } );
+    Scoped_LM_Log_Level quiet( tmx::optimize::LM_Log_Level::NONE );
+
+    // The observer runs after every outer iteration, so the counts between its calls
+    // are the allocations of one full iteration of the real solver
+    std::array<size_t,MATH_LM_MAX_ITER> counts {};
+    size_t num_calls = 0;
+    tmx::optimize::LM_Workspace<Test_Least_Squares_Model> workspace;
+    workspace.set_observer( [&]( const tmx::optimize::LM_Iteration_Info& )
+    {
+        if( num_calls < counts.size() )
+        {
+            counts[num_calls++] = tmns::test::allocation_count();
+        }
+    } );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto result = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( result.has_error() );
+    ASSERT_GE( num_calls, 3 );
+    for( size_t i = 1; i < num_calls; i++ )
+    {
+        ASSERT_EQ( counts[i] - counts[i - 1], 0 ) << "Outer iteration " << i + 1;
+    }
+}
+
+/**
+ * Larger model which evaluates into caller-provided storage
+*/
+struct Test_In_Place_Model : public tmx::optimize::Least_Squares_Model_Base<Test_In_Place_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    static constexpr size_t NUM_SAMPLES = 40;
+
+    /// Evaluate h(x) = a * exp( -b * t ) + c at each sample
+    void operator()( domain_type const& x,
+                     result_type&       h ) const
+    {
+        h.set_size( NUM_SAMPLES );
+        for( size_t i = 0; i < NUM_SAMPLES; i++ )
+        {
+            double t = i * 0.1;
+            h[i] = x[0] * std::exp( -x[1] * t ) + x[2];
+        }
+    }
+
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h;
+        (*this)( x, h );
+        return h;
+    }
+}; // End of Test_In_Place_Model class
+
+/****************************************************************/
+/*      Verify a warm workspace makes the solver allocation-free    */
+/****************************************************************/
+TEST( Levenberg_Marquardt, workspace_allocations )
+{
+    Test_Least_Squares_Model model;
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    tmx::VectorN<double> seed( { 1.0, 1.0, 1.0, 1.0 } );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto expected = tmx::optimize::levenberg_marquardt( model, seed, target, status );
+    ASSERT_FALSE( expected.has_error() );
+
+    // First solve sizes the workspace
+    tmx::optimize::LM_Workspace<Test_Least_Squares_Model> workspace;
+    auto first = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( first.has_error() );
+    ASSERT_EQ( workspace.num_params(), 4 );
+    ASSERT_EQ( workspace.num_residuals(), 5 );
+
+    // Second solve reuses it
+    Scoped_LM_Log_Level quiet( tmx::optimize::LM_Log_Level::NONE );
+    tmns::test::Allocation_Counter counter;
+    auto second = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_EQ( counter.count(), 0 );
+
+    ASSERT_FALSE( second.has_error() );
+    ASSERT_EQ( tmx::optimize::LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE, status );
+    for( size_t i = 0; i < seed.size(); i++ )
+    {
+        EXPECT_DOUBLE_EQ( expected.value()[i], second.value()[i] );
+    }
+}
+
+/********************************************************************/
+/*      Verify large problems stay off the heap with a workspace    */
+/********************************************************************/
+TEST( Levenberg_Marquardt, workspace_in_place_model )
+{
+    Test_In_Place_Model model;
+    tmx::VectorN<double> truth( { 2.0, 0.7, 0.5 } );
+    auto target = model( truth );
+    tmx::VectorN<double> seed( { 1.0, 1.0, 0.0 } );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    tmx::optimize::LM_Workspace<Test_In_Place_Model> workspace( seed.size(), target.size() );
+    auto first = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( first.has_error() );
+
+    // Residuals exceed the inline capacity, so without the workspace these would hit the heap
+    Scoped_LM_Log_Level quiet( tmx::optimize::LM_Log_Level::NONE );
+    tmns::test::Allocation_Counter counter;
+    auto second = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    size_t allocations = counter.count();
+
+    ASSERT_FALSE( second.has_error() );
+    ASSERT_EQ( allocations, 0 );
+    for( size_t i = 0; i < truth.size(); i++ )
+    {
+        EXPECT_NEAR( truth[i], second.value()[i], 1e-6 );
+    }
+}
+
+/****************************************************************/
+/*      Test central and adaptive-step numerical Jacobians      */
+/****************************************************************/
+TEST( Levenberg_Marquardt, jacobian_difference_methods )
+{
+    Test_Least_Squares_Model model;
+    tmx::VectorN<double> x( { 0.2, 0.3, 0.4, 0.5 } );
+
+    // Exact values of a few entries
+    auto exact = [&]( const tmx::MatrixN<double>& J )
+    {
+        double err = std::fabs( J( 0, 0 ) - std::cos( x[0] + 0.1 ) );
+        err = std::max( err, std::fabs( J( 1, 1 ) + x[2] * std::sin( x[1] * x[2] ) ) );
+        err = std::max( err, std::fabs( J( 2, 2 ) + x[1] * std::sin( x[2] ) ) );
+        err = std::max( err, std::fabs( J( 3, 0 ) - x[3] / ( x[0] * x[0] + x[3] * x[3] ) ) );
+        return err;
+    };
+
+    double forward_error = exact( model.jacobian( x ) );
+
+    tmx::optimize::Numeric_Jacobian_Options options;
+    options.difference = tmx::optimize::Difference_Method::CENTRAL;
+    model.set_jacobian_options( options );
+    double central_error = exact( model.jacobian( x ) );
+
+    options.step = tmx::optimize::Step_Method::ADAPTIVE;
+    model.set_jacobian_options( options );
+    double adaptive_error = exact( model.jacobian( x ) );
+
+    EXPECT_LT( central_error, forward_error );
+    EXPECT_LT( central_error, 1e-9 );
+    EXPECT_LT( adaptive_error, 1e-9 );
+
+    options.difference = tmx::optimize::Difference_Method::FORWARD;
+    model.set_jacobian_options( options );
+    EXPECT_LT( exact( model.jacobian( x ) ), 1e-6 );
+}
+
+/****************************************************************/
+/*      Test the per-iteration observer and log level           */
+/****************************************************************/
+TEST( Levenberg_Marquardt, iteration_observer )
+{
+    Test_In_Place_Model model;
+    tmx::VectorN<double> truth( { 2.0, 0.7, 0.5 } );
+    auto target = model( truth );
+    tmx::VectorN<double> seed( { 1.0, 1.0, 0.0 } );
+
+    std::vector<tmx::optimize::LM_Iteration_Info> infos;
+    infos.reserve( MATH_LM_MAX_ITER );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    tmx::optimize::LM_Workspace<Test_In_Place_Model> workspace( seed.size(), target.size() );
+    workspace.set_observer( [&]( const tmx::optimize::LM_Iteration_Info& info )
+    {
+        infos.push_back( info );
+    } );
+
+    // By default the logger's own level decides.  Observing with logging off stays
+    // off the heap.
+    ASSERT_EQ( tmx::optimize::lm_log_level(), tmx::optimize::LM_Log_Level::TRACE );
+    Scoped_LM_Log_Level quiet( tmx::optimize::LM_Log_Level::NONE );
+    tmns::test::Allocation_Counter counter;
+    auto best = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_EQ( counter.count(), 0 );
+    ASSERT_FALSE( best.has_error() );
+
+    ASSERT_EQ( infos.size(), workspace.iterations() );
+    double previous = std::numeric_limits<double>::max();
+    for( size_t i = 0; i < infos.size(); i++ )
+    {
+        ASSERT_EQ( infos[i].iteration, i + 1 );
+        ASSERT_GE( infos[i].inner_iterations, 1 );
+        ASSERT_GT( infos[i].lambda, 0 );
+        ASSERT_LE( infos[i].norm_start, previous );
+        if( infos[i].accepted )
+        {
+            ASSERT_LE( infos[i].norm_try, infos[i].norm_start );
+        }
+        ASSERT_GT( infos[i].jacobian_time.count(), 0 );
+        ASSERT_GT( infos[i].model_time.count(), 0 );
+        ASSERT_GT( infos[i].solve_time.count(), 0 );
+        previous = infos[i].norm_start;
+    }
+
+    // Logging does not change the answer
+    Scoped_LM_Log_Level verbose( tmx::optimize::LM_Log_Level::TRACE );
+    workspace.set_observer( {} );
+    auto logged = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( logged.has_error() );
+    for( size_t i = 0; i < seed.size(); i++ )
+    {
+        ASSERT_EQ( best.value()[i], logged.value()[i] );
+    }
+}
+
+/****************************************************************/
+/*      Broyden updates keep J^T J consistent with J            */
+/****************************************************************/
+TEST( Levenberg_Marquardt, broyden_update )
+{
+    tmx::MatrixN<double> J( 4, 2 );
+    for( size_t r = 0; r < 4; r++ )
+    {
+        J( r, 0 ) = 1.0 + r;
+        J( r, 1 ) = std::sin( 0.3 * r );
+    }
+    tmx::MatrixN<double> H( 2, 2 );
+    for( size_t a = 0; a < 2; a++ )
+    {
+        for( size_t b = 0; b < 2; b++ )
+        {
+            for( size_t r = 0; r < 4; r++ )
+            {
+                H( a, b ) += 10 * J( r, a ) * J( r, b );
+            }
+        }
+    }
+
+    // delta_x is minus the step taken
+    tmx::VectorN<double> delta_x( { -0.1, 0.05 } );
+    tmx::VectorN<double> change( { 0.3, -0.2, 0.1, 0.4 } );
+    tmx::VectorN<double> scratch( 2 );
+    tmx::optimize::detail::broyden_update( J, H, delta_x, change, scratch, 10 );
+
+    // Secant condition:  J_new * s == y
+    tmx::VectorN<double> expected_change( { 0.3, -0.2, 0.1, 0.4 } );
+    for( size_t r = 0; r < 4; r++ )
+    {
+        ASSERT_NEAR( -J( r, 0 ) * delta_x[0] - J( r, 1 ) * delta_x[1], expected_change[r], 1e-12 );
+    }
+    for( size_t a = 0; a < 2; a++ )
+    {
+        for( size_t b = 0; b < 2; b++ )
+        {
+            double value = 0;
+            for( size_t r = 0; r < 4; r++ )
+            {
+                value += 10 * J( r, a ) * J( r, b );
+            }
+            ASSERT_NEAR( H( a, b ), value, 1e-10 );
+        }
+    }
+}
+
+/****************************************************************/
+/*      Solve with Broyden updates between recomputes           */
+/****************************************************************/
+TEST( Levenberg_Marquardt, broyden_solve )
+{
+    Test_In_Place_Model model;
+    tmx::VectorN<double> truth( { 2.0, 0.7, 0.5 } );
+    auto target = model( truth );
+    tmx::VectorN<double> seed( { 1.0, 1.0, 0.0 } );
+
+    tmx::optimize::LM_Jacobian_Update_Options options;
+    options.method           = tmx::optimize::Jacobian_Update_Method::BROYDEN;
+    options.refresh_interval = 5;
+
+    std::vector<tmx::optimize::LM_Iteration_Info> infos;
+    tmx::optimize::LM_Workspace<Test_In_Place_Model> workspace;
+    workspace.set_jacobian_update( options );
+    workspace.set_observer( [&]( const tmx::optimize::LM_Iteration_Info& info )
+    {
+        infos.push_back( info );
+    } );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto best = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( best.has_error() );
+    for( size_t i = 0; i < truth.size(); i++ )
+    {
+        EXPECT_NEAR( truth[i], best.value()[i], 1e-6 );
+    }
+
+    const auto& statistics = workspace.jacobian_statistics();
+    ASSERT_GT( statistics.broyden_updates, 0 );
+    ASSERT_EQ( statistics.recomputed + statistics.broyden_updates, workspace.iterations() );
+    ASSERT_EQ( statistics.evaluations_saved, statistics.broyden_updates * truth.size() );
+
+    // Never more than refresh_interval - 1 updates in a row
+    int run = 0;
+    int updates = 0;
+    for( const auto& info : infos )
+    {
+        run = info.broyden_update ? run + 1 : 0;
+        updates += info.broyden_update ? 1 : 0;
+        ASSERT_LT( run, options.refresh_interval );
+    }
+    ASSERT_EQ( updates, statistics.broyden_updates );
+    ASSERT_FALSE( infos.front().broyden_update );
+}
+
+/************************************************************/
+/*      Test parallel numerical Jacobian matches serial     */
+/************************************************************/
+TEST( Levenberg_Marquardt, jacobian_parallel )
+{
+    tmns::math::parallel::Thread_Pool pool( 4 );
+
+    Test_In_Place_Model model;
+    tmx::VectorN<double> x( { 2.0, 0.7, 0.5 } );
+
+    for( auto method : { tmx::optimize::Difference_Method::FORWARD,
+                         tmx::optimize::Difference_Method::CENTRAL } )
+    {
+        tmx::optimize::Numeric_Jacobian_Options options;
+        options.difference = method;
+        model.set_jacobian_options( options );
+        auto serial = model.jacobian( x );
+
+        options.parallel = true;
+        options.pool     = &pool;
+        model.set_jacobian_options( options );
+        auto threaded = model.jacobian( x );
+
+        ASSERT_EQ( serial.rows(), threaded.rows() );
+        ASSERT_EQ( serial.cols(), threaded.cols() );
+        for( size_t r = 0; r < serial.rows(); r++ )
+        {
+            for( size_t c = 0; c < serial.cols(); c++ )
+            {
+                ASSERT_EQ( serial( r, c ), threaded( r, c ) );
+            }
+        }
+    }
+
+    // Solve using the parallel central-difference Jacobian
+    auto target = model( x );
+    tmx::VectorN<double> seed( { 1.0, 1.0, 0.0 } );
+    tmx::optimize::LM_STATUS_CODE status;
+    auto best = tmx::optimize::levenberg_marquardt( model, seed, target, status );
+    ASSERT_FALSE( best.has_error() );
+    for( size_t i = 0; i < x.size(); i++ )
+    {
+        EXPECT_NEAR( x[i], best.value()[i], 1e-6 );
+    }
+}
+
+/**
+ * Fixed-size version of Test_In_Place_Model, sampled 12 times
+*/
+struct Test_Fixed_Model : public tmx::optimize::Least_Squares_Model_Base_Fixed<Test_Fixed_Model,3,12>
+{
+    using result_type   = tmx::Vector_<double,12>;
+    using domain_type   = tmx::Vector_<double,3>;
+
+    /// Evaluate h(x) = a * exp( -b * t ) + c at each sample
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h;
+        for( size_t i = 0; i < 12; i++ )
+        {
+            double t = i * 0.25;
+            h[i] = x[0] * std::exp( -x[1] * t ) + x[2];
+        }
+        return h;
+    }
+}; // End of Test_Fixed_Model class
+
+/**
+ * Test_Fixed_Model with dynamic types, for comparison
+*/
+struct Test_Dynamic_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Dynamic_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        tmx::Vector_<double,3> x_fixed( { x[0], x[1], x[2] } );
+        return result_type( Test_Fixed_Model()( x_fixed ) );
+    }
+}; // End of Test_Dynamic_Model class
+
+/****************************************************************/
+/*      Test the fixed-size solver converges off the heap       */
+/****************************************************************/
+TEST( Levenberg_Marquardt, levenberg_marquardt_fixed )
+{
+    Test_Fixed_Model model;
+    Test_Fixed_Model::domain_type truth( { 2.0, 0.7, 0.5 } );
+    Test_Fixed_Model::domain_type seed( { 1.0, 1.0, 0.0 } );
+    auto target = model( truth );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    tmns::test::Allocation_Counter counter;
+    auto best = tmx::optimize::levenberg_marquardt_fixed( model, seed, target, status );
+    ASSERT_EQ( counter.count(), 0 );
+
+    ASSERT_NE( tmx::optimize::LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE, status );
+    for( size_t i = 0; i < truth.size(); i++ )
+    {
+        EXPECT_NEAR( truth[i], best[i], 1e-6 );
+    }
+
+    // Numerical Jacobian matches the dynamic model's
+    auto J_fixed   = model.jacobian( seed );
+    auto J_dynamic = Test_Dynamic_Model().jacobian( tmx::VectorN<double>( seed ) );
+    for( size_t r = 0; r < 12; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            ASSERT_NEAR( J_fixed( r, c ), J_dynamic( r, c ), 1e-12 );
+        }
+    }
+}
+
+/****************************************************************/
+/*      The fixed-size solver agrees with the dynamic one       */
+/****************************************************************/
+TEST( Levenberg_Marquardt, fixed_matches_dynamic )
+{
+    Test_Fixed_Model fixed_model;
+    Test_Dynamic_Model dynamic_model;
+    Test_Fixed_Model::domain_type seed( { 1.0, 1.0, 0.0 } );
+    tmx::VectorN<double> dynamic_seed( seed );
+
+    tmx::optimize::LM_Workspace<Test_Dynamic_Model> workspace;
+    for( size_t i = 0; i < 20; i++ )
+    {
+        Test_Fixed_Model::domain_type truth( { 2.0 + 0.05 * i, 0.7, 0.5 } );
+        auto target = fixed_model( truth );
+
+        tmx::optimize::LM_STATUS_CODE fixed_status, dynamic_status;
+        auto fixed   = tmx::optimize::levenberg_marquardt_fixed( fixed_model, seed, target, fixed_status );
+        auto dynamic = tmx::optimize::levenberg_marquardt( dynamic_model, dynamic_seed, tmx::VectorN<double>( target ), workspace, dynamic_status );
+        ASSERT_FALSE( dynamic.has_error() );
+        ASSERT_NE( fixed_status, tmx::optimize::LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE );
+        ASSERT_NE( dynamic_status, tmx::optimize::LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE );
+        for( size_t k = 0; k < truth.size(); k++ )
+        {
+            ASSERT_NEAR( fixed[k], dynamic.value()[k], 1e-6 );
+            ASSERT_NEAR( fixed[k], truth[k], 1e-6 );
+        }
+    }
+}
+
+/****************************************************************/
+/*      Time the fixed-size solver against the dynamic one.     */
+/*      Disabled in the unit run; run it explicitly with        */
+/*      --gtest_also_run_disabled_tests                         */
+/****************************************************************/
+TEST( Levenberg_Marquardt, DISABLED_benchmark_fixed_vs_dynamic )
+{
+    const size_t num_solves = 2000;
+    Test_Fixed_Model fixed_model;
+    Test_Dynamic_Model dynamic_model;
+    Test_Fixed_Model::domain_type seed( { 1.0, 1.0, 0.0 } );
+    tmx::VectorN<double> dynamic_seed( seed );
+
+    std::vector<Test_Fixed_Model::result_type> targets;
+    for( size_t i = 0; i < num_solves; i++ )
+    {
+        targets.push_back( fixed_model( Test_Fixed_Model::domain_type( { 2.0 + 0.001 * i, 0.7, 0.5 } ) ) );
+    }
+
+    tmx::optimize::LM_STATUS_CODE status;
+    double checksum_fixed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for( const auto& target : targets )
+    {
+        checksum_fixed += tmx::optimize::levenberg_marquardt_fixed( fixed_model, seed, target, status )[0];
+    }
+    auto fixed_time = std::chrono::steady_clock::now() - start;
+
+    double checksum_dynamic = 0;
+    tmx::optimize::LM_Workspace<Test_Dynamic_Model> workspace;
+    start = std::chrono::steady_clock::now();
+    for( const auto& target : targets )
+    {
+        auto best = tmx::optimize::levenberg_marquardt( dynamic_model, dynamic_seed, tmx::VectorN<double>( target ), workspace, status );
+        checksum_dynamic += best.value()[0];
+    }
+    auto dynamic_time = std::chrono::steady_clock::now() - start;
+    EXPECT_NEAR( checksum_fixed, checksum_dynamic, 1e-6 * num_solves );
+
+    using usec = std::chrono::microseconds;
+    std::cout << "levenberg_marquardt_fixed: " << std::chrono::duration_cast<usec>( fixed_time ).count() / double( num_solves )
+              << " us/solve, levenberg_marquardt: " << std::chrono::duration_cast<usec>( dynamic_time ).count() / double( num_solves )
+              << " us/solve" << std::endl;
+}
@@ -0,0 +1,248 @@
+/**
+ * @file    TEST_Local_Parameterization.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/Levenburg_Marquardt.hpp>
+#include <terminus/math/optimization/Local_Parameterization.hpp>
+
+// C++ Libraries
+#include <cmath>
+
+namespace tmx = tmns::math;
+
+/**
+ * Rigid transform of a few points, parameters stored as a quaternion [w, x, y, z] and
+ * a translation.  The quaternion is used as given, so its scale is a gauge freedom.
+*/
+struct Test_Pose_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Pose_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        const tmx::Quaternion q( x[0], x[1], x[2], x[3] );
+        result_type h( 3 * POINTS );
+        for( size_t p = 0; p < POINTS; p++ )
+        {
+            auto point = q.normalize().rotate_vector( tmx::Vector3d( { std::cos( 1.0 * p ),
+                                                                       std::sin( 2.0 * p ),
+                                                                       0.5 * p - 1 } ) );
+            for( size_t i = 0; i < 3; i++ )
+            {
+                h[3 * p + i] = point[i] + x[4 + i];
+            }
+        }
+        return h;
+    }
+
+    static constexpr size_t POINTS = 6;
+}; // End of Test_Pose_Model class
+
+/**
+ * The same model with a Jacobian w.r.t. the stored parameters
+*/
+struct Test_Pose_Model_Analytic : public tmx::optimize::Least_Squares_Model_Base<Test_Pose_Model_Analytic>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        return Test_Pose_Model()( x );
+    }
+
+    jacobian_type jacobian( domain_type const& x ) const
+    {
+        Test_Pose_Model numeric;
+        tmx::optimize::Numeric_Jacobian_Options options;
+        options.difference = tmx::optimize::Difference_Method::CENTRAL;
+        numeric.set_jacobian_options( options );
+        return numeric.jacobian( x );
+    }
+}; // End of Test_Pose_Model_Analytic class
+
+/**
+ * Parameterization with every kind of block
+ */
+tmx::optimize::Local_Parameterization mixed_parameterization()
+{
+    tmx::optimize::Local_Parameterization parameterization;
+    parameterization.add_euclidean( 1 )
+                    .add_se3()
+                    .add_euclidean( 1 )
+                    .add_euclidean( 1 )
+                    .add_so3();
+    return parameterization;
+}
+
+/**
+ * A point on the mixed parameterization
+ */
+tmx::VectorN<double> mixed_point()
+{
+    auto q1 = tmx::quaternion_exp( tmx::Vector3d( { 0.4, -0.2, 1.1 } ) );
+    auto q2 = tmx::quaternion_exp( tmx::Vector3d( { -2.0, 0.5, 0.3 } ) );
+    return tmx::VectorN<double>( { 0.5,
+                                   q1[0], q1[1], q1[2], q1[3], 1.0, -2.0, 3.0,
+                                   -0.25, 0.75,
+                                   q2[0], q2[1], q2[2], q2[3] } );
+}
+
+/****************************************************************/
+/*          Stepping and differencing are inverses              */
+/****************************************************************/
+TEST( Local_Parameterization, plus_minus )
+{
+    auto parameterization = mixed_parameterization();
+    ASSERT_EQ( parameterization.ambient_size(), 14 );
+    ASSERT_EQ( parameterization.tangent_size(), 12 );
+
+    auto x = mixed_point();
+    tmx::VectorN<double> delta( { 0.1, 0.2, -0.3, 0.4, 1.5, -0.5, 0.25, 2.0, -1.0, 0.05, 0.6, -0.7 } );
+
+    tmx::VectorN<double> y( x.size() );
+    parameterization.plus( x, delta, 0.5, y );
+
+    // Rotations stay unit quaternions
+    ASSERT_NEAR( tmx::Quaternion( y[1], y[2], y[3], y[4] ).magnitude(), 1, 1e-14 );
+    ASSERT_NEAR( tmx::Quaternion( y[10], y[11], y[12], y[13] ).magnitude(), 1, 1e-14 );
+
+    tmx::VectorN<double> recovered( 12 );
+    parameterization.minus( y, x, recovered );
+    for( size_t i = 0; i < 12; i++ )
+    {
+        ASSERT_NEAR( recovered[i], 0.5 * delta[i], 1e-12 );
+    }
+
+    // The Euclidean blocks were merged and move by addition
+    ASSERT_NEAR( y[0], x[0] + 0.05, 1e-15 );
+    ASSERT_NEAR( y[9], x[9] + 0.5 * delta[8], 1e-15 );
+}
+
+/****************************************************************/
+/*      The derivative of plus matches finite differences       */
+/****************************************************************/
+TEST( Local_Parameterization, plus_jacobian )
+{
+    auto parameterization = mixed_parameterization();
+    auto x = mixed_point();
+
+    tmx::MatrixN<double> P;
+    parameterization.plus_jacobian( x, P );
+    ASSERT_EQ( P.rows(), 14 );
+    ASSERT_EQ( P.cols(), 12 );
+
+    const double epsilon = 1e-6;
+    tmx::VectorN<double> delta( 12 ), forward( 14 ), backward( 14 );
+    for( size_t c = 0; c < 12; c++ )
+    {
+        delta[c] = epsilon;
+        parameterization.plus( x, delta, 1, forward );
+        parameterization.plus( x, delta, -1, backward );
+        delta[c] = 0;
+        for( size_t r = 0; r < 14; r++ )
+        {
+            ASSERT_NEAR( P( r, c ), ( forward[r] - backward[r] ) / ( 2 * epsilon ), 1e-8 );
+        }
+    }
+}
+
+/****************************************************************/
+/*      Tangent Jacobians agree, numerical or converted         */
+/****************************************************************/
+TEST( Local_Parameterization, tangent_jacobian )
+{
+    tmx::optimize::Local_Parameterization parameterization;
+    parameterization.add_se3();
+
+    Test_Pose_Model numeric;
+    Test_Pose_Model_Analytic analytic;
+    numeric.set_parameterization( &parameterization );
+    analytic.set_parameterization( &parameterization );
+    ASSERT_EQ( numeric.tangent_size( tmx::VectorN<double>( 7 ) ), 6 );
+    ASSERT_EQ( numeric.jacobian_evaluations( tmx::VectorN<double>( 7 ) ), 6 );
+
+    auto q = tmx::quaternion_exp( tmx::Vector3d( { 0.2, 0.9, -0.4 } ) );
+    tmx::VectorN<double> x( { q[0], q[1], q[2], q[3], 0.1, 0.2, 0.3 } );
+    auto h0 = numeric( x );
+
+    tmx::optimize::Numeric_Jacobian_Scratch<tmx::VectorN<double>,tmx::VectorN<double>> scratch;
+    tmx::MatrixN<double> J_numeric( h0.size(), 6 ), J_analytic( h0.size(), 6 );
+    numeric.jacobian_into( x, h0, J_numeric, scratch );
+    analytic.jacobian_into( x, h0, J_analytic, scratch );
+    for( size_t r = 0; r < h0.size(); r++ )
+    {
+        for( size_t c = 0; c < 6; c++ )
+        {
+            ASSERT_NEAR( J_numeric( r, c ), J_analytic( r, c ), 1e-6 );
+        }
+    }
+
+    // Parallel tangent columns match the serial ones exactly
+    tmx::parallel::Thread_Pool pool( 4 );
+    tmx::optimize::Numeric_Jacobian_Options options;
+    options.parallel = true;
+    options.pool     = &pool;
+    numeric.set_jacobian_options( options );
+    tmx::MatrixN<double> J_parallel( h0.size(), 6 );
+    numeric.jacobian_into( x, h0, J_parallel, scratch );
+    for( size_t r = 0; r < h0.size(); r++ )
+    {
+        for( size_t c = 0; c < 6; c++ )
+        {
+            ASSERT_EQ( J_parallel( r, c ), J_numeric( r, c ) );
+        }
+    }
+
+    // Mismatched sizes are rejected
+    tmx::VectorN<double> wrong( 8 );
+    ASSERT_THROW( numeric.jacobian_into( wrong, h0, J_numeric, scratch ), std::runtime_error );
+}
+
+/****************************************************************/
+/*          Fit a rigid transform on the manifold               */
+/****************************************************************/
+TEST( Local_Parameterization, levenberg_marquardt )
+{
+    auto q_truth = tmx::quaternion_exp( tmx::Vector3d( { 0.6, -0.3, 1.4 } ) );
+    tmx::VectorN<double> truth( { q_truth[0], q_truth[1], q_truth[2], q_truth[3], 1.5, -0.5, 2.0 } );
+    tmx::VectorN<double> seed( { 1, 0, 0, 0, 0, 0, 0 } );
+
+    Test_Pose_Model model;
+    auto target = model( truth );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    tmx::optimize::LM_Workspace<Test_Pose_Model> workspace;
+    auto ambient = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( ambient.has_error() );
+    ASSERT_EQ( workspace.num_tangent(), 7 );
+
+    tmx::optimize::Local_Parameterization parameterization;
+    parameterization.add_se3();
+    model.set_parameterization( &parameterization );
+    auto result = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( result.has_error() );
+    ASSERT_EQ( workspace.num_tangent(), 6 );
+
+    // Stays a unit quaternion, with no gauge drift
+    const auto& x = result.value();
+    ASSERT_NEAR( tmx::Quaternion( x[0], x[1], x[2], x[3] ).magnitude(), 1, 1e-12 );
+    const double sign = x[0] * truth[0] < 0 ? -1 : 1;
+    for( size_t i = 0; i < 7; i++ )
+    {
+        ASSERT_NEAR( ( i < 4 ? sign : 1 ) * x[i], truth[i], 1e-6 );
+    }
+
+    // Parameterizations which do not fit the seed are rejected
+    tmx::optimize::Local_Parameterization wrong;
+    wrong.add_so3();
+    model.set_parameterization( &wrong );
+    ASSERT_TRUE( tmx::optimize::levenberg_marquardt( model, seed, target, status ).has_error() );
+}
@@ -0,0 +1,253 @@
+/**
+ * @file    TEST_Matrix_Free_Levenberg_Marquardt.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/Matrix_Free_Levenberg_Marquardt.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Chain of coupled residuals, two per parameter:
+ *
+ *   h[2k]   = exp( 0.1 x[k] ) + x[k+1]
+ *   h[2k+1] = ( 1 + 0.05 k ) x[k]
+ *
+ * With Analytic set, it provides J v and J^T w products and a dense Jacobian, and with
+ * Diagonal set, the diagonal of J^T J.  The columns of J grow in scale along the chain.
+*/
+template <bool Analytic,
+          bool Diagonal = false>
+struct Test_Chain_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Chain_Model<Analytic,Diagonal>>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    explicit Test_Chain_Model( size_t num_params ) : m_num_params( num_params ) {}
+
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h( 2 * m_num_params );
+        for( size_t k = 0; k < m_num_params; k++ )
+        {
+            h[2 * k]     = std::exp( 0.1 * x[k] ) + x[( k + 1 ) % m_num_params];
+            h[2 * k + 1] = ( 1 + 0.05 * k ) * x[k];
+        }
+        return h;
+    }
+
+    void apply_jacobian( domain_type const& x,
+                         domain_type const& v,
+                         result_type&       Jv ) const requires( Analytic )
+    {
+        for( size_t k = 0; k < m_num_params; k++ )
+        {
+            Jv[2 * k]     = 0.1 * std::exp( 0.1 * x[k] ) * v[k] + v[( k + 1 ) % m_num_params];
+            Jv[2 * k + 1] = ( 1 + 0.05 * k ) * v[k];
+        }
+    }
+
+    void apply_jacobian_transpose( domain_type const& x,
+                                   result_type const& w,
+                                   domain_type&       JTw ) const requires( Analytic )
+    {
+        for( size_t k = 0; k < m_num_params; k++ )
+        {
+            JTw[k] = 0.1 * std::exp( 0.1 * x[k] ) * w[2 * k] + ( 1 + 0.05 * k ) * w[2 * k + 1]
+                   + w[2 * ( ( k + m_num_params - 1 ) % m_num_params )];
+        }
+    }
+
+    void normal_diagonal( domain_type const& x,
+                          domain_type&       d ) const requires( Diagonal )
+    {
+        for( size_t k = 0; k < m_num_params; k++ )
+        {
+            const double a = 0.1 * std::exp( 0.1 * x[k] );
+            const double b = 1 + 0.05 * k;
+            d[k] = a * a + b * b + 1;
+        }
+    }
+
+    jacobian_type jacobian( domain_type const& x ) const requires( Analytic )
+    {
+        jacobian_type J( 2 * m_num_params, m_num_params );
+        for( size_t k = 0; k < m_num_params; k++ )
+        {
+            J( 2 * k, k ) = 0.1 * std::exp( 0.1 * x[k] );
+            J( 2 * k, ( k + 1 ) % m_num_params ) += 1;
+            J( 2 * k + 1, k ) = 1 + 0.05 * k;
+        }
+        return J;
+    }
+
+    size_t m_num_params;
+}; // End of Test_Chain_Model class
+
+/**
+ * Truth and seed for a chain of the given length
+ */
+void build_chain( size_t                num_params,
+                  tmx::VectorN<double>& truth,
+                  tmx::VectorN<double>& seed )
+{
+    truth = tmx::VectorN<double>( num_params );
+    seed  = tmx::VectorN<double>( num_params );
+    for( size_t k = 0; k < num_params; k++ )
+    {
+        truth[k] = std::sin( 0.7 * k ) + 1.5;
+        seed[k]  = 0;
+    }
+}
+
+/****************************************************************/
+/*      Tight forcing reproduces the dense solver's steps       */
+/****************************************************************/
+TEST( Matrix_Free_Levenberg_Marquardt, matches_dense )
+{
+    Test_Chain_Model<true> model( 12 );
+    tmx::VectorN<double> truth, seed;
+    build_chain( 12, truth, seed );
+    auto target = model( truth );
+
+    std::vector<double> dense_norms, free_norms;
+    tmx::optimize::LM_STATUS_CODE status;
+    tmx::optimize::LM_Workspace<Test_Chain_Model<true>> workspace;
+    workspace.set_observer( [&]( const tmx::optimize::LM_Iteration_Info& info ) { dense_norms.push_back( info.norm_try ); } );
+    auto dense = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( dense.has_error() );
+
+    tmx::optimize::Matrix_Free_LM_Options options;
+    options.forcing_max       = 1e-13;
+    options.forcing_min       = 1e-13;
+    options.max_cg_iterations = 1000;
+    options.observer = [&]( const tmx::optimize::LM_Iteration_Info& info ) { free_norms.push_back( info.norm_try ); };
+    auto result = tmx::optimize::matrix_free_levenberg_marquardt( model, seed, target, status, options, 1e-10 );
+    ASSERT_FALSE( result.has_error() );
+
+    // Same path until the norms reach round-off
+    for( size_t i = 0; i < std::min( dense_norms.size(), free_norms.size() ); i++ )
+    {
+        if( dense_norms[i] < 1e-8 )
+        {
+            break;
+        }
+        ASSERT_NEAR( dense_norms[i], free_norms[i], 1e-8 * dense_norms[i] );
+    }
+    for( size_t k = 0; k < truth.size(); k++ )
+    {
+        ASSERT_NEAR( result.value()[k], truth[k], 1e-8 );
+    }
+}
+
+/****************************************************************/
+/*      The model's diagonal of J^T J gives the exact damping   */
+/****************************************************************/
+TEST( Matrix_Free_Levenberg_Marquardt, model_diagonal )
+{
+    Test_Chain_Model<true,true> model( 40 );
+    tmx::VectorN<double> truth, seed;
+    build_chain( 40, truth, seed );
+    auto target = model( truth );
+
+    std::vector<double> dense_norms, free_norms;
+    tmx::optimize::LM_STATUS_CODE status;
+    tmx::optimize::LM_Workspace<Test_Chain_Model<true,true>> workspace;
+    workspace.set_observer( [&]( const tmx::optimize::LM_Iteration_Info& info ) { dense_norms.push_back( info.norm_try ); } );
+    auto dense = tmx::optimize::levenberg_marquardt( model, seed, target, workspace, status );
+    ASSERT_FALSE( dense.has_error() );
+
+    // Few enough probes that without normal_diagonal() the diagonal would be estimated
+    tmx::optimize::Matrix_Free_LM_Options options;
+    options.num_probes        = 4;
+    options.forcing_max       = 1e-13;
+    options.forcing_min       = 1e-13;
+    options.max_cg_iterations = 1000;
+    options.observer = [&]( const tmx::optimize::LM_Iteration_Info& info ) { free_norms.push_back( info.norm_try ); };
+    auto result = tmx::optimize::matrix_free_levenberg_marquardt( model, seed, target, status, options, 1e-10 );
+    ASSERT_FALSE( result.has_error() );
+
+    for( size_t i = 0; i < std::min( dense_norms.size(), free_norms.size() ); i++ )
+    {
+        if( dense_norms[i] < 1e-8 )
+        {
+            break;
+        }
+        ASSERT_NEAR( dense_norms[i], free_norms[i], 1e-8 * dense_norms[i] );
+    }
+}
+
+/****************************************************************/
+/*      Large problem with each preconditioner                  */
+/****************************************************************/
+TEST( Matrix_Free_Levenberg_Marquardt, preconditioners )
+{
+    const size_t num_params = 500;
+    Test_Chain_Model<true> model( num_params );
+    tmx::VectorN<double> truth, seed;
+    build_chain( num_params, truth, seed );
+    auto target = model( truth );
+
+    // Estimated from probes by default, or built exactly from columns of J
+    for( const size_t num_probes : { size_t( 16 ), size_t( 0 ) } )
+    {
+        std::vector<int> linear_iterations;
+        for( auto preconditioner : { tmx::optimize::CG_Preconditioner::NONE,
+                                     tmx::optimize::CG_Preconditioner::JACOBI,
+                                     tmx::optimize::CG_Preconditioner::BLOCK_JACOBI } )
+        {
+            int total = 0;
+            tmx::optimize::Matrix_Free_LM_Options options;
+            options.preconditioner = preconditioner;
+            options.block_size     = 4;
+            options.num_probes     = num_probes;
+            options.observer = [&]( const tmx::optimize::LM_Iteration_Info& info ) { total += info.linear_iterations; };
+
+            tmx::optimize::LM_STATUS_CODE status;
+            auto result = tmx::optimize::matrix_free_levenberg_marquardt( model, seed, target, status, options, 1e-9 );
+            ASSERT_FALSE( result.has_error() );
+            ASSERT_EQ( status, tmx::optimize::LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE );
+            ASSERT_GT( total, 0 );
+            for( size_t k = 0; k < num_params; k++ )
+            {
+                ASSERT_NEAR( result.value()[k], truth[k], 1e-8 );
+            }
+            linear_iterations.push_back( total );
+        }
+
+        // The columns differ in scale by 25x, which the Jacobi preconditioners undo
+        ASSERT_LT( 4 * linear_iterations[1], linear_iterations[0] );
+        ASSERT_LT( 4 * linear_iterations[2], linear_iterations[0] );
+    }
+}
+
+/****************************************************************/
+/*      Finite-difference products without model support        */
+/****************************************************************/
+TEST( Matrix_Free_Levenberg_Marquardt, finite_difference_products )
+{
+    Test_Chain_Model<false> model( 20 );
+    tmx::VectorN<double> truth, seed;
+    build_chain( 20, truth, seed );
+    auto target = model( truth );
+
+    tmx::optimize::Matrix_Free_LM_Options options;
+    options.preconditioner = tmx::optimize::CG_Preconditioner::BLOCK_JACOBI;
+    options.block_size     = 5;
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto result = tmx::optimize::matrix_free_levenberg_marquardt( model, seed, target, status, options, 1e-9 );
+    ASSERT_FALSE( result.has_error() );
+    for( size_t k = 0; k < truth.size(); k++ )
+    {
+        ASSERT_NEAR( result.value()[k], truth[k], 1e-6 );
+    }
+}
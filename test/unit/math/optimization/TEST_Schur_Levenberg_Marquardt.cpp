@@ -0,0 +1,328 @@
+/**
+ * @file    TEST_Schur_Levenberg_Marquardt.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/Schur_Levenberg_Marquardt.hpp>
+
+// C++ Libraries
+#include <limits>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Pinhole cameras which only translate, observing 3D points.  Every camera sees
+ * every point.  Analytic selects between a hand-written and the numerical Jacobian.
+*/
+template <bool Analytic>
+struct Test_Translation_BA : public tmx::optimize::Two_Block_Model_Base<Test_Translation_BA<Analytic>,3,3,2>
+{
+    using base_type = tmx::optimize::Two_Block_Model_Base<Test_Translation_BA<Analytic>,3,3,2>;
+
+    Test_Translation_BA( size_t                              num_cameras,
+                         const std::vector<tmx::Vector3d>&   true_cameras,
+                         const std::vector<tmx::Vector3d>&   true_points )
+      : m_num_cameras( num_cameras )
+    {
+        for( size_t k = 0; k < true_cameras.size() * true_points.size(); k++ )
+        {
+            typename base_type::residual_type pixel;
+            project( true_cameras[k % num_cameras], true_points[k / num_cameras], pixel );
+            m_pixels.push_back( pixel );
+        }
+    }
+
+    size_t num_observations() const { return m_pixels.size(); }
+    size_t camera_index( size_t obs ) const { return obs % m_num_cameras; }
+    size_t point_index( size_t obs ) const { return obs / m_num_cameras; }
+
+    static void project( const tmx::Vector3d&                 camera,
+                         const tmx::Vector3d&                 point,
+                         typename base_type::residual_type&   pixel )
+    {
+        const double w = point[2] - camera[2];
+        pixel[0] = ( point[0] - camera[0] ) / w;
+        pixel[1] = ( point[1] - camera[1] ) / w;
+    }
+
+    void residual( size_t                               obs,
+                   const tmx::Vector3d&                 camera,
+                   const tmx::Vector3d&                 point,
+                   typename base_type::residual_type&   r ) const
+    {
+        project( camera, point, r );
+        r[0] -= m_pixels[obs][0];
+        r[1] -= m_pixels[obs][1];
+    }
+
+    void jacobian( [[maybe_unused]] size_t                   obs,
+                   const tmx::Vector3d&                      camera,
+                   const tmx::Vector3d&                      point,
+                   typename base_type::camera_jacobian_type& J_camera,
+                   typename base_type::point_jacobian_type&  J_point ) const requires( Analytic )
+    {
+        const double w = point[2] - camera[2];
+        for( size_t r = 0; r < 2; r++ )
+        {
+            const double d = point[r] - camera[r];
+            for( size_t c = 0; c < 3; c++ )
+            {
+                J_point( r, c ) = 0;
+            }
+            J_point( r, r ) = 1.0 / w;
+            J_point( r, 2 ) = -d / ( w * w );
+            for( size_t c = 0; c < 3; c++ )
+            {
+                J_camera( r, c ) = -J_point( r, c );
+            }
+        }
+    }
+
+    size_t m_num_cameras;
+    std::vector<typename base_type::residual_type> m_pixels;
+}; // End of Test_Translation_BA class
+
+/**
+ * One camera observing one point, with a point Jacobian of NaNs
+*/
+struct Test_NaN_Point_Model : public tmx::optimize::Two_Block_Model_Base<Test_NaN_Point_Model,3,3,2>
+{
+    using base_type = tmx::optimize::Two_Block_Model_Base<Test_NaN_Point_Model,3,3,2>;
+
+    size_t num_observations() const { return 1; }
+    size_t camera_index( size_t ) const { return 0; }
+    size_t point_index( size_t ) const { return 0; }
+
+    void residual( [[maybe_unused]] size_t               obs,
+                   const tmx::Vector3d&                 camera,
+                   const tmx::Vector3d&                 point,
+                   typename base_type::residual_type&   r ) const
+    {
+        r[0] = point[0] - camera[0] - 1;
+        r[1] = point[1] - camera[1];
+    }
+
+    void jacobian( [[maybe_unused]] size_t                   obs,
+                   [[maybe_unused]] const tmx::Vector3d&     camera,
+                   [[maybe_unused]] const tmx::Vector3d&     point,
+                   typename base_type::camera_jacobian_type& J_camera,
+                   typename base_type::point_jacobian_type&  J_point ) const
+    {
+        for( size_t r = 0; r < 2; r++ )
+        {
+            for( size_t c = 0; c < 3; c++ )
+            {
+                J_camera( r, c ) = r == c ? -1 : 0;
+                J_point( r, c )  = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+    }
+}; // End of Test_NaN_Point_Model class
+
+/**
+ * Truth and perturbed starting values for a small scene
+ */
+void build_scene( std::vector<tmx::Vector3d>& true_cameras,
+                  std::vector<tmx::Vector3d>& true_points,
+                  std::vector<tmx::Vector3d>& cameras,
+                  std::vector<tmx::Vector3d>& points,
+                  double                      noise )
+{
+    for( size_t i = 0; i < 4; i++ )
+    {
+        true_cameras.push_back( tmx::Vector3d( { 0.5 * i, 0.2 * ( i % 2 ), -0.1 * i } ) );
+        cameras.push_back( true_cameras.back() + tmx::Vector3d( { noise * ( i % 3 ), -noise, 0.5 * noise } ) );
+    }
+    for( size_t j = 0; j < 24; j++ )
+    {
+        true_points.push_back( tmx::Vector3d( { -2.0 + 0.4 * ( j % 6 ), -1.0 + 0.5 * ( j / 6 ), 10.0 + 0.3 * ( j % 5 ) } ) );
+        points.push_back( true_points.back() + tmx::Vector3d( { -noise, noise * ( j % 4 ), noise } ) );
+    }
+}
+
+/****************************************************************/
+/*      First step matches a dense solve of the same system     */
+/****************************************************************/
+TEST( Schur_Levenberg_Marquardt, matches_dense_step )
+{
+    std::vector<tmx::Vector3d> true_cameras, true_points, cameras, points;
+    build_scene( true_cameras, true_points, cameras, points, 0.01 );
+    Test_Translation_BA<false> model( 4, true_cameras, true_points );
+
+    // Dense damped normal equations with the same linearization, lambda = 0.1
+    const size_t num_params = 3 * ( cameras.size() + points.size() );
+    tmx::MatrixN<double> J( model.num_observations() * 2, num_params );
+    tmx::VectorN<double> r( model.num_observations() * 2 );
+    for( size_t k = 0; k < model.num_observations(); k++ )
+    {
+        Test_Translation_BA<false>::residual_type r_obs;
+        Test_Translation_BA<false>::camera_jacobian_type J_camera;
+        Test_Translation_BA<false>::point_jacobian_type J_point;
+        model.linearize( k, cameras[model.camera_index( k )], points[model.point_index( k )], r_obs, J_camera, J_point );
+        for( size_t row = 0; row < 2; row++ )
+        {
+            r[2 * k + row] = r_obs[row];
+            for( size_t c = 0; c < 3; c++ )
+            {
+                J( 2 * k + row, 3 * model.camera_index( k ) + c ) = J_camera( row, c );
+                J( 2 * k + row, 3 * ( cameras.size() + model.point_index( k ) ) + c ) = J_point( row, c );
+            }
+        }
+    }
+
+    tmx::MatrixN<double> H( num_params, num_params );
+    tmx::VectorN<double> step( num_params );
+    for( size_t a = 0; a < num_params; a++ )
+    {
+        for( size_t k = 0; k < J.rows(); k++ )
+        {
+            step[a] -= J( k, a ) * r[k];
+            for( size_t b = 0; b < num_params; b++ )
+            {
+                H( a, b ) += J( k, a ) * J( k, b );
+            }
+        }
+    }
+    for( size_t a = 0; a < num_params; a++ )
+    {
+        H( a, a ) += H( a, a ) * 0.1 + 0.1;
+    }
+    ASSERT_TRUE( tmx::linalg::cholesky_decompose( H ) );
+    tmx::linalg::cholesky_solve( H, step );
+
+    auto expected_cameras = cameras;
+    auto expected_points  = points;
+    for( size_t i = 0; i < cameras.size(); i++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            expected_cameras[i][c] += step[3 * i + c];
+        }
+    }
+    for( size_t j = 0; j < points.size(); j++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            expected_points[j][c] += step[3 * ( cameras.size() + j ) + c];
+        }
+    }
+
+    auto summary = tmx::optimize::schur_levenberg_marquardt( model,
+                                                             std::span<tmx::Vector3d>( cameras ),
+                                                             std::span<tmx::Vector3d>( points ),
+                                                             MATH_LM_ABS_TOL,
+                                                             MATH_LM_REL_TOL,
+                                                             1 );
+    ASSERT_EQ( summary.iterations, 1 );
+    ASSERT_LT( summary.final_norm, summary.initial_norm );
+
+    for( size_t i = 0; i < cameras.size(); i++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            ASSERT_NEAR( cameras[i][c], expected_cameras[i][c], 1e-9 );
+        }
+    }
+    for( size_t j = 0; j < points.size(); j++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            ASSERT_NEAR( points[j][c], expected_points[j][c], 1e-9 );
+        }
+    }
+}
+
+/****************************************************************/
+/*      Converges, and threads do not change the answer         */
+/****************************************************************/
+TEST( Schur_Levenberg_Marquardt, converges_parallel )
+{
+    std::vector<tmx::Vector3d> true_cameras, true_points, cameras, points;
+    build_scene( true_cameras, true_points, cameras, points, 0.05 );
+    Test_Translation_BA<true> model( 4, true_cameras, true_points );
+
+    auto serial_cameras = cameras;
+    auto serial_points  = points;
+
+    tmns::math::parallel::Thread_Pool pool( 4 );
+    auto summary = tmx::optimize::schur_levenberg_marquardt( model,
+                                                             std::span<tmx::Vector3d>( cameras ),
+                                                             std::span<tmx::Vector3d>( points ),
+                                                             1e-12,
+                                                             MATH_LM_REL_TOL,
+                                                             MATH_LM_MAX_ITER,
+                                                             pool );
+    ASSERT_EQ( summary.status, tmx::optimize::LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE );
+    ASSERT_LT( summary.final_norm, 1e-12 );
+    ASSERT_GT( summary.initial_norm, 1e-3 );
+
+    tmns::math::parallel::Thread_Pool serial_pool( 1 );
+    auto serial = tmx::optimize::schur_levenberg_marquardt( model,
+                                                            std::span<tmx::Vector3d>( serial_cameras ),
+                                                            std::span<tmx::Vector3d>( serial_points ),
+                                                            1e-12,
+                                                            MATH_LM_REL_TOL,
+                                                            MATH_LM_MAX_ITER,
+                                                            serial_pool );
+    ASSERT_EQ( serial.iterations, summary.iterations );
+    for( size_t i = 0; i < cameras.size(); i++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            ASSERT_EQ( cameras[i][c], serial_cameras[i][c] );
+        }
+    }
+    for( size_t j = 0; j < points.size(); j++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            ASSERT_EQ( points[j][c], serial_points[j][c] );
+        }
+    }
+}
+
+/****************************************************************/
+/*      A point block which cannot be factored rejects the step */
+/****************************************************************/
+TEST( Schur_Levenberg_Marquardt, unfactorable_point_block )
+{
+    Test_NaN_Point_Model model;
+    std::vector<tmx::Vector3d> cameras( 1, tmx::Vector3d( { 0.0, 0.0, 0.0 } ) );
+    std::vector<tmx::Vector3d> points( 1, tmx::Vector3d( { 0.5, 0.5, 10.0 } ) );
+
+    auto summary = tmx::optimize::schur_levenberg_marquardt( model,
+                                                             std::span<tmx::Vector3d>( cameras ),
+                                                             std::span<tmx::Vector3d>( points ),
+                                                             MATH_LM_ABS_TOL,
+                                                             MATH_LM_REL_TOL,
+                                                             3 );
+    ASSERT_EQ( summary.iterations, 3 );
+    ASSERT_EQ( summary.final_norm, summary.initial_norm );
+    for( size_t c = 0; c < 3; c++ )
+    {
+        ASSERT_EQ( cameras[0][c], 0 );
+    }
+    ASSERT_EQ( points[0][0], 0.5 );
+    ASSERT_EQ( points[0][1], 0.5 );
+    ASSERT_EQ( points[0][2], 10 );
+}
+
+/****************************************************************/
+/*      Observations must reference existing cameras/points     */
+/****************************************************************/
+TEST( Schur_Levenberg_Marquardt, invalid_index )
+{
+    std::vector<tmx::Vector3d> true_cameras, true_points, cameras, points;
+    build_scene( true_cameras, true_points, cameras, points, 0.01 );
+    Test_Translation_BA<true> model( 4, true_cameras, true_points );
+
+    points.pop_back();
+    ASSERT_THROW( tmx::optimize::schur_levenberg_marquardt( model,
+                                                            std::span<tmx::Vector3d>( cameras ),
+                                                            std::span<tmx::Vector3d>( points ) ),
+                  std::runtime_error );
+}
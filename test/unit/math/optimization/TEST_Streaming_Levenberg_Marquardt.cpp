@@ -0,0 +1,157 @@
+/**
+ * @file    TEST_Streaming_Levenberg_Marquardt.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/Streaming_Levenberg_Marquardt.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Fits y = a exp( -b t ) + c sin( d t ) + e to many samples, handed out in blocks of
+ * rows.  Analytic selects between a hand-written and the numerical Jacobian.
+*/
+template <bool Analytic>
+struct Test_Curve_Model : public tmx::optimize::Residual_Block_Model_Base<Test_Curve_Model<Analytic>>
+{
+    using domain_type = tmx::VectorN<double>;
+
+    Test_Curve_Model( const domain_type& truth,
+                      size_t             num_samples,
+                      size_t             rows_per_block )
+      : m_rows_per_block( rows_per_block )
+    {
+        for( size_t k = 0; k < num_samples; k++ )
+        {
+            m_times.push_back( 4.0 * k / num_samples );
+            m_samples.push_back( evaluate( truth, m_times.back() ) );
+        }
+    }
+
+    static double evaluate( const domain_type& x, double t )
+    {
+        return x[0] * std::exp( -x[1] * t ) + x[2] * std::sin( x[3] * t ) + x[4];
+    }
+
+    size_t num_blocks() const
+    {
+        return ( m_times.size() + m_rows_per_block - 1 ) / m_rows_per_block;
+    }
+
+    size_t block_rows( size_t block ) const
+    {
+        return std::min( m_rows_per_block, m_times.size() - block * m_rows_per_block );
+    }
+
+    void residual_block( size_t                 block,
+                         const domain_type&     x,
+                         tmx::VectorN<double>&  r ) const
+    {
+        for( size_t row = 0; row < r.size(); row++ )
+        {
+            const size_t k = block * m_rows_per_block + row;
+            r[row] = evaluate( x, m_times[k] ) - m_samples[k];
+        }
+    }
+
+    void jacobian_block( size_t                 block,
+                         const domain_type&     x,
+                         tmx::MatrixN<double>&  J ) const requires( Analytic )
+    {
+        for( size_t row = 0; row < J.rows(); row++ )
+        {
+            const double t = m_times[block * m_rows_per_block + row];
+            const double e = std::exp( -x[1] * t );
+            J( row, 0 ) = e;
+            J( row, 1 ) = -x[0] * t * e;
+            J( row, 2 ) = std::sin( x[3] * t );
+            J( row, 3 ) = x[2] * t * std::cos( x[3] * t );
+            J( row, 4 ) = 1;
+        }
+    }
+
+    size_t m_rows_per_block;
+    std::vector<double> m_times;
+    std::vector<double> m_samples;
+}; // End of Test_Curve_Model class
+
+/**
+ * Parameters the data is generated from, and a start point near them
+ */
+tmx::VectorN<double> curve_truth()
+{
+    return tmx::VectorN<double>( { 2.0, 0.7, 0.5, 3.0, -0.25 } );
+}
+
+tmx::VectorN<double> curve_seed()
+{
+    return tmx::VectorN<double>( { 1.6, 0.9, 0.3, 2.9, 0.0 } );
+}
+
+/****************************************************************/
+/*      Tall fit with a numerical Jacobian recovers the truth   */
+/****************************************************************/
+TEST( Streaming_Levenberg_Marquardt, numeric_jacobian )
+{
+    Test_Curve_Model<false> model( curve_truth(), 20000, 256 );
+    auto x = curve_seed();
+
+    tmx::parallel::Thread_Pool pool( 4 );
+    auto summary = tmx::optimize::streaming_levenberg_marquardt( model, x, 1e-10, 1e-16, 100, pool );
+    ASSERT_NE( summary.status, tmx::optimize::LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE );
+    ASSERT_LT( summary.final_norm, 1e-6 );
+    ASSERT_GT( summary.iterations, 0 );
+
+    for( size_t i = 0; i < x.size(); i++ )
+    {
+        ASSERT_NEAR( x[i], curve_truth()[i], 1e-6 );
+    }
+}
+
+/****************************************************************/
+/*          Analytic block Jacobians are used when given        */
+/****************************************************************/
+TEST( Streaming_Levenberg_Marquardt, analytic_jacobian )
+{
+    Test_Curve_Model<true> model( curve_truth(), 20000, 256 );
+    auto x = curve_seed();
+
+    tmx::parallel::Thread_Pool pool( 4 );
+    auto summary = tmx::optimize::streaming_levenberg_marquardt( model, x, 1e-10, 1e-16, 100, pool );
+    ASSERT_LT( summary.final_norm, 1e-8 );
+    for( size_t i = 0; i < x.size(); i++ )
+    {
+        ASSERT_NEAR( x[i], curve_truth()[i], 1e-8 );
+    }
+}
+
+/****************************************************************/
+/*      Results do not depend on the number of threads          */
+/****************************************************************/
+TEST( Streaming_Levenberg_Marquardt, deterministic_across_threads )
+{
+    // Ragged last block, and a few iterations so rounding has a chance to differ
+    Test_Curve_Model<false> model( curve_truth(), 9999, 100 );
+
+    auto x_serial = curve_seed();
+    tmx::parallel::Thread_Pool serial_pool( 1 );
+    auto serial = tmx::optimize::streaming_levenberg_marquardt( model, x_serial, 1e-10, 1e-16, 5, serial_pool );
+
+    auto x_parallel = curve_seed();
+    tmx::parallel::Thread_Pool parallel_pool( 4 );
+    auto parallel = tmx::optimize::streaming_levenberg_marquardt( model, x_parallel, 1e-10, 1e-16, 5, parallel_pool );
+
+    ASSERT_EQ( serial.iterations, parallel.iterations );
+    ASSERT_EQ( serial.final_norm, parallel.final_norm );
+    for( size_t i = 0; i < x_serial.size(); i++ )
+    {
+        ASSERT_EQ( x_serial[i], x_parallel[i] );
+    }
+}
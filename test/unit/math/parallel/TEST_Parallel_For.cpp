@@ -0,0 +1,149 @@
+/**
+ * @file    TEST_Parallel_For.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/parallel/Parallel_For.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+/****************************************/
+/*          Test Chunk Coverage         */
+/****************************************/
+TEST( Parallel_For, chunk_coverage )
+{
+    tmns::math::parallel::Thread_Pool pool( 4 );
+    ASSERT_EQ( pool.size(), 4 );
+    ASSERT_EQ( tmns::math::parallel::chunk_count( 0, 1000, 64 ), 16 );
+    ASSERT_EQ( tmns::math::parallel::chunk_count( 5, 5, 64 ), 0 );
+
+    std::vector<int> hits( 1000, 0 );
+    std::vector<size_t> chunk_starts( 16, 0 );
+    tmns::math::parallel::parallel_for_chunks( 0, 1000, 64, [&]( size_t chunk, size_t begin, size_t end )
+    {
+        chunk_starts[chunk] = begin;
+        for( size_t i = begin; i < end; i++ )
+        {
+            hits[i]++;
+        }
+    }, pool );
+
+    for( size_t i = 0; i < hits.size(); i++ )
+    {
+        ASSERT_EQ( hits[i], 1 );
+    }
+    for( size_t chunk = 0; chunk < chunk_starts.size(); chunk++ )
+    {
+        ASSERT_EQ( chunk_starts[chunk], chunk * 64 );
+    }
+}
+
+/********************************************/
+/*          Test Nesting and Exceptions     */
+/********************************************/
+TEST( Parallel_For, nesting_and_exceptions )
+{
+    tmns::math::parallel::Thread_Pool pool( 2 );
+
+    // Nested regions run inline on the worker rather than deadlocking
+    std::atomic<size_t> total { 0 };
+    tmns::math::parallel::parallel_for( 0, 8, 1, [&]( size_t, size_t )
+    {
+        tmns::math::parallel::parallel_for( 0, 100, 10, [&]( size_t begin, size_t end )
+        {
+            total += end - begin;
+        }, pool );
+    }, pool );
+    ASSERT_EQ( total.load(), 800 );
+
+    ASSERT_THROW( tmns::math::parallel::parallel_for( 0, 100, 1, []( size_t begin, size_t )
+                  {
+                      if( begin == 50 )
+                      {
+                          throw std::runtime_error( "chunk failed" );
+                      }
+                  }, pool ),
+                  std::runtime_error );
+
+    auto result = pool.submit( [](){ return 42; } );
+    ASSERT_EQ( result.get(), 42 );
+}
+
+/********************************************/
+/*          Test Per-Thread State           */
+/********************************************/
+TEST( Parallel_For, with_state )
+{
+    tmns::math::parallel::Thread_Pool pool( 4 );
+
+    // Each thread accumulates into its own state, which is never shared
+    std::atomic<size_t> states { 0 };
+    std::vector<int> hits( 1000, 0 );
+    tmns::math::parallel::parallel_for_with_state( 0, hits.size(), 7,
+                                                   [&]()
+                                                   {
+                                                       states++;
+                                                       return std::vector<size_t>();
+                                                   },
+                                                   [&]( std::vector<size_t>& seen, size_t begin, size_t end )
+                                                   {
+                                                       for( size_t i = begin; i < end; i++ )
+                                                       {
+                                                           seen.push_back( i );
+                                                           hits[i]++;
+                                                       }
+                                                   },
+                                                   pool );
+
+    ASSERT_GE( states.load(), 1 );
+    ASSERT_LE( states.load(), pool.size() + 1 );
+    for( auto hit : hits )
+    {
+        ASSERT_EQ( hit, 1 );
+    }
+}
+
+/********************************************/
+/*          Test Fixed-Width Groups         */
+/********************************************/
+TEST( Parallel_For, groups )
+{
+    tmns::math::parallel::Thread_Pool pool( 4 );
+
+    // Every item lands in exactly one group, and only the last is short
+    for( size_t count : { 0, 5, 8, 1003 } )
+    {
+        std::vector<int> hits( count, 0 );
+        std::atomic<size_t> short_groups { 0 };
+        tmns::math::parallel::parallel_for_groups<8>( count, 3,
+                                                      [](){ return 0; },
+                                                      [&]( int&, size_t first, size_t used )
+                                                      {
+                                                          ASSERT_EQ( first % 8, 0 );
+                                                          ASSERT_GE( used, 1 );
+                                                          ASSERT_LE( used, 8 );
+                                                          short_groups += used < 8 ? 1 : 0;
+                                                          for( size_t i = first; i < first + used; i++ )
+                                                          {
+                                                              hits[i]++;
+                                                          }
+                                                      },
+                                                      pool );
+        ASSERT_EQ( short_groups.load(), count % 8 != 0 ? 1 : 0 );
+        for( auto hit : hits )
+        {
+            ASSERT_EQ( hit, 1 );
+        }
+    }
+
+    // Batch spans must agree
+    tmns::math::parallel::check_batch_sizes( "groups", 3, { 3, 3 } );
+    tmns::math::parallel::check_batch_sizes( "groups", 3, {} );
+    ASSERT_THROW( tmns::math::parallel::check_batch_sizes( "groups", 3, { 3, 2 } ), std::runtime_error );
+}
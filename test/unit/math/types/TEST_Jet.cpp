@@ -0,0 +1,150 @@
+/**
+ * @file    TEST_Jet.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/matrix.hpp>
+#include <terminus/math/Quaternion_Utilities.hpp>
+#include <terminus/math/types/Jet.hpp>
+#include <terminus/math/vector/VectorN.hpp>
+
+namespace tmx = tmns::math;
+
+using Jet2 = tmx::Jet<double,2>;
+
+/********************************************/
+/*      Test Arithmetic Derivative Rules    */
+/********************************************/
+TEST( Jet, arithmetic )
+{
+    Jet2 x( 3.0, 0 );
+    Jet2 y( 2.0, 1 );
+
+    // f = x * y + x / y - 2 x + 1
+    auto f = x * y + x / y - 2 * x + 1;
+    ASSERT_NEAR( f.value(), 6 + 1.5 - 6 + 1, 1e-12 );
+    ASSERT_NEAR( f.derivative( 0 ), 2 + 0.5 - 2, 1e-12 );
+    ASSERT_NEAR( f.derivative( 1 ), 3 - 3.0 / 4.0, 1e-12 );
+
+    // Constant over a jet
+    auto g = 1.0 / x;
+    ASSERT_NEAR( g.derivative( 0 ), -1.0 / 9.0, 1e-12 );
+    ASSERT_NEAR( g.derivative( 1 ), 0, 1e-12 );
+
+    // Comparisons only use the value
+    ASSERT_TRUE( y < x );
+    ASSERT_TRUE( x > 2.5 );
+
+    Jet2 z = x;
+    z *= y;
+    z -= 1;
+    ASSERT_NEAR( z.value(), 5, 1e-12 );
+    ASSERT_NEAR( z.derivative( 0 ), 2, 1e-12 );
+    ASSERT_NEAR( z.derivative( 1 ), 3, 1e-12 );
+}
+
+/****************************************************/
+/*      Test Math Functions Against Finite Diffs    */
+/****************************************************/
+TEST( Jet, math_functions )
+{
+    using std::sin;
+    using std::cos;
+    using std::exp;
+    using std::sqrt;
+    using std::atan2;
+    using std::pow;
+    using std::log;
+
+    auto func = []( auto x, auto y )
+    {
+        return sin( x ) * exp( y ) + sqrt( x * y ) - atan2( y, x ) + pow( x, 2.5 ) + log( cos( y ) + 2 );
+    };
+
+    const double x0 = 0.7;
+    const double y0 = 0.3;
+    auto f = func( Jet2( x0, 0 ), Jet2( y0, 1 ) );
+
+    const double eps = 1e-6;
+    ASSERT_NEAR( f.value(), func( x0, y0 ), 1e-12 );
+    ASSERT_NEAR( f.derivative( 0 ), ( func( x0 + eps, y0 ) - func( x0 - eps, y0 ) ) / ( 2 * eps ), 1e-7 );
+    ASSERT_NEAR( f.derivative( 1 ), ( func( x0, y0 + eps ) - func( x0, y0 - eps ) ) / ( 2 * eps ), 1e-7 );
+
+    // Integer and float scalars convert to the Jet's value type
+    Jet2 x( 1.5, 0 );
+    auto squared = pow( x, 2 );
+    ASSERT_NEAR( squared.value(), 2.25, 1e-12 );
+    ASSERT_NEAR( squared.derivative( 0 ), 3, 1e-12 );
+    auto power = pow( 2, x );
+    ASSERT_NEAR( power.derivative( 0 ), std::pow( 2, 1.5 ) * std::log( 2 ), 1e-12 );
+    ASSERT_NEAR( pow( x, 0.5f ).derivative( 0 ), 0.5 / std::sqrt( 1.5 ), 1e-12 );
+    ASSERT_NEAR( atan2( x, 1 ).value(), std::atan2( 1.5, 1 ), 1e-12 );
+    ASSERT_NEAR( atan2( 1, x ).derivative( 0 ), -1 / ( 1 + 1.5 * 1.5 ), 1e-12 );
+
+    // Absolute value through the math functor
+    auto a = tmx::Arg_Abs_Functor()( Jet2( -2.0, 0 ) );
+    ASSERT_NEAR( a.value(), 2, 1e-12 );
+    ASSERT_NEAR( a.derivative( 0 ), -1, 1e-12 );
+}
+
+/********************************************************/
+/*      Test Jets inside Vector and Matrix Expressions  */
+/********************************************************/
+TEST( Jet, vector_matrix )
+{
+    tmx::Vector_<Jet2,3> v( { Jet2( 1.0, 0 ), Jet2( 2.0, 1 ), Jet2( 3.0 ) } );
+
+    tmx::Matrix<double,3,3> A( { 1, 2, 0,
+                                 0, 1, 0,
+                                 4, 0, 1 } );
+
+    // Mixed double/Jet product keeps the derivatives
+    tmx::Vector_<Jet2,3> Av = A * v;
+    ASSERT_NEAR( Av[0].value(), 5, 1e-12 );
+    ASSERT_NEAR( Av[0].derivative( 0 ), 1, 1e-12 );
+    ASSERT_NEAR( Av[0].derivative( 1 ), 2, 1e-12 );
+    ASSERT_NEAR( Av[2].derivative( 0 ), 4, 1e-12 );
+
+    tmx::Vector_<Jet2,3> w = 2.0 * v + v;
+    ASSERT_NEAR( w[1].value(), 6, 1e-12 );
+    ASSERT_NEAR( w[1].derivative( 1 ), 3, 1e-12 );
+
+    tmx::VectorN<Jet2> vn( 3 );
+    vn = v - w;
+    ASSERT_NEAR( vn[0].derivative( 0 ), -2, 1e-12 );
+}
+
+/****************************************************/
+/*      Test Quaternion Rotations of Jet Vectors    */
+/****************************************************/
+TEST( Jet, quaternion_rotate )
+{
+    tmx::Quaternion q( std::cos( 0.4 ), 0, 0, std::sin( 0.4 ) );
+    tmx::Vector_<double,3> p( { 1.0, 2.0, 3.0 } );
+
+    tmx::Vector_<Jet2,3> pj( { Jet2( 1.0, 0 ), Jet2( 2.0, 1 ), Jet2( 3.0 ) } );
+    auto R        = q.to_matrix();
+    tmx::Vector_<double,3> expected = R * p;
+    auto actual   = q.rotate_vector( pj );
+    for( size_t i = 0; i < 3; i++ )
+    {
+        ASSERT_NEAR( actual[i].value(), expected[i], 1e-12 );
+        ASSERT_NEAR( actual[i].derivative( 0 ), R( i, 0 ), 1e-12 );
+        ASSERT_NEAR( actual[i].derivative( 1 ), R( i, 1 ), 1e-12 );
+    }
+
+    // Rotation with Jet quaternion components, not unit length
+    tmx::Vector_<Jet2,4> qj( { Jet2( 2 * std::cos( 0.4 ), 0 ), Jet2( 0.0 ), Jet2( 0.0 ), Jet2( 2 * std::sin( 0.4 ), 1 ) } );
+    auto rotated = tmx::quaternion_rotate( qj, p );
+    for( size_t i = 0; i < 3; i++ )
+    {
+        ASSERT_NEAR( rotated[i].value(), expected[i], 1e-12 );
+    }
+
+    // Scaling the quaternion does not change the rotation, so the derivative along q is zero
+    double along = rotated[0].derivative( 0 ) * std::cos( 0.4 ) + rotated[0].derivative( 1 ) * std::sin( 0.4 );
+    ASSERT_NEAR( along, 0, 1e-12 );
+}
@@ -0,0 +1,74 @@
+/**
+ * @file    TEST_Small_Buffer_Array.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/types/Small_Buffer_Array.hpp>
+
+namespace tmx = tmns::math;
+
+/****************************************************/
+/*      Test Inline Storage and Spill to Heap       */
+/****************************************************/
+TEST( Small_Buffer_Array, inline_and_spill )
+{
+    tmx::Small_Buffer_Array<double,4> arr01( 3, 1.5 );
+    ASSERT_EQ( arr01.size(), 3 );
+    ASSERT_TRUE( arr01.is_inline() );
+    ASSERT_EQ( arr01.capacity(), 4 );
+    for( const auto& v : arr01 )
+    {
+        ASSERT_NEAR( v, 1.5, 0.001 );
+    }
+
+    // Still fits
+    arr01.push_back( 2 );
+    ASSERT_TRUE( arr01.is_inline() );
+
+    // Spill and make sure contents are preserved
+    arr01.push_back( 3 );
+    ASSERT_FALSE( arr01.is_inline() );
+    ASSERT_EQ( arr01.size(), 5 );
+    ASSERT_NEAR( arr01[0], 1.5, 0.001 );
+    ASSERT_NEAR( arr01[3], 2,   0.001 );
+    ASSERT_NEAR( arr01[4], 3,   0.001 );
+
+    // Resizing down keeps the heap buffer
+    arr01.resize( 2 );
+    ASSERT_EQ( arr01.size(), 2 );
+    ASSERT_FALSE( arr01.is_inline() );
+
+    ASSERT_THROW( arr01.at( 2 ), std::out_of_range );
+}
+
+/****************************************************/
+/*          Test Copy, Move, and Swap               */
+/****************************************************/
+TEST( Small_Buffer_Array, copy_move_swap )
+{
+    tmx::Small_Buffer_Array<int,4> small( { 1, 2, 3 } );
+    tmx::Small_Buffer_Array<int,4> large( { 1, 2, 3, 4, 5, 6 } );
+
+    // Copies are independent
+    auto small_copy = small;
+    small_copy[0] = 10;
+    ASSERT_EQ( small[0], 1 );
+
+    // Moving a spilled array takes the heap buffer
+    const int* heap_ptr = large.data();
+    auto large_moved = std::move( large );
+    ASSERT_EQ( large_moved.data(), heap_ptr );
+    ASSERT_EQ( large_moved.size(), 6 );
+    ASSERT_TRUE( large.empty() );
+
+    // Swap an inline array with a spilled one
+    small.swap( large_moved );
+    ASSERT_EQ( small.size(), 6 );
+    ASSERT_EQ( large_moved.size(), 3 );
+    ASSERT_TRUE( large_moved.is_inline() );
+    ASSERT_EQ( small[5], 6 );
+    ASSERT_EQ( large_moved[2], 3 );
+}
@@ -36,4 +36,34 @@ TEST( VectorN, simple_operations )
     ASSERT_NEAR( vec02.z(), 2, 0.001 );
     ASSERT_NEAR( vec02[3],  3, 0.001 );
     
+}
+
+/***************************************************/
+/*      Test Small-Buffer Storage                  */
+/***************************************************/
+TEST( VectorN, small_buffer_storage )
+{
+    // Pointer constructor must copy the data
+    std::array<double,4> data { 4, 3, 2, 1 };
+    tmns::math::VectorN<double> vec01( data.data(), data.size() );
+    ASSERT_EQ( vec01.size(), 4 );
+    ASSERT_NEAR( vec01[0], 4, 0.001 );
+    ASSERT_NEAR( vec01[3], 1, 0.001 );
+
+    // Small vectors live inside the object
+    ASSERT_TRUE( vec01.data().is_inline() );
+
+    // Large vectors spill to the heap
+    const size_t inline_size = tmns::math::Vector_Inline_Capacity<double>::value;
+    tmns::math::VectorN<double> vec02( inline_size + 1, 2.0 );
+    ASSERT_FALSE( vec02.data().is_inline() );
+
+    // Growing past the inline capacity preserves contents
+    for( size_t i = 0; i < inline_size; i++ )
+    {
+        vec01.push_back( i );
+    }
+    ASSERT_FALSE( vec01.data().is_inline() );
+    ASSERT_NEAR( vec01[1], 3, 0.001 );
+    ASSERT_NEAR( vec01[5], 1, 0.001 );
 }
\ No newline at end of file
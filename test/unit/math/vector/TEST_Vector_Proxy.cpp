@@ -0,0 +1,96 @@
+/**
+ * @file    TEST_Vector_Proxy.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/vector.hpp>
+#include <terminus/math/vector/Vector_Proxy.hpp>
+
+// C++ Libraries
+#include <array>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Smallest rank-1 view with the std::mdspan interface
+ */
+struct Test_Strided_Vector_View
+{
+    static constexpr size_t rank() { return 1; }
+    static constexpr bool is_always_strided() { return true; }
+    size_t extent( size_t ) const { return size; }
+    size_t stride( size_t ) const { return step; }
+    double* data_handle() const { return data; }
+
+    double* data;
+    size_t  size;
+    size_t  step;
+};
+
+/********************************************/
+/*          Test Vector Proxy Views         */
+/********************************************/
+TEST( Vector_Proxy, strided_views )
+{
+    std::vector<double> buffer { 1, 2, 3, 4, 5, 6 };
+
+    auto packed = tmx::vector_proxy( std::span<double>( buffer ) );
+    ASSERT_EQ( packed.size(), 6 );
+    ASSERT_TRUE( packed.is_contiguous() );
+    ASSERT_EQ( packed.to_span().data(), buffer.data() );
+
+    auto from_ptr = tmx::vector_proxy( buffer.data(), 3 );
+    ASSERT_EQ( from_ptr.size(), 3 );
+    ASSERT_NEAR( from_ptr[2], 3, 0.0001 );
+
+    // Column 1 of a 3x2 row-major buffer
+    tmx::Vector_Proxy<double> column( std::span<double>( buffer ), 3, 2 );
+    ASSERT_NEAR( column[2], 5, 0.0001 );
+    ASSERT_THROW( column.to_span(), std::runtime_error );
+    ASSERT_THROW( tmx::Vector_Proxy<double>( std::span<double>( buffer ), 4, 2 ), std::runtime_error );
+
+    // Reversed view
+    auto reversed = tmx::vector_proxy( buffer.data() + 5, 6, -1 );
+    std::vector<double> visited( reversed.begin(), reversed.end() );
+    ASSERT_EQ( visited, std::vector<double>( { 6, 5, 4, 3, 2, 1 } ) );
+
+    // Expressions and assignment through the stride
+    tmx::Vector_<double,3> offset( { 10, 20, 30 } );
+    tmx::Vector_<double,3> sum = column + offset;
+    ASSERT_NEAR( sum[1], 23, 0.0001 );
+    column = offset;
+    ASSERT_EQ( buffer, std::vector<double>( { 10, 2, 20, 4, 30, 6 } ) );
+
+    std::array<double,3> fixed { 7, 8, 9 };
+    tmx::Vector_Proxy<double,3> fixed_view{ std::span<double,3>( fixed ) };
+    ASSERT_NEAR( fixed_view.z(), 9, 0.0001 );
+}
+
+/********************************************/
+/*          Test mdspan-style Views         */
+/********************************************/
+TEST( Vector_Proxy, strided_view_interop )
+{
+    static_assert( tmx::Strided_View<Test_Strided_Vector_View,1> );
+
+    // Column 1 of a 3x2 row-major buffer
+    std::vector<double> buffer { 1, 2, 3, 4, 5, 6 };
+    auto column = tmx::vector_proxy( Test_Strided_Vector_View { buffer.data() + 1, 3, 2 } );
+    ASSERT_EQ( column.size(), 3 );
+    ASSERT_FALSE( column.is_contiguous() );
+    ASSERT_NEAR( column[2], 6, 0.0001 );
+    column[0] = -2;
+    ASSERT_NEAR( buffer[1], -2, 0.0001 );
+
+#if defined( __cpp_lib_mdspan )
+    std::mdspan<double,std::dextents<size_t,1>,std::layout_stride> md( buffer.data(),
+        std::layout_stride::mapping<std::dextents<size_t,1>>( std::dextents<size_t,1>( 3 ), std::array<size_t,1>{ 2 } ) );
+    tmx::Vector_Proxy<double> md_proxy( md );
+    ASSERT_NEAR( md_proxy[1], 3, 0.0001 );
+    ASSERT_EQ( md_proxy.to_mdspan().stride( 0 ), 2 );
+#endif
+}
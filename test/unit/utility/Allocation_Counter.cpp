@@ -0,0 +1,153 @@
+/**
+ * @file    Allocation_Counter.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include "Allocation_Counter.hpp"
+
+// C++ Libraries
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+/// @brief Per-thread allocation count
+thread_local size_t g_allocation_count { 0 };
+
+} // End of anonymous namespace
+
+namespace tmns::test {
+
+/****************************************/
+/*      Get the allocation count        */
+/****************************************/
+size_t allocation_count()
+{
+    return g_allocation_count;
+}
+
+} // End of tmns::test namespace
+
+/****************************************/
+/*      Replacement Global Allocators   */
+/****************************************/
+void* operator new( size_t size )
+{
+    ++g_allocation_count;
+    if( void* ptr = std::malloc( size ? size : 1 ) )
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[]( size_t size )
+{
+    return ::operator new( size );
+}
+
+void* operator new( size_t size, const std::nothrow_t& ) noexcept
+{
+    ++g_allocation_count;
+    return std::malloc( size ? size : 1 );
+}
+
+void* operator new[]( size_t size, const std::nothrow_t& tag ) noexcept
+{
+    return ::operator new( size, tag );
+}
+
+void* operator new( size_t size, std::align_val_t alignment )
+{
+    ++g_allocation_count;
+    const size_t align = static_cast<size_t>( alignment );
+    void* ptr = nullptr;
+    if( posix_memalign( &ptr, std::max( align, sizeof( void* ) ), size ? size : 1 ) == 0 )
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[]( size_t size, std::align_val_t alignment )
+{
+    return ::operator new( size, alignment );
+}
+
+void* operator new( size_t size, std::align_val_t alignment, const std::nothrow_t& ) noexcept
+{
+    try
+    {
+        return ::operator new( size, alignment );
+    }
+    catch( const std::bad_alloc& )
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[]( size_t size, std::align_val_t alignment, const std::nothrow_t& tag ) noexcept
+{
+    return ::operator new( size, alignment, tag );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr, size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, const std::nothrow_t& ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr, const std::nothrow_t& ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, std::align_val_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr, std::align_val_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, size_t, std::align_val_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr, size_t, std::align_val_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, std::align_val_t, const std::nothrow_t& ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr, std::align_val_t, const std::nothrow_t& ) noexcept
+{
+    std::free( ptr );
+}
@@ -0,0 +1,51 @@
+/**
+ * @file    Allocation_Counter.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+
+namespace tmns::test {
+
+/**
+ * Number of global operator new calls made by this thread since the program started,
+ * counting the aligned and nothrow forms.
+ *
+ * The unit-test binary replaces the global allocation functions so tests can verify
+ * that hot loops do not touch the heap.
+ */
+size_t allocation_count();
+
+/**
+ * Counts heap allocations made by the current thread during the lifetime of the object.
+ */
+class Allocation_Counter
+{
+    public:
+
+        /**
+         * Constructor.  Starts counting.
+         */
+        Allocation_Counter()
+            : m_start( allocation_count() )
+        {}
+
+        /**
+         * Get the number of allocations since construction
+         */
+        size_t count() const
+        {
+            return allocation_count() - m_start;
+        }
+
+    private:
+
+        /// @brief Count at construction
+        size_t m_start { 0 };
+
+}; // End of Allocation_Counter class
+
+} // End of tmns::test namespace